@@ -0,0 +1,131 @@
+// Copyright 2017-2023 Peter Williams <peter@newton.cx> and collaborators
+// Licensed under the MIT License.
+
+//! Time column reads through reference tables for some typical selection
+//! shapes, compared with reading the same rows from a plain table.
+
+use anyhow::Error;
+use clap::{Arg, Command};
+use rubbl_casatables::{GlueDataType, Table, TableCreateMode, TableDesc, TableDescCreateMode};
+use rubbl_core::{ctry, notify::ClapNotificationArgsExt};
+use std::{path::Path, process, time::Instant};
+
+const COL_NAME: &str = "VALUE";
+
+/// Create a table whose single double column holds `values`.
+fn make_table(path: &Path, values: &[u64]) -> Result<Table, Error> {
+    let mut desc = TableDesc::new("", TableDescCreateMode::TDM_SCRATCH)?;
+    desc.add_scalar_column(GlueDataType::TpDouble, COL_NAME, None, false, false)?;
+    let mut table = Table::new(path, desc, values.len(), TableCreateMode::New)?;
+
+    for (row, value) in values.iter().enumerate() {
+        table.put_cell(COL_NAME, row as u64, &(*value as f64))?;
+    }
+
+    Ok(table)
+}
+
+/// Read the column a few times and return the best time in milliseconds.
+fn time_read(table: &mut Table, n_iter: usize) -> Result<f64, Error> {
+    let mut best = f64::INFINITY;
+
+    for _ in 0..n_iter {
+        let t0 = Instant::now();
+        let v = table.get_col_as_vec::<f64>(COL_NAME)?;
+        best = best.min(t0.elapsed().as_secs_f64() * 1e3);
+        assert_eq!(v.len() as u64, table.n_rows());
+    }
+
+    Ok(best)
+}
+
+fn main() {
+    let matches = Command::new("selectbench")
+        .version("0.1.0")
+        .rubbl_notify_args()
+        .arg(
+            Arg::new("N-ROWS")
+                .long("rows")
+                .value_parser(clap::value_parser!(u64))
+                .default_value("1000000")
+                .help("The number of rows in the base table"),
+        )
+        .get_matches();
+
+    process::exit(rubbl_core::notify::run_with_notifications(
+        matches,
+        |matches, _nbe| -> Result<i32, Error> {
+            let n_rows = *matches.get_one::<u64>("N-ROWS").unwrap();
+            let tmp_dir = ctry!(tempfile::tempdir(); "failed to create scratch directory");
+
+            let all: Vec<u64> = (0..n_rows).collect();
+            let mut base = ctry!(
+                make_table(&tmp_dir.path().join("base.tab"), &all);
+                "failed to create the base table"
+            );
+
+            // A pseudo-random half of the rows; an LCG is good enough here.
+            let mut state = 12345u64;
+            let random: Vec<u64> = all
+                .iter()
+                .copied()
+                .filter(|_| {
+                    state = state
+                        .wrapping_mul(6364136223846793005)
+                        .wrapping_add(1442695040888963407);
+                    state >> 63 == 1
+                })
+                .collect();
+
+            let selections: Vec<(&str, Vec<u64>)> = vec![
+                ("all rows", all.clone()),
+                ("time range", (n_rows / 4..3 * n_rows / 4).collect()),
+                (
+                    "scans",
+                    all.iter()
+                        .copied()
+                        .filter(|r| (r / 5000) % 3 != 1)
+                        .collect(),
+                ),
+                ("every 3rd row", (1..n_rows).step_by(3).collect()),
+                ("random half", random),
+                (
+                    "reversed runs",
+                    all.iter()
+                        .rev()
+                        .copied()
+                        .filter(|r| (r / 1000) % 2 == 1)
+                        .collect(),
+                ),
+            ];
+
+            println!(
+                "{:<16} {:>10} {:>12} {:>12}",
+                "selection", "rows", "ref (ms)", "plain (ms)"
+            );
+
+            for (i, (name, rows)) in selections.iter().enumerate() {
+                let mut selected = ctry!(
+                    base.select_rows(rows);
+                    "failed to select rows for \"{}\"", name
+                );
+                let mut plain = ctry!(
+                    make_table(&tmp_dir.path().join(format!("plain{}.tab", i)), rows);
+                    "failed to create the plain table for \"{}\"", name
+                );
+
+                let t_ref = time_read(&mut selected, 5)?;
+                let t_plain = time_read(&mut plain, 5)?;
+                println!(
+                    "{:<16} {:>10} {:>12.3} {:>12.3}",
+                    name,
+                    rows.len(),
+                    t_ref,
+                    t_plain
+                );
+            }
+
+            Ok(0)
+        },
+    ));
+}
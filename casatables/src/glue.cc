@@ -8,7 +8,15 @@
 
 #include <stdexcept>
 #include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan/StArrayFile.h>
 #include <casacore/casa/Containers/ValueHolder.h>
+#include <casacore/tables/Tables/ColumnarExporter.h>
+#include <casacore/tables/Tables/ConcatColumn.h>
+#include <casacore/tables/Tables/ReadAsciiTable.h>
+#include <casacore/tables/Tables/RowGroupReader.h>
+#include <casacore/tables/Tables/TableAttr.h>
+#include <casacore/tables/Tables/TableTrace.h>
+#include <casacore/tables/Tables/TableWatcher.h>
 
 #define CASA_TYPES_ALREADY_DECLARED
 #define GlueTable casacore::Table
@@ -17,10 +25,16 @@
 #define GlueDataType casacore::DataType
 #define GlueTableRecord casacore::TableRecord
 #define GlueColumnDesc casacore::ColumnDesc
+#define GlueRowGroupReader casacore::RowGroupReader
+#define GlueTableWatcher casacore::TableWatcher
 
 #include "glue.h"
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <vector>
 
 
 static void
@@ -43,6 +57,44 @@ bridge_string(const StringBridge &input)
     return result;
 }
 
+// Record fields are looked up by name over and over again, e.g. for every
+// row read into a TableRow. A RecordFieldId remembers the field number it
+// resolved to, so that the lookup is nearly free for the next record with
+// the same or an identically laid out description. Therefore each thread
+// keeps the RecordFieldIds of the field names it used most recently. The
+// returned reference is valid until the next call in the same thread.
+static const casacore::RecordFieldId &
+bridge_field_id(const StringBridge &name)
+{
+    static const size_t N_FIELD_IDS = 32;
+    struct FieldIdCache {
+        std::vector<std::pair<std::string, casacore::RecordFieldId> > ids;
+        size_t next = 0;
+    };
+    static thread_local FieldIdCache cache;
+
+    for (size_t i = 0; i < cache.ids.size(); i++) {
+        const std::string &key = cache.ids[i].first;
+
+        if (key.size() == name.n_bytes &&
+            memcmp(key.data(), name.data, name.n_bytes) == 0)
+            return cache.ids[i].second;
+    }
+
+    std::string key((const char *) name.data, name.n_bytes);
+    std::pair<std::string, casacore::RecordFieldId> entry(key, casacore::RecordFieldId(key));
+
+    if (cache.ids.size() < N_FIELD_IDS) {
+        cache.ids.push_back(entry);
+        return cache.ids.back().second;
+    }
+
+    size_t slot = cache.next;
+    cache.next = (cache.next + 1) % N_FIELD_IDS;
+    cache.ids[slot] = entry;
+    return cache.ids[slot].second;
+}
+
 // To pass strings from C++ to Rust, we *always* have to copy the data. The
 // only time that could safely avoid copying would be if we were absolutely
 // sure that the string buffer pointed into a data structure whose lifetime
@@ -75,6 +127,17 @@ bridge_string_array(const StringBridge *source, const casacore::IPosition &shape
     return array;
 }
 
+static casacore::Block<casacore::String>
+bridge_string_block(const StringBridge *source, unsigned long n)
+{
+    casacore::Block<casacore::String> block(n);
+
+    for (unsigned long i = 0; i < n; i++)
+        block[i] = bridge_string(source[i]);
+
+    return block;
+}
+
 static void
 unbridge_string_array(const casacore::Array<casacore::String> &input,
                         StringBridgeCallback callback, void *ctxt)
@@ -89,6 +152,585 @@ unbridge_string_array(const casacore::Array<casacore::String> &input,
     }
 }
 
+static GlueTable *
+open_table(const casacore::String &path, const TableOpenMode mode,
+           const casacore::TableLock &lock = casacore::TableLock(),
+           bool o_direct = false)
+{
+    GlueTable::TableOption option = GlueTable::Old;
+    casacore::TSMOption tsm_option;
+
+    if (o_direct) {
+        // O_DIRECT is only honoured by the caching storage managers.
+        tsm_option = casacore::TSMOption(casacore::TSMOption::Cache, -2, -2, 1);
+    }
+
+    if (mode == TOM_OPEN_RW)
+        option = GlueTable::Update;
+    else if (mode == TOM_CREATE)
+        option = GlueTable::NewNoReplace;
+    else if (mode == TOM_OPEN_READONLY_DEFERRED)
+        tsm_option.setDeferOpen(true);
+
+    return new GlueTable(path, lock, option, tsm_option);
+}
+
+// Bind the columns of each data manager group named in `dm_specs` to a new
+// data manager of the group's type, created with the specification record
+// stored under the group name.
+static void
+bind_data_manager_specs(casacore::SetupNewTable &new_table, const GlueTableDesc &table_desc,
+                        const GlueTableRecord &dm_specs)
+{
+    casacore::Record dm_info;
+
+    for (casacore::uInt i = 0; i < dm_specs.nfields(); i++) {
+        const casacore::String group = dm_specs.name(i);
+        casacore::String dm_type;
+        std::vector<casacore::String> columns;
+
+        for (casacore::uInt j = 0; j < table_desc.ncolumn(); j++) {
+            const casacore::ColumnDesc &col_desc = table_desc[j];
+
+            if (col_desc.dataManagerGroup() == group) {
+                dm_type = col_desc.dataManagerType();
+                columns.push_back(col_desc.name());
+            }
+        }
+
+        if (columns.empty())
+            throw std::invalid_argument("no column uses data manager group " + group);
+
+        casacore::Record dm;
+        dm.define("TYPE", dm_type);
+        dm.define("NAME", group);
+        dm.defineRecord("SPEC", dm_specs.subRecord(i).toRecord());
+        dm.define("COLUMNS", casacore::Vector<casacore::String>(columns));
+        dm_info.defineRecord(group, dm);
+    }
+
+    if (dm_info.nfields() > 0)
+        new_table.bindCreate(dm_info);
+}
+
+static GlueTable *
+create_table(const casacore::String &path, GlueTableDesc &table_desc,
+             const GlueTableRecord &dm_specs, unsigned long n_rows,
+             const TableCreateMode mode,
+             const casacore::StorageOption &storage = casacore::StorageOption(),
+             GlueTable::EndianFormat endian_format = GlueTable::EndianFormat::LocalEndian)
+{
+    GlueTable::TableType type = GlueTable::TableType::Plain;
+
+    // TODO: expose this as an argument?
+    // const casacore::TSMOption tsmOption();
+
+    // TODO: expose this as an argument?
+    casacore::Bool initialize = true;
+
+    GlueTable::TableOption table_option;
+
+    switch(mode) {
+        case TCM_NEW: table_option = GlueTable::TableOption::New; break;
+        case TCM_NEW_NO_REPLACE: table_option = GlueTable::TableOption::NewNoReplace; break;
+        case TCM_SCRATCH: table_option = GlueTable::TableOption::Scratch; break;
+        case TCM_MEMORY:
+            table_option = GlueTable::TableOption::New;
+            type = GlueTable::TableType::Memory;
+            break;
+        default: throw std::invalid_argument( "invalid TableCreateMode" );
+    }
+
+    // create a an object containing some information about the table we're creating
+    casacore::SetupNewTable newTable(path, table_desc, table_option, storage);
+    bind_data_manager_specs(newTable, table_desc, dm_specs);
+    return new GlueTable(newTable, type, n_rows, initialize, endian_format, casacore::TSMOption());
+}
+
+// Arrow C Data Interface export. Every node of the exported tree owns its
+// buffers and child structs through its private_data, and its release
+// callback releases its children first, as required by the specification.
+// Buffers are 64-byte aligned, the alignment recommended by Arrow.
+
+static const size_t ARROW_ALIGNMENT = 64;
+
+static void *
+arrow_alloc(size_t n_bytes)
+{
+    void *ptr = NULL;
+
+    if (posix_memalign(&ptr, ARROW_ALIGNMENT, n_bytes > 0 ? n_bytes : 1) != 0)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+struct ArrowSchemaPrivate
+{
+    std::string format;
+    std::string name;
+    std::vector<struct ArrowSchema *> children;
+};
+
+struct ArrowArrayPrivate
+{
+    std::vector<void *> owned;
+    std::vector<const void *> buffers;
+    std::vector<struct ArrowArray *> children;
+};
+
+static void
+arrow_release_schema(struct ArrowSchema *schema)
+{
+    ArrowSchemaPrivate *priv = (ArrowSchemaPrivate *) schema->private_data;
+
+    for (size_t i = 0; i < priv->children.size(); i++) {
+        struct ArrowSchema *child = priv->children[i];
+
+        if (child->release != NULL)
+            child->release(child);
+
+        delete child;
+    }
+
+    delete priv;
+    schema->release = NULL;
+}
+
+static void
+arrow_release_array(struct ArrowArray *array)
+{
+    ArrowArrayPrivate *priv = (ArrowArrayPrivate *) array->private_data;
+
+    for (size_t i = 0; i < priv->children.size(); i++) {
+        struct ArrowArray *child = priv->children[i];
+
+        if (child->release != NULL)
+            child->release(child);
+
+        delete child;
+    }
+
+    for (size_t i = 0; i < priv->owned.size(); i++)
+        free(priv->owned[i]);
+
+    delete priv;
+    array->release = NULL;
+}
+
+// Set up an empty schema node. Children are added with arrow_add_child.
+static void
+arrow_init_schema(struct ArrowSchema *schema, const std::string &format, const std::string &name)
+{
+    ArrowSchemaPrivate *priv = new ArrowSchemaPrivate;
+    priv->format = format;
+    priv->name = name;
+
+    schema->format = priv->format.c_str();
+    schema->name = priv->name.c_str();
+    schema->metadata = NULL;
+    schema->flags = 0;
+    schema->n_children = 0;
+    schema->children = NULL;
+    schema->dictionary = NULL;
+    schema->release = arrow_release_schema;
+    schema->private_data = priv;
+}
+
+// Set up an array node without nulls. `buffers` holds the buffers after the
+// (absent) validity bitmap; they are owned and freed by the node.
+static void
+arrow_init_array(struct ArrowArray *array, int64_t length, const std::vector<void *> &buffers)
+{
+    ArrowArrayPrivate *priv = new ArrowArrayPrivate;
+    priv->owned = buffers;
+    priv->buffers.push_back(NULL);
+
+    for (size_t i = 0; i < buffers.size(); i++)
+        priv->buffers.push_back(buffers[i]);
+
+    array->length = length;
+    array->null_count = 0;
+    array->offset = 0;
+    array->n_buffers = (int64_t) priv->buffers.size();
+    array->n_children = 0;
+    array->buffers = priv->buffers.data();
+    array->children = NULL;
+    array->dictionary = NULL;
+    array->release = arrow_release_array;
+    array->private_data = priv;
+}
+
+static struct ArrowSchema *
+arrow_add_child(struct ArrowSchema *parent, const std::string &format, const std::string &name)
+{
+    ArrowSchemaPrivate *priv = (ArrowSchemaPrivate *) parent->private_data;
+    struct ArrowSchema *child = new struct ArrowSchema;
+    child->release = NULL;
+    priv->children.push_back(child);
+    parent->children = priv->children.data();
+    parent->n_children = (int64_t) priv->children.size();
+    arrow_init_schema(child, format, name);
+    return child;
+}
+
+static struct ArrowArray *
+arrow_add_child(struct ArrowArray *parent, int64_t length, const std::vector<void *> &buffers)
+{
+    ArrowArrayPrivate *priv = (ArrowArrayPrivate *) parent->private_data;
+    struct ArrowArray *child = new struct ArrowArray;
+    child->release = NULL;
+
+    try {
+        priv->children.push_back(child);
+    } catch (...) {
+        delete child;
+        for (size_t i = 0; i < buffers.size(); i++)
+            free(buffers[i]);
+        throw;
+    }
+
+    parent->children = priv->children.data();
+    parent->n_children = (int64_t) priv->children.size();
+    arrow_init_array(child, length, buffers);
+    return child;
+}
+
+// Read `n_rows` rows of a numeric column, starting at `row_start`, straight
+// into a freshly allocated aligned buffer. `cell_shape` is empty for scalar
+// columns.
+template <typename T>
+static void *
+arrow_read_column(const casacore::Table &table, const casacore::String &col_name,
+                  const casacore::IPosition &cell_shape, casacore::rownr_t row_start,
+                  casacore::rownr_t n_rows)
+{
+    size_t n_values = n_rows;
+
+    for (size_t i = 0; i < cell_shape.size(); i++)
+        n_values *= cell_shape[i];
+
+    T *data = (T *) arrow_alloc(n_values * sizeof(T));
+
+    if (n_values == 0)
+        return data;
+
+    try {
+        casacore::Slicer rows(casacore::IPosition(1, row_start), casacore::IPosition(1, n_rows));
+
+        if (cell_shape.size() == 0) {
+            casacore::ScalarColumn<T> col(table, col_name);
+            casacore::Vector<T> vec(casacore::IPosition(1, n_rows), data, casacore::SHARE);
+            col.getColumnRange(rows, vec);
+        } else {
+            casacore::ArrayColumn<T> col(table, col_name);
+            casacore::IPosition shape(cell_shape);
+            shape.append(casacore::IPosition(1, n_rows));
+            casacore::Array<T> arr(shape, data, casacore::SHARE);
+            col.getColumnRange(rows, arr);
+        }
+    } catch (...) {
+        free(data);
+        throw;
+    }
+
+    return data;
+}
+
+template <typename T>
+static casacore::Array<T>
+arrow_read_column_copy(const casacore::Table &table, const casacore::String &col_name,
+                       const casacore::IPosition &cell_shape, casacore::rownr_t row_start,
+                       casacore::rownr_t n_rows)
+{
+    casacore::IPosition shape(cell_shape);
+    shape.append(casacore::IPosition(1, n_rows));
+    casacore::Array<T> arr(shape);
+
+    if (arr.nelements() == 0)
+        return arr;
+
+    casacore::Slicer rows(casacore::IPosition(1, row_start), casacore::IPosition(1, n_rows));
+
+    if (cell_shape.size() == 0) {
+        casacore::ScalarColumn<T> col(table, col_name);
+        casacore::Vector<T> vec(arr);
+        col.getColumnRange(rows, vec);
+    } else {
+        casacore::ArrayColumn<T> col(table, col_name);
+        col.getColumnRange(rows, arr);
+    }
+
+    return arr;
+}
+
+// Export one column as a child of the top-level struct. Array cells become
+// nested fixed-size lists, outermost axis first (C order); complex values
+// become fixed-size lists of two floating-point values.
+static void
+arrow_export_column(const casacore::Table &table, const casacore::String &col_name,
+                    casacore::rownr_t row_start, casacore::rownr_t n_rows,
+                    struct ArrowArray *parent_array, struct ArrowSchema *parent_schema)
+{
+    casacore::TableColumn col(table, col_name);
+    const casacore::ColumnDesc &desc = col.columnDesc();
+    casacore::IPosition cell_shape;
+
+    if (desc.isArray()) {
+        if (desc.isFixedShape())
+            cell_shape = desc.shape();
+        else if (n_rows > 0)
+            cell_shape = col.shape(row_start);
+        else
+            cell_shape = casacore::IPosition(desc.ndim() > 0 ? desc.ndim() : 1, 0);
+    }
+
+    // The fixed-size list levels, from the outermost to the innermost.
+
+    struct ArrowArray *array = parent_array;
+    struct ArrowSchema *schema = parent_schema;
+    std::string name = col_name;
+    int64_t length = (int64_t) n_rows;
+
+    for (int i = (int) cell_shape.size() - 1; i >= 0; i--) {
+        char format[32];
+        snprintf(format, sizeof(format), "+w:%lld", (long long) cell_shape[i]);
+        schema = arrow_add_child(schema, format, name);
+        array = arrow_add_child(array, length, std::vector<void *>());
+        name = "item";
+        length *= cell_shape[i];
+    }
+
+    std::vector<void *> buffers;
+
+    switch (desc.dataType()) {
+
+#define CASE(DTYPE, CPPTYPE, FORMAT) \
+    case casacore::DTYPE: \
+        buffers.push_back(arrow_read_column<CPPTYPE>(table, col_name, cell_shape, row_start, n_rows)); \
+        arrow_add_child(array, length, buffers); \
+        arrow_add_child(schema, FORMAT, name); \
+        break;
+
+    CASE(TpChar, casacore::Char, "c")
+    CASE(TpUChar, casacore::uChar, "C")
+    CASE(TpShort, casacore::Short, "s")
+    CASE(TpUShort, casacore::uShort, "S")
+    CASE(TpInt, casacore::Int, "i")
+    CASE(TpUInt, casacore::uInt, "I")
+    CASE(TpInt64, casacore::Int64, "l")
+    CASE(TpFloat, float, "f")
+    CASE(TpDouble, double, "g")
+
+#undef CASE
+
+#define CASE(DTYPE, CPPTYPE, FORMAT) \
+    case casacore::DTYPE: \
+        schema = arrow_add_child(schema, "+w:2", name); \
+        array = arrow_add_child(array, length, std::vector<void *>()); \
+        buffers.push_back(arrow_read_column<CPPTYPE>(table, col_name, cell_shape, row_start, n_rows)); \
+        arrow_add_child(array, 2 * length, buffers); \
+        arrow_add_child(schema, FORMAT, "item"); \
+        break;
+
+    CASE(TpComplex, casacore::Complex, "f")
+    CASE(TpDComplex, casacore::DComplex, "g")
+
+#undef CASE
+
+    case casacore::TpBool: {
+        casacore::Array<casacore::Bool> values =
+            arrow_read_column_copy<casacore::Bool>(table, col_name, cell_shape, row_start, n_rows);
+        uint8_t *bits = (uint8_t *) arrow_alloc((length + 7) / 8);
+        memset(bits, 0, (length + 7) / 8);
+        buffers.push_back(bits);
+
+        int64_t n = 0;
+        casacore::Array<casacore::Bool>::const_iterator end = values.end();
+
+        for (casacore::Array<casacore::Bool>::const_iterator i = values.begin(); i != end; i++, n++) {
+            if (*i)
+                bits[n / 8] |= (uint8_t) (1 << (n % 8));
+        }
+
+        arrow_add_child(array, length, buffers);
+        arrow_add_child(schema, "b", name);
+        break;
+    }
+
+    case casacore::TpString: {
+        casacore::Array<casacore::String> values =
+            arrow_read_column_copy<casacore::String>(table, col_name, cell_shape, row_start, n_rows);
+        casacore::Array<casacore::String>::const_iterator end = values.end();
+        size_t n_bytes = 0;
+
+        for (casacore::Array<casacore::String>::const_iterator i = values.begin(); i != end; i++)
+            n_bytes += i->length();
+
+        if (n_bytes > (size_t) INT32_MAX)
+            throw std::runtime_error("string data of column " + col_name + " too large for Arrow export");
+
+        int32_t *offsets = (int32_t *) arrow_alloc((length + 1) * sizeof(int32_t));
+        buffers.push_back(offsets);
+        char *chars = NULL;
+
+        try {
+            chars = (char *) arrow_alloc(n_bytes);
+        } catch (...) {
+            free(offsets);
+            throw;
+        }
+
+        buffers.push_back(chars);
+        int64_t n = 0;
+        int32_t offset = 0;
+
+        for (casacore::Array<casacore::String>::const_iterator i = values.begin(); i != end; i++, n++) {
+            offsets[n] = offset;
+            memcpy(chars + offset, i->data(), i->length());
+            offset += (int32_t) i->length();
+        }
+
+        offsets[n] = offset;
+        arrow_add_child(array, length, buffers);
+        arrow_add_child(schema, "u", name);
+        break;
+    }
+
+    default:
+        throw std::runtime_error("column " + col_name + " has a data type that cannot be exported to Arrow");
+    }
+}
+
+// Single-pass encoding of a whole TableRecord tree, decoded on the Rust side
+// without further calls into C++. The layout is described in glue.h.
+
+static void
+rec_put_bytes(std::vector<char> &buf, const void *data, size_t n_bytes)
+{
+    const char *bytes = (const char *) data;
+    buf.insert(buf.end(), bytes, bytes + n_bytes);
+}
+
+template <typename T>
+static void
+rec_put_value(std::vector<char> &buf, const T &value)
+{
+    rec_put_bytes(buf, &value, sizeof(T));
+}
+
+static void
+rec_put_string(std::vector<char> &buf, const casacore::String &value)
+{
+    rec_put_value(buf, (uint32_t) value.length());
+    rec_put_bytes(buf, value.data(), value.length());
+}
+
+// Array shapes are written in C order, like those of tablerec_get_field_info.
+static void
+rec_put_shape(std::vector<char> &buf, const casacore::IPosition &shape)
+{
+    rec_put_value(buf, (uint32_t) shape.nelements());
+
+    for (size_t i = shape.nelements(); i > 0; i--)
+        rec_put_value(buf, (uint64_t) shape[i - 1]);
+}
+
+template <typename T>
+static void
+rec_put_array(std::vector<char> &buf, const casacore::Array<T> &array)
+{
+    bool delete_it;
+    const T *data = array.getStorage(delete_it);
+
+    rec_put_shape(buf, array.shape());
+    rec_put_bytes(buf, data, array.nelements() * sizeof(T));
+    array.freeStorage(data, delete_it);
+}
+
+static void
+rec_serialize(std::vector<char> &buf, const casacore::TableRecord &rec)
+{
+    casacore::uInt n_fields = rec.nfields();
+
+    rec_put_value(buf, (uint32_t) n_fields);
+
+    for (casacore::uInt i = 0; i < n_fields; i++) {
+        rec_put_string(buf, rec.name(i));
+        rec_put_value(buf, (uint8_t) rec.type(i));
+
+        switch (rec.type(i)) {
+
+#define SCALAR_CASE(DTYPE, ACCESSOR) \
+        case casacore::DTYPE: \
+            rec_put_value(buf, rec.ACCESSOR(i)); \
+            break;
+
+#define VECTOR_CASE(DTYPE, ACCESSOR) \
+        case casacore::DTYPE: \
+            rec_put_array(buf, rec.ACCESSOR(i)); \
+            break;
+
+        SCALAR_CASE(TpBool, asBool)
+        SCALAR_CASE(TpUChar, asuChar)
+        SCALAR_CASE(TpShort, asShort)
+        SCALAR_CASE(TpInt, asInt)
+        SCALAR_CASE(TpUInt, asuInt)
+        SCALAR_CASE(TpInt64, asInt64)
+        SCALAR_CASE(TpFloat, asFloat)
+        SCALAR_CASE(TpDouble, asDouble)
+        SCALAR_CASE(TpComplex, asComplex)
+        SCALAR_CASE(TpDComplex, asDComplex)
+
+        VECTOR_CASE(TpArrayBool, asArrayBool)
+        VECTOR_CASE(TpArrayUChar, asArrayuChar)
+        VECTOR_CASE(TpArrayShort, asArrayShort)
+        VECTOR_CASE(TpArrayInt, asArrayInt)
+        VECTOR_CASE(TpArrayUInt, asArrayuInt)
+        VECTOR_CASE(TpArrayInt64, asArrayInt64)
+        VECTOR_CASE(TpArrayFloat, asArrayFloat)
+        VECTOR_CASE(TpArrayDouble, asArrayDouble)
+        VECTOR_CASE(TpArrayComplex, asArrayComplex)
+        VECTOR_CASE(TpArrayDComplex, asArrayDComplex)
+
+#undef SCALAR_CASE
+#undef VECTOR_CASE
+
+        case casacore::TpString:
+            rec_put_string(buf, rec.asString(i));
+            break;
+        case casacore::TpArrayString: {
+            const casacore::Array<casacore::String> &array = rec.asArrayString(i);
+            rec_put_shape(buf, array.shape());
+
+            for (casacore::Array<casacore::String>::const_iterator iter = array.begin();
+                 iter != array.end(); ++iter)
+                rec_put_string(buf, *iter);
+            break;
+        }
+        case casacore::TpRecord:
+            rec_serialize(buf, rec.subRecord(i));
+            break;
+        case casacore::TpTable:
+            // Only the name; the subtable is not opened.
+            rec_put_string(buf, rec.tableAttributes(i).name());
+            break;
+        default:
+            throw std::runtime_error("cannot serialize field " + rec.name(i) +
+                                     " with an unhandled data type");
+        }
+    }
+}
+
+static void
+rec_hand_off(const std::vector<char> &buf, StringBridgeCallback callback, void *ctxt)
+{
+    StringBridge bytes;
+    bytes.data = buf.data();
+    bytes.n_bytes = buf.size();
+    callback(&bytes, ctxt);
+}
+
 // The API helpers that we export to the Rust layer
 
 extern "C" {
@@ -196,6 +838,26 @@ extern "C" {
         return 0;
     }
 
+    int
+    tablerec_serialize(
+        const GlueTableRecord &rec,
+        StringBridgeCallback callback,
+        void *ctxt,
+        ExcInfo &exc
+    )
+    {
+        try {
+            std::vector<char> buf;
+            rec_serialize(buf, rec);
+            rec_hand_off(buf, callback, ctxt);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
     int
     tablerec_get_keyword_repr(
         const GlueTableRecord &rec,
@@ -253,7 +915,7 @@ extern "C" {
     {
         try {
             const casacore::RecordDesc &desc = rec.description();
-            casacore::Int field_num = rec.fieldNumber(bridge_string(col_name));
+            casacore::Int field_num = rec.findField(bridge_field_id(col_name));
 
             if (field_num < 0) {
                 std::string s = "unrecognized column name: ";
@@ -290,7 +952,7 @@ extern "C" {
     {
         try {
             const casacore::RecordDesc &desc = rec.description();
-            casacore::Int field_num = rec.fieldNumber(bridge_string(field_name));
+            casacore::Int field_num = rec.findField(bridge_field_id(field_name));
             casacore::IPosition shape;
 
             if (field_num < 0) {
@@ -374,7 +1036,7 @@ extern "C" {
     )
     {
         try {
-            casacore::Int field_num = rec.fieldNumber(bridge_string(col_name));
+            casacore::Int field_num = rec.findField(bridge_field_id(col_name));
 
             if (field_num < 0) {
                 std::string s = "unrecognized keyword name: ";
@@ -406,7 +1068,7 @@ extern "C" {
     )
     {
         try {
-            casacore::Int field_num = rec.fieldNumber(bridge_string(col_name));
+            casacore::Int field_num = rec.findField(bridge_field_id(col_name));
 
             if (field_num < 0) {
                 std::string s = "unrecognized column name: ";
@@ -439,7 +1101,7 @@ extern "C" {
     )
     {
         try {
-            casacore::Int field_num = rec.fieldNumber(bridge_string(col_name));
+            casacore::Int field_num = rec.findField(bridge_field_id(col_name));
 
             if (field_num < 0) {
                 std::string s = "unrecognized column name: ";
@@ -476,7 +1138,7 @@ extern "C" {
 
 #define SCALAR_CASE(DTYPE, CPPTYPE) \
             case casacore::DTYPE: { \
-                rec.define(bridge_string(field_name), *(CPPTYPE *) data); \
+                rec.define(bridge_field_id(field_name), *(CPPTYPE *) data); \
                 break; \
             }
 
@@ -486,7 +1148,7 @@ extern "C" {
                 for (casacore::uInt i = 0; i < n_dims; i++) \
                     shape[i] = dims[n_dims - 1 - i]; \
                 casacore::Array<CPPTYPE> array(shape, (CPPTYPE *) data, casacore::SHARE); \
-                rec.define(bridge_string(field_name), array); \
+                rec.define(bridge_field_id(field_name), array); \
                 break; \
             }
 
@@ -518,7 +1180,7 @@ extern "C" {
 #undef VECTOR_CASE
 
             case casacore::TpString: {
-                rec.define(bridge_string(field_name), bridge_string(*(StringBridge *) data));
+                rec.define(bridge_field_id(field_name), bridge_string(*(StringBridge *) data));
                 break;
             }
 
@@ -526,17 +1188,17 @@ extern "C" {
                 casacore::IPosition shape(n_dims);
                 for (casacore::uInt i = 0; i < n_dims; i++)
                     shape[i] = dims[n_dims - 1 - i];
-                rec.define(bridge_string(field_name), bridge_string_array((const StringBridge *) data, shape));
+                rec.define(bridge_field_id(field_name), bridge_string_array((const StringBridge *) data, shape));
                 break;
             }
 
             case casacore::TpTable: {
-                rec.defineTable( bridge_string(field_name), *((const casacore::Table *)(data)) );
+                rec.defineTable( bridge_field_id(field_name), *((const casacore::Table *)(data)) );
                 break;
             }
 
             case casacore::TpRecord: {
-                rec.defineRecord( bridge_string(field_name), *((const casacore::TableRecord *)(data)) );
+                rec.defineRecord( bridge_field_id(field_name), *((const casacore::TableRecord *)(data)) );
                 break;
             }
 
@@ -551,6 +1213,49 @@ extern "C" {
         return 0;
     }
 
+    int
+    tablerec_remove_field(
+        GlueTableRecord &rec,
+        const StringBridge &field_name,
+        ExcInfo &exc
+    )
+    {
+        try {
+            rec.removeField(bridge_field_id(field_name));
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    tablerec_rename_field(
+        GlueTableRecord &rec,
+        const StringBridge &field_name,
+        const StringBridge &new_name,
+        ExcInfo &exc
+    )
+    {
+        try {
+            casacore::String name = bridge_string(new_name);
+
+            if (rec.fieldNumber(name) >= 0) {
+                std::string s = "duplicate keyword name: ";
+                s.append(name);
+                throw std::runtime_error(s);
+            }
+
+            rec.renameField(name, bridge_field_id(field_name));
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
     int
     tablerec_free(GlueTableRecord *rec, ExcInfo &exc)
     {
@@ -636,6 +1341,13 @@ extern "C" {
             CASE(TpString, casacore::String)
 #undef CASE
 
+            case casacore::TpRecord:
+                table_desc.addColumn(casacore::ScalarRecordColumnDesc(
+                    bridge_string(col_name),
+                    bridge_string(comment)
+                ));
+                break;
+
             default:
                 throw std::runtime_error("unhandled scalar column data type");
             }
@@ -799,6 +1511,26 @@ extern "C" {
         return 0;
     }
 
+    int
+    tabledesc_set_data_manager(
+        GlueTableDesc &table_desc,
+        const StringBridge &col_name,
+        const StringBridge &dm_type,
+        const StringBridge &dm_group,
+        ExcInfo &exc
+    )
+    {
+        try {
+            casacore::ColumnDesc& column_desc = table_desc.rwColumnDesc(bridge_string(col_name));
+            column_desc.dataManagerType() = bridge_string(dm_type);
+            column_desc.dataManagerGroup() = bridge_string(dm_group);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+        return 0;
+    }
+
     int
     tabledesc_put_keyword(
         GlueTableDesc &table_desc,
@@ -868,66 +1600,186 @@ extern "C" {
         const StringBridge &path,
         // Description of columns and keys in the table
         GlueTableDesc &table_desc,
+        // Specifications of data manager groups, keyed by group name
+        const GlueTableRecord &dm_specs,
         // number of rows
         unsigned long n_rows,
         const TableCreateMode mode,
         ExcInfo &exc
     )
     {
-        // TOOD: expose this as an argument?
-        // the enum is either either `Plain` or `Memory`
-        GlueTable::TableType type = GlueTable::TableType::Plain;
-
-        // TODO: expose this as an argument?
-        // const casacore::TSMOption tsmOption();
+        try {
+            return create_table(bridge_string(path), table_desc, dm_specs, n_rows, mode);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
 
-        // TODO: expose this as an argument?
-        casacore::Bool initialize = true;
+    GlueTable *
+    table_create_multi_file(const StringBridge &path, GlueTableDesc &table_desc,
+                            const GlueTableRecord &dm_specs, unsigned long n_rows, const TableCreateMode mode,
+                            const unsigned long block_size, const unsigned long n_shards,
+                            ExcInfo &exc)
+    {
+        try {
+            // -3 reads the use of O_DIRECT from the aipsrc file, as by default.
+            casacore::StorageOption storage(casacore::StorageOption::MultiFile,
+                                            (casacore::Int) block_size, -3,
+                                            (casacore::Int) n_shards);
+            return create_table(bridge_string(path), table_desc, dm_specs, n_rows, mode,
+                                storage);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
 
-        // always use the local endianness
-        GlueTable::EndianFormat endian_format = GlueTable::EndianFormat::LocalEndian;
+    GlueTable *
+    table_create_big_endian(const StringBridge &path, GlueTableDesc &table_desc,
+                            const GlueTableRecord &dm_specs, unsigned long n_rows,
+                            const TableCreateMode mode, ExcInfo &exc)
+    {
+        try {
+            return create_table(bridge_string(path), table_desc, dm_specs, n_rows, mode,
+                                casacore::StorageOption(),
+                                GlueTable::EndianFormat::BigEndian);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
 
+    GlueTable *
+    table_alloc_and_open(const StringBridge &path, const TableOpenMode mode, ExcInfo &exc)
+    {
         try {
-            GlueTable::TableOption table_option;
+            return open_table(bridge_string(path), mode);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
 
-            switch(mode) {
-                case TCM_NEW: table_option = GlueTable::TableOption::New; break;
-                case TCM_NEW_NO_REPLACE: table_option = GlueTable::TableOption::NewNoReplace; break;
-                case TCM_SCRATCH: table_option = GlueTable::TableOption::Scratch; break;
-                default: throw std::invalid_argument( "invalid TableCreateMode" );
+    GlueTable *
+    table_alloc_and_open_o_direct(const StringBridge &path, const TableOpenMode mode, ExcInfo &exc)
+    {
+        try {
+            return open_table(bridge_string(path), mode, casacore::TableLock(), true);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    GlueTable *
+    table_alloc_and_open_locked(const StringBridge &path, const TableOpenMode mode,
+                                const TableLockMode lock_mode,
+                                const unsigned char shared_memory, ExcInfo &exc)
+    {
+        try {
+            casacore::TableLock::LockOption option;
+
+            switch (lock_mode) {
+            case TLM_AUTO: option = casacore::TableLock::AutoLocking; break;
+            case TLM_USER: option = casacore::TableLock::UserLocking; break;
+            case TLM_PERMANENT: option = casacore::TableLock::PermanentLocking; break;
+            case TLM_NONE: option = casacore::TableLock::NoLocking; break;
+            default:
+                throw std::runtime_error("unhandled table lock mode");
             }
 
-            // create a an object containing some information about the table we're creating
-            casacore::SetupNewTable newTable(
-                bridge_string(path),
-                table_desc,
-                table_option
-            );
-            return new GlueTable(newTable, type, n_rows, initialize, endian_format, casacore::TSMOption());
+            casacore::TableLock lock(option);
+            lock.setSharedMemory(shared_memory != 0);
+            return open_table(bridge_string(path), mode, lock);
         } catch (...) {
             handle_exception(exc);
             return NULL;
         }
     }
 
-    GlueTable *
-    table_alloc_and_open(const StringBridge &path, const TableOpenMode mode, ExcInfo &exc)
+    int
+    table_lock(GlueTable &table, const unsigned char write, const unsigned long n_attempts,
+               unsigned char *locked, ExcInfo &exc)
+    {
+        try {
+            *locked = table.lock(write != 0, n_attempts) ? 1 : 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    table_unlock(GlueTable &table, ExcInfo &exc)
+    {
+        try {
+            table.unlock();
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    table_has_lock(const GlueTable &table, const unsigned char write,
+                   unsigned char *has_lock, ExcInfo &exc)
     {
-        GlueTable::TableOption option = GlueTable::Old;
+        try {
+            *has_lock = table.hasLock(write != 0) ? 1 : 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
 
-        if (mode == TOM_OPEN_RW)
-            option = GlueTable::Update;
-        else if (mode == TOM_CREATE)
-            option = GlueTable::NewNoReplace;
+        return 0;
+    }
 
+    // Unlike TableRecord::asTable, this does not open the subtable with the
+    // options of its parent, so that it can also be opened deferred.
+    GlueTable *
+    table_open_subtable(const GlueTable &table, const StringBridge &kw_name,
+                        const TableOpenMode mode, ExcInfo &exc)
+    {
         try {
-            return new GlueTable(bridge_string(path), option, casacore::TSMOption());
+            const casacore::TableRecord &keywords = table.keywordSet();
+            return open_table(keywords.tableAttributes(bridge_string(kw_name)).name(), mode);
         } catch (...) {
             handle_exception(exc);
             return NULL;
         }
     }
 
+    int
+    table_get_open_timing(const GlueTable &table, TableOpenTiming *timing, ExcInfo &exc)
+    {
+        try {
+            casacore::Record rec = table.openTiming();
+
+            memset(timing, 0, sizeof(TableOpenTiming));
+
+            if (rec.nfields() > 0) {
+                timing->lock = rec.asDouble("lock");
+                timing->description = rec.asDouble("description");
+                timing->columns = rec.asDouble("columns");
+                timing->data_managers = rec.asDouble("datamanagers");
+                timing->info = rec.asDouble("info");
+                timing->total = rec.asDouble("total");
+                timing->n_deferred = rec.asuInt("ndeferred");
+                timing->from_snapshot = rec.asBool("snapshot");
+            }
+
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
     void
     table_close_and_free(GlueTable *table, ExcInfo &exc)
     {
@@ -1047,6 +1899,13 @@ extern "C" {
             CASE(TpString, casacore::String)
 #undef CASE
 
+            case casacore::TpRecord:
+                table.addColumn(casacore::ScalarRecordColumnDesc(
+                    bridge_string(col_name),
+                    bridge_string(comment)
+                ));
+                break;
+
             default:
                 throw std::runtime_error("unhandled scalar column data type");
             }
@@ -1229,6 +2088,64 @@ extern "C" {
         }
     }
 
+    int
+    table_serialize_keywords(
+        const GlueTable &table,
+        StringBridgeCallback callback,
+        void *ctxt,
+        ExcInfo &exc
+    )
+    {
+        try {
+            return tablerec_serialize(table.keywordSet(), callback, ctxt, exc);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    // The result is encoded as a record with a subrecord field per column.
+    int
+    table_serialize_column_keywords(
+        const GlueTable &table,
+        const StringBridge *col_names,
+        const unsigned long n_cols,
+        StringBridgeCallback callback,
+        void *ctxt,
+        ExcInfo &exc
+    )
+    {
+        try {
+            casacore::Vector<casacore::String> names;
+
+            if (n_cols == 0) {
+                names = table.tableDesc().columnNames();
+            } else {
+                names.resize(n_cols);
+
+                for (unsigned long i = 0; i < n_cols; i++)
+                    names[i] = bridge_string(col_names[i]);
+            }
+
+            std::vector<char> buf;
+            rec_put_value(buf, (uint32_t) names.size());
+
+            for (size_t i = 0; i < names.size(); i++) {
+                const casacore::TableColumn col(table, names[i]);
+                rec_put_string(buf, names[i]);
+                rec_put_value(buf, (uint8_t) casacore::TpRecord);
+                rec_serialize(buf, col.keywordSet());
+            }
+
+            rec_hand_off(buf, callback, ctxt);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
     const GlueTableRecord*
     table_get_keywords(
         GlueTable &table,
@@ -1331,6 +2248,153 @@ extern "C" {
         return 0;
     }
 
+    GlueTable *
+    table_load_memory(const GlueTable &table, const StringBridge &name,
+                      const StringBridge *col_names, unsigned long n_cols,
+                      ExcInfo &exc)
+    {
+        try {
+            casacore::Vector<casacore::String> names(n_cols);
+
+            for (unsigned long i = 0; i < n_cols; i++)
+                names[i] = bridge_string(col_names[i]);
+
+            return new GlueTable(casacore::TableCopy::loadMemoryTable(bridge_string(name), table, names));
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    // The column names and types are given by the first two lines of the
+    // data file; see casacore's readAsciiTable.
+    GlueTable *
+    table_read_ascii(const StringBridge &data_path, const StringBridge &table_path,
+                     const char separator, const StringBridge &comment_marker,
+                     const unsigned long n_threads, const unsigned long chunk_size,
+                     const int in_memory, ExcInfo &exc)
+    {
+        try {
+            casacore::String format;
+            casacore::String data = bridge_string(data_path);
+            GlueTable::TableType type = in_memory ? GlueTable::Memory : GlueTable::Plain;
+
+            return new GlueTable(casacore::readAsciiTable(format, type, data, data, "",
+                                                          bridge_string(table_path), separator,
+                                                          bridge_string(comment_marker), 1, -1,
+                                                          n_threads, chunk_size));
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    int
+    table_trace_set_metrics(const unsigned char enable, ExcInfo &exc)
+    {
+        try {
+            casacore::TableTrace::setMetrics(enable);
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    GlueTableRecord *
+    table_trace_get_metrics(ExcInfo &exc)
+    {
+        try {
+            return new GlueTableRecord(casacore::TableTrace::metrics());
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    int
+    table_trace_reset_metrics(ExcInfo &exc)
+    {
+        try {
+            casacore::TableTrace::resetMetrics();
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    GlueTableRecord *
+    table_get_cache_statistics(const GlueTable &table, ExcInfo &exc)
+    {
+        try {
+            return new GlueTableRecord(table.cacheStatistics());
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    int
+    table_set_cache_budget(const unsigned long n_bytes, ExcInfo &exc)
+    {
+        try {
+            casacore::Table::setCacheBudget(n_bytes);
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    int
+    table_set_array_file_cache_size(const unsigned long n_bytes, ExcInfo &exc)
+    {
+        try {
+            casacore::StManArrayFile::setDefaultCacheSize(n_bytes);
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    int
+    table_vacuum(GlueTable &table, unsigned long *n_bytes, ExcInfo &exc)
+    {
+        try {
+            *n_bytes = table.vacuum();
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    int
+    table_write_snapshot(GlueTable &table, int *written, ExcInfo &exc)
+    {
+        try {
+            *written = table.writeOpenSnapshot() ? 1 : 0;
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    int
+    table_remove_snapshot(GlueTable &table, int *removed, ExcInfo &exc)
+    {
+        try {
+            *removed = table.removeOpenSnapshot() ? 1 : 0;
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
     int
     table_get_column_info(const GlueTable &table, const StringBridge &col_name,
                           unsigned long *n_rows, GlueDataType *data_type,
@@ -1430,30 +2494,140 @@ extern "C" {
     }
 
     int
-    table_get_cell_info(const GlueTable &table, const StringBridge &col_name,
-                        unsigned long row_number, GlueDataType *data_type,
-                        int *n_dim, unsigned long dims[8], ExcInfo &exc)
+    table_get_array_column_data(const GlueTable &table, const StringBridge &col_name,
+                                const unsigned long row_start, const unsigned long n_rows,
+                                const unsigned long n_dims, const unsigned long *slice_start,
+                                const unsigned long *slice_length, void *data, ExcInfo &exc)
     {
         try {
-            casacore::TableColumn col(table, bridge_string(col_name));
+            const casacore::String name = bridge_string(col_name);
+            const casacore::TableColumn col(table, name);
             const casacore::ColumnDesc &desc = col.columnDesc();
 
-            *data_type = desc.dataType();
+            if (desc.isScalar() || !desc.isFixedShape())
+                throw std::runtime_error("table_get_array_column_data requires a fixed-shape array column");
 
-            if (desc.isScalar())
-                *n_dim = 0;
-            else {
-                *n_dim = (int) col.ndim(row_number);
+            const casacore::IPosition &cell_shape = desc.shape();
 
-                if (*n_dim > 8)
-                    throw std::runtime_error("cannot handle cells with data of dimensionality greater than 8");
+            if (n_dims != cell_shape.size())
+                throw std::invalid_argument("slice dimensionality does not match the column");
 
-                const casacore::IPosition shape = col.shape(row_number);
+            if (row_start + n_rows > table.nrow())
+                throw std::out_of_range("requested rows exceed the table size");
 
-                for (int i = 0; i < *n_dim; i++)
-                    dims[*n_dim - 1 - i] = (unsigned long) shape[i];
+            // The slice is given in C order; casacore uses Fortran order.
+            casacore::IPosition start(n_dims, 0);
+            casacore::IPosition length(cell_shape);
+
+            if (slice_start != NULL) {
+                for (unsigned long i = 0; i < n_dims; i++) {
+                    start[n_dims - 1 - i] = slice_start[i];
+                    length[n_dims - 1 - i] = slice_length[i];
+                }
             }
-        } catch (...) {
+
+            if (n_rows == 0 || length.product() == 0)
+                return 0;
+
+            casacore::Slicer rows(casacore::IPosition(1, row_start), casacore::IPosition(1, n_rows));
+            casacore::Slicer section(start, length, casacore::Slicer::endIsLength);
+            casacore::IPosition shape(length);
+            shape.append(casacore::IPosition(1, n_rows));
+
+            switch (desc.dataType()) {
+
+#define CASE(DTYPE, CPPTYPE) \
+            case casacore::DTYPE: { \
+                casacore::ArrayColumn<CPPTYPE> col(table, name); \
+                casacore::Array<CPPTYPE> arr(shape, (CPPTYPE *) data, casacore::SHARE); \
+                if (slice_start != NULL) \
+                    col.getColumnRange(rows, section, arr); \
+                else \
+                    col.getColumnRange(rows, arr); \
+                break; \
+            }
+
+            CASE(TpBool, casacore::Bool)
+            CASE(TpChar, casacore::Char)
+            CASE(TpUChar, casacore::uChar)
+            CASE(TpShort, casacore::Short)
+            CASE(TpUShort, casacore::uShort)
+            CASE(TpInt, casacore::Int)
+            CASE(TpUInt, casacore::uInt)
+            CASE(TpFloat, float)
+            CASE(TpDouble, double)
+            CASE(TpComplex, casacore::Complex)
+            CASE(TpDComplex, casacore::DComplex)
+
+#undef CASE
+
+            default:
+                throw std::runtime_error("unhandled array column data type");
+            }
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    table_get_cell_info(const GlueTable &table, const StringBridge &col_name,
+                        unsigned long row_number, GlueDataType *data_type,
+                        int *n_dim, unsigned long dims[8], ExcInfo &exc)
+    {
+        try {
+            casacore::TableColumn col(table, bridge_string(col_name));
+            const casacore::ColumnDesc &desc = col.columnDesc();
+
+            *data_type = desc.dataType();
+
+            if (desc.isScalar())
+                *n_dim = 0;
+            else {
+                // Resolve the shape only once; ndim() would read it as well.
+                const casacore::IPosition shape = col.shape(row_number);
+                *n_dim = (int) shape.nelements();
+
+                if (*n_dim > 8)
+                    throw std::runtime_error("cannot handle cells with data of dimensionality greater than 8");
+
+                for (int i = 0; i < *n_dim; i++)
+                    dims[*n_dim - 1 - i] = (unsigned long) shape[i];
+            }
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // `n_dims` must have room for `n_rows` values and `dims` for `n_rows * 8`.
+    // A cell without an array gets zero dimensions.
+    int
+    table_get_cell_shapes(const GlueTable &table, const StringBridge &col_name,
+                          const unsigned long start_row, const unsigned long n_rows,
+                          int *n_dims, unsigned long *dims, ExcInfo &exc)
+    {
+        try {
+            casacore::TableColumn col(table, bridge_string(col_name));
+            std::vector<casacore::IPosition> shapes = col.shapes(start_row, n_rows);
+
+            for (unsigned long row = 0; row < n_rows; row++) {
+                const casacore::IPosition &shape = shapes[row];
+                int n_dim = (int) shape.nelements();
+
+                if (n_dim > 8)
+                    throw std::runtime_error("cannot handle cells with data of dimensionality greater than 8");
+
+                n_dims[row] = n_dim;
+
+                for (int i = 0; i < n_dim; i++)
+                    dims[8 * row + n_dim - 1 - i] = (unsigned long) shape[i];
+            }
+        } catch (...) {
             handle_exception(exc);
             return 1;
         }
@@ -1503,6 +2677,7 @@ extern "C" {
             SCALAR_CASE(TpDouble, double)
             SCALAR_CASE(TpComplex, casacore::Complex)
             SCALAR_CASE(TpDComplex, casacore::DComplex)
+            SCALAR_CASE(TpRecord, casacore::TableRecord)
 
             VECTOR_CASE(TpArrayBool, casacore::Bool)
             VECTOR_CASE(TpArrayChar, casacore::Char)
@@ -1609,6 +2784,7 @@ extern "C" {
             SCALAR_CASE(TpDouble, double)
             SCALAR_CASE(TpComplex, casacore::Complex)
             SCALAR_CASE(TpDComplex, casacore::DComplex)
+            SCALAR_CASE(TpRecord, casacore::TableRecord)
 
             VECTOR_CASE(TpArrayBool, casacore::Bool)
             VECTOR_CASE(TpArrayChar, casacore::Char)
@@ -1664,6 +2840,240 @@ extern "C" {
         return 0;
     }
 
+    int
+    table_remove_rows(GlueTable &table, const unsigned long *row_numbers,
+                      const unsigned long n_rows, ExcInfo &exc)
+    {
+        try {
+            casacore::Vector<casacore::rownr_t> rows(n_rows);
+
+            for (unsigned long i = 0; i < n_rows; i++)
+                rows[i] = row_numbers[i];
+
+            table.removeRow(rows);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    table_flush(GlueTable &table, const unsigned char fsync, ExcInfo &exc)
+    {
+        try {
+            table.flush(fsync != 0);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // Sorting and selection. The tables returned here are RefTables: they
+    // reference rows of `table` rather than copying them, and they keep their
+    // parent alive, so they can outlive the handle they were created from.
+
+    GlueTable *
+    table_sort(const GlueTable &table, const StringBridge *col_names,
+               const unsigned char *descending, const unsigned long n_keys,
+               ExcInfo &exc)
+    {
+        try {
+            casacore::Block<casacore::Int> orders(n_keys, casacore::Sort::Ascending);
+
+            for (unsigned long i = 0; i < n_keys; i++) {
+                if (descending[i])
+                    orders[i] = casacore::Sort::Descending;
+            }
+
+            return new GlueTable(table.sort(bridge_string_block(col_names, n_keys), orders));
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    GlueTable *
+    table_select_rows(const GlueTable &table, const unsigned long *row_numbers,
+                      const unsigned long n_rows, ExcInfo &exc)
+    {
+        try {
+            casacore::Vector<casacore::rownr_t> rows(n_rows);
+
+            for (unsigned long i = 0; i < n_rows; i++)
+                rows[i] = row_numbers[i];
+
+            return new GlueTable(table(rows));
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    // Concatenate `n_tables` tables with the same columns into a virtual
+    // table. Bulk reads of its columns read the member tables concurrently;
+    // `table_set_concat_max_threads` caps the number of threads (0 means
+    // the number of CPUs, 1 reads the tables one after the other).
+
+    GlueTable *
+    table_concat(const GlueTable *const *tables, const unsigned long n_tables,
+                 ExcInfo &exc)
+    {
+        try {
+            casacore::Block<casacore::Table> members(n_tables);
+
+            for (unsigned long i = 0; i < n_tables; i++)
+                members[i] = *tables[i];
+
+            return new GlueTable(members);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    int
+    table_set_concat_max_threads(const unsigned long n_threads, ExcInfo &exc)
+    {
+        try {
+            casacore::ConcatColumn::setMaxNThreads(n_threads);
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    // Sort `table` by the given keys and compute the group boundaries in one
+    // pass, using the same machinery that TableIterator uses when it caches
+    // its iteration boundaries. `row_numbers` must have room for
+    // `table_n_rows()` values and receives the row numbers of `table` in
+    // sorted order. `boundaries` must have room for `table_n_rows() + 1`
+    // values and receives the index into `row_numbers` at which each group
+    // starts, followed by a final entry equal to the number of rows. So
+    // group `i` consists of `row_numbers[boundaries[i]..boundaries[i+1]]`.
+    int
+    table_sort_groups(const GlueTable &table, const StringBridge *col_names,
+                      const unsigned long n_keys, unsigned long *row_numbers,
+                      unsigned long *boundaries, unsigned long *n_groups,
+                      ExcInfo &exc)
+    {
+        try {
+            const casacore::rownr_t n_rows = table.nrow();
+
+            if (n_rows == 0) {
+                boundaries[0] = 0;
+                *n_groups = 0;
+                return 0;
+            }
+
+            std::shared_ptr<casacore::Vector<casacore::rownr_t>> starts =
+                std::make_shared<casacore::Vector<casacore::rownr_t>>();
+            std::shared_ptr<casacore::Vector<size_t>> key_changes =
+                std::make_shared<casacore::Vector<size_t>>();
+
+            casacore::Table sorted = table.sort(
+                bridge_string_block(col_names, n_keys),
+                casacore::Block<casacore::CountedPtr<casacore::BaseCompare> >(n_keys),
+                casacore::Block<casacore::Int>(n_keys, casacore::Sort::Ascending),
+                casacore::Sort::ParSort,
+                starts,
+                key_changes
+            );
+
+            casacore::RowNumbers rows = sorted.rowNumbers(table);
+
+            for (casacore::rownr_t i = 0; i < n_rows; i++)
+                row_numbers[i] = rows[i];
+
+            for (size_t i = 0; i < starts->nelements(); i++)
+                boundaries[i] = (*starts)[i];
+
+            boundaries[starts->nelements()] = n_rows;
+            *n_groups = starts->nelements();
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // Columnar export. See the Arrow helpers at the top of this file. The
+    // result is a struct array with one child per requested column.
+
+    int
+    table_export_arrow(const GlueTable &table, const StringBridge *col_names,
+                       const unsigned long n_cols, const unsigned long row_start,
+                       const unsigned long n_rows, struct ArrowArray *array,
+                       struct ArrowSchema *schema, ExcInfo &exc)
+    {
+        array->release = NULL;
+        schema->release = NULL;
+
+        try {
+            if (row_start > table.nrow() || n_rows > table.nrow() - row_start)
+                throw std::runtime_error("requested rows extend beyond the end of the table");
+
+            arrow_init_schema(schema, "+s", "");
+            arrow_init_array(array, (int64_t) n_rows, std::vector<void *>());
+
+            for (unsigned long i = 0; i < n_cols; i++)
+                arrow_export_column(table, bridge_string(col_names[i]), row_start, n_rows,
+                                    array, schema);
+        } catch (...) {
+            if (array->release != NULL)
+                array->release(array);
+
+            if (schema->release != NULL)
+                schema->release(schema);
+
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // `codecs` holds a ColumnarExporter::Codec per column, or is NULL to
+    // let the exporter choose per chunk.
+    int
+    table_export_columnar(const GlueTable &table, const StringBridge &path,
+                          const StringBridge *col_names, const unsigned long n_cols,
+                          const unsigned char *codecs, const unsigned long rows_per_group,
+                          const unsigned long n_threads, unsigned long *n_row_groups,
+                          ExcInfo &exc)
+    {
+        try {
+            casacore::Vector<casacore::String> names(n_cols);
+
+            for (unsigned long i = 0; i < n_cols; i++)
+                names[i] = bridge_string(col_names[i]);
+
+            casacore::ColumnarExporter exporter(table, names, rows_per_group,
+                                                casacore::ColumnarExporter::Auto, n_threads);
+
+            if (codecs != NULL) {
+                for (unsigned long i = 0; i < n_cols; i++) {
+                    if (codecs[i] > casacore::ColumnarExporter::Auto)
+                        throw std::runtime_error("invalid columnar codec");
+
+                    exporter.setCodec(i, (casacore::ColumnarExporter::Codec) codecs[i]);
+                }
+            }
+
+            *n_row_groups = exporter.write(bridge_string(path));
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
     // Rows
 
     GlueTableRow *
@@ -1680,6 +3090,21 @@ extern "C" {
         }
     }
 
+    GlueTableRow *
+    table_row_alloc_columns(const GlueTable &table, const StringBridge *col_names,
+                            const unsigned long n_cols, ExcInfo &exc)
+    {
+        try {
+            casacore::Vector<casacore::String> names =
+                bridge_string_array(col_names, casacore::IPosition(1, n_cols));
+            // Lazy: each field is only read when it is first accessed.
+            return new casacore::ROTableRow(table, names, false, true);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
     int
     table_row_free(GlueTableRow *row, ExcInfo &exc)
     {
@@ -1725,7 +3150,9 @@ extern "C" {
                             unsigned long dims[8], ExcInfo &exc)
     {
         try {
-            return tablerec_get_field_info(row.record(), col_name, data_type, n_dim, dims, exc);
+            // In a lazy row, this reads the field if needed.
+            const casacore::TableRecord &rec = row.getField(bridge_string(col_name));
+            return tablerec_get_field_info(rec, col_name, data_type, n_dim, dims, exc);
         } catch (...) {
             handle_exception(exc);
             return 1;
@@ -1739,7 +3166,8 @@ extern "C" {
                        void *data, ExcInfo &exc)
     {
         try {
-            return tablerec_get_field(row.record(), col_name, data, exc);
+            const casacore::TableRecord &rec = row.getField(bridge_string(col_name));
+            return tablerec_get_field(rec, col_name, data, exc);
         } catch (...) {
             handle_exception(exc);
             return 1;
@@ -1752,7 +3180,8 @@ extern "C" {
                               ExcInfo &exc)
     {
         try {
-            return tablerec_get_field_string(row.record(), col_name, callback, ctxt, exc);
+            const casacore::TableRecord &rec = row.getField(bridge_string(col_name));
+            return tablerec_get_field_string(rec, col_name, callback, ctxt, exc);
         } catch (...) {
             handle_exception(exc);
             return 1;
@@ -1765,7 +3194,8 @@ extern "C" {
                                     ExcInfo &exc)
     {
         try {
-            return tablerec_get_field_string_array(row.record(), col_name, callback, ctxt, exc);
+            const casacore::TableRecord &rec = row.getField(bridge_string(col_name));
+            return tablerec_get_field_string_array(rec, col_name, callback, ctxt, exc);
         } catch (...) {
             handle_exception(exc);
             return 1;
@@ -1800,4 +3230,176 @@ extern "C" {
 
         return 0;
     }
+
+    // Row groups
+
+    GlueRowGroupReader *
+    row_group_reader_alloc(const GlueTable &table, const StringBridge *col_names,
+                           const unsigned long n_cols, const unsigned long block_rows,
+                           const unsigned char prefetch, ExcInfo &exc)
+    {
+        try {
+            casacore::Vector<casacore::String> names =
+                bridge_string_array(col_names, casacore::IPosition(1, n_cols));
+            return new casacore::RowGroupReader(table, names, block_rows, (bool) prefetch);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    int
+    row_group_reader_free(GlueRowGroupReader *reader, ExcInfo &exc)
+    {
+        try {
+            delete reader;
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    // On success, `n_rows` is zero once all rows have been read.
+    int
+    row_group_reader_next(GlueRowGroupReader &reader, unsigned long *block_start,
+                          unsigned long *n_rows, ExcInfo &exc)
+    {
+        try {
+            reader.next();
+            *block_start = reader.blockStart();
+            *n_rows = reader.blockRows();
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // The dimensions are those of one cell; n_dim is zero for scalar columns.
+    int
+    row_group_reader_get_column_info(const GlueRowGroupReader &reader, const unsigned long col_index,
+                                     GlueDataType *data_type, int *n_dim,
+                                     unsigned long dims[8], ExcInfo &exc)
+    {
+        try {
+            const casacore::IPosition &shape = reader.cellShape(col_index);
+
+            if (shape.size() > 8)
+                throw std::runtime_error("cannot handle cells of dimensionality greater than 8");
+
+            *data_type = reader.dataType(col_index);
+            *n_dim = (int) shape.size();
+
+            for (int i = 0; i < *n_dim; i++)
+                dims[*n_dim - 1 - i] = (unsigned long) shape[i];
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // The returned buffer belongs to the reader and holds the current block
+    // of the column, rows varying slowest. It is valid until the next call to
+    // row_group_reader_next.
+    int
+    row_group_reader_get_column_data(const GlueRowGroupReader &reader, const unsigned long col_index,
+                                     const void **data, ExcInfo &exc)
+    {
+        try {
+            if (reader.dataType(col_index) == casacore::TpString)
+                throw std::runtime_error("use row_group_reader_get_column_strings for TpString columns");
+
+            const casacore::ArrayBase &array = reader.columnData(col_index);
+
+            if (!array.contiguousStorage())
+                throw std::runtime_error("row group buffer is unexpectedly not contiguous");
+
+            bool delete_it;
+            *data = array.getVStorage(delete_it);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    row_group_reader_get_column_strings(const GlueRowGroupReader &reader, const unsigned long col_index,
+                                        StringBridgeCallback callback, void *ctxt, ExcInfo &exc)
+    {
+        try {
+            unbridge_string_array(reader.array<casacore::String>(col_index), callback, ctxt);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // Table watchers
+
+    GlueTableWatcher *
+    table_watcher_alloc(const GlueTable &table, const double poll_interval, ExcInfo &exc)
+    {
+        try {
+            return new casacore::TableWatcher(table, poll_interval);
+        } catch (...) {
+            handle_exception(exc);
+            return NULL;
+        }
+    }
+
+    int
+    table_watcher_free(GlueTableWatcher *watcher, ExcInfo &exc)
+    {
+        try {
+            delete watcher;
+            return 0;
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+    }
+
+    // `change` is only filled in if `changed` is set to nonzero.
+    int
+    table_watcher_wait(GlueTableWatcher &watcher, const double timeout, unsigned char *changed,
+                       TableChange *change, ExcInfo &exc)
+    {
+        try {
+            *changed = (unsigned char) watcher.wait(timeout);
+
+            if (*changed) {
+                change->first_new_row = watcher.firstNewRow();
+                change->n_rows = watcher.nrow();
+                change->rows_removed = (unsigned char) watcher.rowsRemoved();
+                change->table_changed = (unsigned char) watcher.tableChanged();
+            }
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int
+    table_watcher_get_changed_columns(const GlueTableWatcher &watcher, StringBridgeCallback callback,
+                                      void *ctxt, ExcInfo &exc)
+    {
+        try {
+            unbridge_string_array(watcher.changedColumns(), callback, ctxt);
+        } catch (...) {
+            handle_exception(exc);
+            return 1;
+        }
+
+        return 0;
+    }
 }
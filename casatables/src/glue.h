@@ -87,6 +87,8 @@ typedef struct GlueTable GlueTable;
 typedef struct GlueTableRow GlueTableRow;
 typedef struct GlueTableDesc GlueTableDesc;
 typedef struct GlueTableRecord GlueTableRecord;
+typedef struct GlueRowGroupReader GlueRowGroupReader;
+typedef struct GlueTableWatcher GlueTableWatcher;
 
 #endif
 
@@ -113,6 +115,30 @@ typedef struct ExcInfo
     char message[512];
 } ExcInfo;
 
+// The time in seconds spent in the parts of opening a table, filled in by
+// table_get_open_timing. All values are zero for a table not opened from disk.
+typedef struct TableOpenTiming
+{
+    double lock;
+    double description;
+    double columns;
+    double data_managers;
+    double info;
+    double total;
+    unsigned long n_deferred;
+    unsigned char from_snapshot;
+} TableOpenTiming;
+
+// What changed in a table being watched, filled in by table_watcher_wait.
+// Rows first_new_row up to n_rows have been added.
+typedef struct TableChange
+{
+    unsigned long first_new_row;
+    unsigned long n_rows;
+    unsigned char rows_removed;
+    unsigned char table_changed;
+} TableChange;
+
 // Generic callback prototype when handing off owned strings from C++ to Rust.
 // See, e.g., table_get_column_names.
 typedef void (*StringBridgeCallback)(const StringBridge *name, void *ctxt);
@@ -122,13 +148,71 @@ typedef void (*StringBridgeCallback)(const StringBridge *name, void *ctxt);
 typedef void (*KeywordInfoCallback)(const StringBridge *name, GlueDataType dtype, void *ctxt);
 typedef void (*KeywordReprCallback)(const StringBridge *name, GlueDataType dtype, const StringBridge *repr, void *ctxt);
 
+// The Arrow C Data Interface structures, verbatim from the specification at
+// https://arrow.apache.org/docs/format/CDataInterface.html . Arrays exported
+// through table_export_arrow can be handed to any Arrow implementation
+// without copying.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#include <stdint.h>
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
 typedef enum TableOpenMode
 {
     TOM_OPEN_READONLY = 1,
     TOM_OPEN_RW = 2,
     TOM_CREATE = 3,
+    TOM_OPEN_READONLY_DEFERRED = 4,
 } TableOpenMode;
 
+typedef enum TableLockMode
+{
+    TLM_AUTO = 1,
+    TLM_USER = 2,
+    TLM_PERMANENT = 3,
+    TLM_NONE = 4,
+} TableLockMode;
+
 typedef enum TableCreateMode
 {
     // create table
@@ -137,6 +221,8 @@ typedef enum TableCreateMode
     TCM_NEW_NO_REPLACE = 2,
     // New table, which gets marked for delete"
     TCM_SCRATCH = 3,
+    // New table held in memory; the path is only used as its name
+    TCM_MEMORY = 4,
 } TableCreateMode;
 
 /**Different modes for creating a CASA table description.*/
@@ -189,6 +275,18 @@ extern "C"
         void *ctxt,
         ExcInfo &exc
     );
+    // Encode a whole record tree into one buffer, handed to the callback
+    // once. All numbers are in native byte order. A record is a uint32
+    // number of fields, each given as a string name, a uint8 GlueDataType
+    // and its value. A string is a uint32 length and its bytes. An array is
+    // a uint32 number of axes, a uint64 length per axis (in C order) and the
+    // packed elements; a bool takes one byte. A subrecord is encoded as a
+    // record and a subtable as its name.
+    int tablerec_serialize(
+        const GlueTableRecord &rec,
+        StringBridgeCallback callback,
+        void *ctxt,
+        ExcInfo &exc);
     int tablerec_get_field_info(
         const GlueTableRecord &rec,
         const StringBridge &col_name,
@@ -226,6 +324,15 @@ extern "C"
         const unsigned long *dims,
         void *data,
         ExcInfo &exc);
+    int tablerec_remove_field(
+        GlueTableRecord &rec,
+        const StringBridge &field_name,
+        ExcInfo &exc);
+    int tablerec_rename_field(
+        GlueTableRecord &rec,
+        const StringBridge &field_name,
+        const StringBridge &new_name,
+        ExcInfo &exc);
     int tablerec_free(GlueTableRecord *rec, ExcInfo &exc);
 
     // Table Description
@@ -265,6 +372,12 @@ extern "C"
         const StringBridge &col_name,
         const unsigned long n_dims,
         ExcInfo &exc);
+    int tabledesc_set_data_manager(
+        GlueTableDesc &table_desc,
+        const StringBridge &col_name,
+        const StringBridge &dm_type,
+        const StringBridge &dm_group,
+        ExcInfo &exc);
     const GlueTableRecord * tabledesc_get_keywords(GlueTableDesc &table_desc, ExcInfo &exc);
     const GlueTableRecord * tabledesc_get_column_keywords(
         GlueTableDesc &table_desc, const StringBridge &col_name, ExcInfo &exc);
@@ -290,9 +403,34 @@ extern "C"
 
     // Table
 
+    // `dm_specs` maps data manager group names to the specification records
+    // (e.g. COMPRESSLEVEL) of their data managers.
     GlueTable *table_create(const StringBridge &path, GlueTableDesc &table_desc,
-                            unsigned long n_rows, const TableCreateMode mode, ExcInfo &exc);
+                            const GlueTableRecord &dm_specs, unsigned long n_rows,
+                            const TableCreateMode mode, ExcInfo &exc);
+    GlueTable *table_create_multi_file(const StringBridge &path, GlueTableDesc &table_desc,
+                                       const GlueTableRecord &dm_specs,
+                                       unsigned long n_rows, const TableCreateMode mode,
+                                       const unsigned long block_size,
+                                       const unsigned long n_shards, ExcInfo &exc);
+    GlueTable *table_create_big_endian(const StringBridge &path, GlueTableDesc &table_desc,
+                                       const GlueTableRecord &dm_specs,
+                                       unsigned long n_rows, const TableCreateMode mode,
+                                       ExcInfo &exc);
     GlueTable *table_alloc_and_open(const StringBridge &path, const TableOpenMode mode, ExcInfo &exc);
+    GlueTable *table_alloc_and_open_o_direct(const StringBridge &path, const TableOpenMode mode,
+                                             ExcInfo &exc);
+    GlueTable *table_alloc_and_open_locked(const StringBridge &path, const TableOpenMode mode,
+                                           const TableLockMode lock_mode,
+                                           const unsigned char shared_memory, ExcInfo &exc);
+    int table_lock(GlueTable &table, const unsigned char write, const unsigned long n_attempts,
+                   unsigned char *locked, ExcInfo &exc);
+    int table_unlock(GlueTable &table, ExcInfo &exc);
+    int table_has_lock(const GlueTable &table, const unsigned char write,
+                       unsigned char *has_lock, ExcInfo &exc);
+    GlueTable *table_open_subtable(const GlueTable &table, const StringBridge &kw_name,
+                                   const TableOpenMode mode, ExcInfo &exc);
+    int table_get_open_timing(const GlueTable &table, TableOpenTiming *timing, ExcInfo &exc);
     void table_close_and_free(GlueTable *table, ExcInfo &exc);
     unsigned long table_n_rows(const GlueTable &table);
     unsigned long table_n_columns(const GlueTable &table);
@@ -304,6 +442,11 @@ extern "C"
                                void *ctxt, ExcInfo &exc);
     int table_get_column_keyword_info(const GlueTable &table, const StringBridge &col_name,
                                       KeywordInfoCallback callback, void *ctxt, ExcInfo &exc);
+    int table_serialize_keywords(const GlueTable &table, StringBridgeCallback callback,
+                                 void *ctxt, ExcInfo &exc);
+    int table_serialize_column_keywords(const GlueTable &table, const StringBridge *col_names,
+                                        const unsigned long n_cols, StringBridgeCallback callback,
+                                        void *ctxt, ExcInfo &exc);
     const GlueTableRecord *table_get_keywords(GlueTable &table, ExcInfo &exc);
     const GlueTableRecord *table_get_column_keywords(
         GlueTable &table,
@@ -326,6 +469,22 @@ extern "C"
         ExcInfo &exc);
     int table_copy_rows(const GlueTable &source, GlueTable &dest, ExcInfo &exc);
     int table_deep_copy_no_rows(const GlueTable &table, const StringBridge &dest_path, ExcInfo &exc);
+    GlueTable *table_load_memory(const GlueTable &table, const StringBridge &name,
+                                 const StringBridge *col_names, unsigned long n_cols,
+                                 ExcInfo &exc);
+    GlueTable *table_read_ascii(const StringBridge &data_path, const StringBridge &table_path,
+                                const char separator, const StringBridge &comment_marker,
+                                const unsigned long n_threads, const unsigned long chunk_size,
+                                const int in_memory, ExcInfo &exc);
+    int table_trace_set_metrics(const unsigned char enable, ExcInfo &exc);
+    GlueTableRecord *table_trace_get_metrics(ExcInfo &exc);
+    int table_trace_reset_metrics(ExcInfo &exc);
+    GlueTableRecord *table_get_cache_statistics(const GlueTable &table, ExcInfo &exc);
+    int table_set_cache_budget(const unsigned long n_bytes, ExcInfo &exc);
+    int table_set_array_file_cache_size(const unsigned long n_bytes, ExcInfo &exc);
+    int table_vacuum(GlueTable &table, unsigned long *n_bytes, ExcInfo &exc);
+    int table_write_snapshot(GlueTable &table, int *written, ExcInfo &exc);
+    int table_remove_snapshot(GlueTable &table, int *removed, ExcInfo &exc);
     int table_get_column_info(const GlueTable &table, const StringBridge &col_name,
                               unsigned long *n_rows, GlueDataType *data_type,
                               int *is_scalar, int *is_fixed_shape, int *n_dim,
@@ -343,9 +502,21 @@ extern "C"
     int table_get_scalar_column_data_string(const GlueTable &table, const StringBridge &col_name,
                                             StringBridgeCallback callback, void *ctxt,
                                             ExcInfo &exc);
+    // Read `n_rows` rows of a fixed-shape array column. If `slice_start` is
+    // not NULL, only the section of each cell given by it and `slice_length`
+    // (both in C order) is read.
+    int table_get_array_column_data(const GlueTable &table, const StringBridge &col_name,
+                                    const unsigned long row_start, const unsigned long n_rows,
+                                    const unsigned long n_dims,
+                                    const unsigned long *slice_start,
+                                    const unsigned long *slice_length, void *data,
+                                    ExcInfo &exc);
     int table_get_cell_info(const GlueTable &table, const StringBridge &col_name,
                             unsigned long row_number, GlueDataType *data_type,
                             int *n_dim, unsigned long dims[8], ExcInfo &exc);
+    int table_get_cell_shapes(const GlueTable &table, const StringBridge &col_name,
+                              const unsigned long start_row, const unsigned long n_rows,
+                              int *n_dims, unsigned long *dims, ExcInfo &exc);
     int table_get_cell(const GlueTable &table, const StringBridge &col_name,
                        const unsigned long row_number, void *data, ExcInfo &exc);
     int table_get_cell_string(const GlueTable &table, const StringBridge &col_name,
@@ -359,8 +530,34 @@ extern "C"
                        const unsigned long n_dims, const unsigned long *dims,
                        void *data, ExcInfo &exc);
     int table_add_rows(GlueTable &table, const unsigned long n_rows, ExcInfo &exc);
+    int table_remove_rows(GlueTable &table, const unsigned long *row_numbers,
+                          const unsigned long n_rows, ExcInfo &exc);
+    int table_flush(GlueTable &table, const unsigned char fsync, ExcInfo &exc);
+    GlueTable *table_sort(const GlueTable &table, const StringBridge *col_names,
+                          const unsigned char *descending, const unsigned long n_keys,
+                          ExcInfo &exc);
+    GlueTable *table_select_rows(const GlueTable &table, const unsigned long *row_numbers,
+                                 const unsigned long n_rows, ExcInfo &exc);
+    GlueTable *table_concat(const GlueTable *const *tables, const unsigned long n_tables,
+                            ExcInfo &exc);
+    int table_set_concat_max_threads(const unsigned long n_threads, ExcInfo &exc);
+    int table_sort_groups(const GlueTable &table, const StringBridge *col_names,
+                          const unsigned long n_keys, unsigned long *row_numbers,
+                          unsigned long *boundaries, unsigned long *n_groups,
+                          ExcInfo &exc);
+    int table_export_arrow(const GlueTable &table, const StringBridge *col_names,
+                           const unsigned long n_cols, const unsigned long row_start,
+                           const unsigned long n_rows, struct ArrowArray *array,
+                           struct ArrowSchema *schema, ExcInfo &exc);
+    int table_export_columnar(const GlueTable &table, const StringBridge &path,
+                              const StringBridge *col_names, const unsigned long n_cols,
+                              const unsigned char *codecs, const unsigned long rows_per_group,
+                              const unsigned long n_threads, unsigned long *n_row_groups,
+                              ExcInfo &exc);
 
     GlueTableRow *table_row_alloc(const GlueTable &table, const unsigned char is_read_only, ExcInfo &exc);
+    GlueTableRow *table_row_alloc_columns(const GlueTable &table, const StringBridge *col_names,
+                                          const unsigned long n_cols, ExcInfo &exc);
     int table_row_free(GlueTableRow *row, ExcInfo &exc);
     int table_row_read(GlueTableRow &row, const unsigned long row_number, ExcInfo &exc);
     int table_row_copy_and_put(GlueTableRow &src_row, const unsigned long dest_row_number,
@@ -380,4 +577,26 @@ extern "C"
                            const GlueDataType data_type, const unsigned long n_dims,
                            const unsigned long *dims, void *data, ExcInfo &exc);
     int table_row_write(GlueTableRow &row, const unsigned long dest_row_number, ExcInfo &exc);
+
+    GlueRowGroupReader *row_group_reader_alloc(const GlueTable &table, const StringBridge *col_names,
+                                               const unsigned long n_cols, const unsigned long block_rows,
+                                               const unsigned char prefetch, ExcInfo &exc);
+    int row_group_reader_free(GlueRowGroupReader *reader, ExcInfo &exc);
+    int row_group_reader_next(GlueRowGroupReader &reader, unsigned long *block_start,
+                              unsigned long *n_rows, ExcInfo &exc);
+    int row_group_reader_get_column_info(const GlueRowGroupReader &reader, const unsigned long col_index,
+                                         GlueDataType *data_type, int *n_dim,
+                                         unsigned long dims[8], ExcInfo &exc);
+    int row_group_reader_get_column_data(const GlueRowGroupReader &reader, const unsigned long col_index,
+                                         const void **data, ExcInfo &exc);
+    int row_group_reader_get_column_strings(const GlueRowGroupReader &reader, const unsigned long col_index,
+                                            StringBridgeCallback callback, void *ctxt, ExcInfo &exc);
+
+    GlueTableWatcher *table_watcher_alloc(const GlueTable &table, const double poll_interval,
+                                          ExcInfo &exc);
+    int table_watcher_free(GlueTableWatcher *watcher, ExcInfo &exc);
+    int table_watcher_wait(GlueTableWatcher &watcher, const double timeout, unsigned char *changed,
+                           TableChange *change, ExcInfo &exc);
+    int table_watcher_get_changed_columns(const GlueTableWatcher &watcher, StringBridgeCallback callback,
+                                          void *ctxt, ExcInfo &exc);
 }
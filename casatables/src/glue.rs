@@ -1,6 +1,9 @@
 #![allow(non_camel_case_types, non_snake_case, unused)]
 /* automatically generated by rust-bindgen 0.69.4 */
 
+pub const ARROW_FLAG_DICTIONARY_ORDERED: u32 = 1;
+pub const ARROW_FLAG_NULLABLE: u32 = 2;
+pub const ARROW_FLAG_MAP_KEYS_SORTED: u32 = 4;
 #[repr(u32)]
 #[doc = "Different data types supported by the CASA tables format."]
 #[derive(Debug, Copy, Clone, Hash, PartialEq, Eq)]
@@ -90,6 +93,16 @@ pub struct GlueTableRecord {
 }
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
+pub struct GlueRowGroupReader {
+    _unused: [u8; 0],
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct GlueTableWatcher {
+    _unused: [u8; 0],
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
 pub struct StringBridge {
     pub data: *const ::std::os::raw::c_void,
     pub n_bytes: ::std::os::raw::c_ulong,
@@ -159,6 +172,176 @@ fn bindgen_test_layout_ExcInfo() {
         )
     );
 }
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct TableOpenTiming {
+    pub lock: f64,
+    pub description: f64,
+    pub columns: f64,
+    pub data_managers: f64,
+    pub info: f64,
+    pub total: f64,
+    pub n_deferred: ::std::os::raw::c_ulong,
+    pub from_snapshot: ::std::os::raw::c_uchar,
+}
+#[test]
+fn bindgen_test_layout_TableOpenTiming() {
+    const UNINIT: ::std::mem::MaybeUninit<TableOpenTiming> = ::std::mem::MaybeUninit::uninit();
+    let ptr = UNINIT.as_ptr();
+    assert_eq!(
+        ::std::mem::size_of::<TableOpenTiming>(),
+        64usize,
+        concat!("Size of: ", stringify!(TableOpenTiming))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<TableOpenTiming>(),
+        8usize,
+        concat!("Alignment of ", stringify!(TableOpenTiming))
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).lock) as usize - ptr as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(lock)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).description) as usize - ptr as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(description)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).columns) as usize - ptr as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(columns)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).data_managers) as usize - ptr as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(data_managers)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).info) as usize - ptr as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(info)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).total) as usize - ptr as usize },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(total)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).n_deferred) as usize - ptr as usize },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(n_deferred)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).from_snapshot) as usize - ptr as usize },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableOpenTiming),
+            "::",
+            stringify!(from_snapshot)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct TableChange {
+    pub first_new_row: ::std::os::raw::c_ulong,
+    pub n_rows: ::std::os::raw::c_ulong,
+    pub rows_removed: ::std::os::raw::c_uchar,
+    pub table_changed: ::std::os::raw::c_uchar,
+}
+#[test]
+fn bindgen_test_layout_TableChange() {
+    const UNINIT: ::std::mem::MaybeUninit<TableChange> = ::std::mem::MaybeUninit::uninit();
+    let ptr = UNINIT.as_ptr();
+    assert_eq!(
+        ::std::mem::size_of::<TableChange>(),
+        24usize,
+        concat!("Size of: ", stringify!(TableChange))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<TableChange>(),
+        8usize,
+        concat!("Alignment of ", stringify!(TableChange))
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).first_new_row) as usize - ptr as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableChange),
+            "::",
+            stringify!(first_new_row)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).n_rows) as usize - ptr as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableChange),
+            "::",
+            stringify!(n_rows)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).rows_removed) as usize - ptr as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableChange),
+            "::",
+            stringify!(rows_removed)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).table_changed) as usize - ptr as usize },
+        17usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(TableChange),
+            "::",
+            stringify!(table_changed)
+        )
+    );
+}
 pub type StringBridgeCallback = ::std::option::Option<
     unsafe extern "C" fn(name: *const StringBridge, ctxt: *mut ::std::os::raw::c_void),
 >;
@@ -177,12 +360,268 @@ pub type KeywordReprCallback = ::std::option::Option<
         ctxt: *mut ::std::os::raw::c_void,
     ),
 >;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct ArrowSchema {
+    pub format: *const ::std::os::raw::c_char,
+    pub name: *const ::std::os::raw::c_char,
+    pub metadata: *const ::std::os::raw::c_char,
+    pub flags: i64,
+    pub n_children: i64,
+    pub children: *mut *mut ArrowSchema,
+    pub dictionary: *mut ArrowSchema,
+    pub release: ::std::option::Option<unsafe extern "C" fn(arg1: *mut ArrowSchema)>,
+    pub private_data: *mut ::std::os::raw::c_void,
+}
+#[test]
+fn bindgen_test_layout_ArrowSchema() {
+    const UNINIT: ::std::mem::MaybeUninit<ArrowSchema> = ::std::mem::MaybeUninit::uninit();
+    let ptr = UNINIT.as_ptr();
+    assert_eq!(
+        ::std::mem::size_of::<ArrowSchema>(),
+        72usize,
+        concat!("Size of: ", stringify!(ArrowSchema))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<ArrowSchema>(),
+        8usize,
+        concat!("Alignment of ", stringify!(ArrowSchema))
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).format) as usize - ptr as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(format)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).name) as usize - ptr as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(name)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).metadata) as usize - ptr as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(metadata)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).flags) as usize - ptr as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(flags)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).n_children) as usize - ptr as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(n_children)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).children) as usize - ptr as usize },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(children)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).dictionary) as usize - ptr as usize },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(dictionary)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).release) as usize - ptr as usize },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(release)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).private_data) as usize - ptr as usize },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowSchema),
+            "::",
+            stringify!(private_data)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct ArrowArray {
+    pub length: i64,
+    pub null_count: i64,
+    pub offset: i64,
+    pub n_buffers: i64,
+    pub n_children: i64,
+    pub buffers: *mut *const ::std::os::raw::c_void,
+    pub children: *mut *mut ArrowArray,
+    pub dictionary: *mut ArrowArray,
+    pub release: ::std::option::Option<unsafe extern "C" fn(arg1: *mut ArrowArray)>,
+    pub private_data: *mut ::std::os::raw::c_void,
+}
+#[test]
+fn bindgen_test_layout_ArrowArray() {
+    const UNINIT: ::std::mem::MaybeUninit<ArrowArray> = ::std::mem::MaybeUninit::uninit();
+    let ptr = UNINIT.as_ptr();
+    assert_eq!(
+        ::std::mem::size_of::<ArrowArray>(),
+        80usize,
+        concat!("Size of: ", stringify!(ArrowArray))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<ArrowArray>(),
+        8usize,
+        concat!("Alignment of ", stringify!(ArrowArray))
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).length) as usize - ptr as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(length)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).null_count) as usize - ptr as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(null_count)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).offset) as usize - ptr as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(offset)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).n_buffers) as usize - ptr as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(n_buffers)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).n_children) as usize - ptr as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(n_children)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).buffers) as usize - ptr as usize },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(buffers)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).children) as usize - ptr as usize },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(children)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).dictionary) as usize - ptr as usize },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(dictionary)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).release) as usize - ptr as usize },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(release)
+        )
+    );
+    assert_eq!(
+        unsafe { ::std::ptr::addr_of!((*ptr).private_data) as usize - ptr as usize },
+        72usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ArrowArray),
+            "::",
+            stringify!(private_data)
+        )
+    );
+}
 #[repr(u32)]
 #[derive(Debug, Copy, Clone, Hash, PartialEq, Eq)]
 pub enum TableOpenMode {
     TOM_OPEN_READONLY = 1,
     TOM_OPEN_RW = 2,
     TOM_CREATE = 3,
+    TOM_OPEN_READONLY_DEFERRED = 4,
+}
+#[repr(u32)]
+#[derive(Debug, Copy, Clone, Hash, PartialEq, Eq)]
+pub enum TableLockMode {
+    TLM_AUTO = 1,
+    TLM_USER = 2,
+    TLM_PERMANENT = 3,
+    TLM_NONE = 4,
 }
 #[repr(u32)]
 #[derive(Debug, Copy, Clone, Hash, PartialEq, Eq)]
@@ -190,6 +629,7 @@ pub enum TableCreateMode {
     TCM_NEW = 1,
     TCM_NEW_NO_REPLACE = 2,
     TCM_SCRATCH = 3,
+    TCM_MEMORY = 4,
 }
 #[repr(u32)]
 #[doc = "Different modes for creating a CASA table description."]
@@ -232,6 +672,14 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn tablerec_serialize(
+        rec: *const GlueTableRecord,
+        callback: StringBridgeCallback,
+        ctxt: *mut ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn tablerec_get_field_info(
         rec: *const GlueTableRecord,
@@ -287,6 +735,21 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn tablerec_remove_field(
+        rec: *mut GlueTableRecord,
+        field_name: *const StringBridge,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn tablerec_rename_field(
+        rec: *mut GlueTableRecord,
+        field_name: *const StringBridge,
+        new_name: *const StringBridge,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn tablerec_free(rec: *mut GlueTableRecord, exc: *mut ExcInfo) -> ::std::os::raw::c_int;
 }
@@ -340,6 +803,15 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn tabledesc_set_data_manager(
+        table_desc: *mut GlueTableDesc,
+        col_name: *const StringBridge,
+        dm_type: *const StringBridge,
+        dm_group: *const StringBridge,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn tabledesc_get_keywords(
         table_desc: *mut GlueTableDesc,
@@ -380,6 +852,29 @@ extern "C" {
     pub fn table_create(
         path: *const StringBridge,
         table_desc: *mut GlueTableDesc,
+        dm_specs: *const GlueTableRecord,
+        n_rows: ::std::os::raw::c_ulong,
+        mode: TableCreateMode,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_create_multi_file(
+        path: *const StringBridge,
+        table_desc: *mut GlueTableDesc,
+        dm_specs: *const GlueTableRecord,
+        n_rows: ::std::os::raw::c_ulong,
+        mode: TableCreateMode,
+        block_size: ::std::os::raw::c_ulong,
+        n_shards: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_create_big_endian(
+        path: *const StringBridge,
+        table_desc: *mut GlueTableDesc,
+        dm_specs: *const GlueTableRecord,
         n_rows: ::std::os::raw::c_ulong,
         mode: TableCreateMode,
         exc: *mut ExcInfo,
@@ -392,6 +887,57 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> *mut GlueTable;
 }
+extern "C" {
+    pub fn table_alloc_and_open_o_direct(
+        path: *const StringBridge,
+        mode: TableOpenMode,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_alloc_and_open_locked(
+        path: *const StringBridge,
+        mode: TableOpenMode,
+        lock_mode: TableLockMode,
+        shared_memory: ::std::os::raw::c_uchar,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_lock(
+        table: *mut GlueTable,
+        write: ::std::os::raw::c_uchar,
+        n_attempts: ::std::os::raw::c_ulong,
+        locked: *mut ::std::os::raw::c_uchar,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_unlock(table: *mut GlueTable, exc: *mut ExcInfo) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_has_lock(
+        table: *const GlueTable,
+        write: ::std::os::raw::c_uchar,
+        has_lock: *mut ::std::os::raw::c_uchar,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_open_subtable(
+        table: *const GlueTable,
+        kw_name: *const StringBridge,
+        mode: TableOpenMode,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_get_open_timing(
+        table: *const GlueTable,
+        timing: *mut TableOpenTiming,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn table_close_and_free(table: *mut GlueTable, exc: *mut ExcInfo);
 }
@@ -437,6 +983,24 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn table_serialize_keywords(
+        table: *const GlueTable,
+        callback: StringBridgeCallback,
+        ctxt: *mut ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_serialize_column_keywords(
+        table: *const GlueTable,
+        col_names: *const StringBridge,
+        n_cols: ::std::os::raw::c_ulong,
+        callback: StringBridgeCallback,
+        ctxt: *mut ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn table_get_keywords(table: *mut GlueTable, exc: *mut ExcInfo) -> *const GlueTableRecord;
 }
@@ -484,6 +1048,78 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn table_load_memory(
+        table: *const GlueTable,
+        name: *const StringBridge,
+        col_names: *const StringBridge,
+        n_cols: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_read_ascii(
+        data_path: *const StringBridge,
+        table_path: *const StringBridge,
+        separator: ::std::os::raw::c_char,
+        comment_marker: *const StringBridge,
+        n_threads: ::std::os::raw::c_ulong,
+        chunk_size: ::std::os::raw::c_ulong,
+        in_memory: ::std::os::raw::c_int,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_trace_set_metrics(
+        enable: ::std::os::raw::c_uchar,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_trace_get_metrics(exc: *mut ExcInfo) -> *mut GlueTableRecord;
+}
+extern "C" {
+    pub fn table_trace_reset_metrics(exc: *mut ExcInfo) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_get_cache_statistics(
+        table: *const GlueTable,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTableRecord;
+}
+extern "C" {
+    pub fn table_set_cache_budget(
+        n_bytes: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_set_array_file_cache_size(
+        n_bytes: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_vacuum(
+        table: *mut GlueTable,
+        n_bytes: *mut ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_write_snapshot(
+        table: *mut GlueTable,
+        written: *mut ::std::os::raw::c_int,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_remove_snapshot(
+        table: *mut GlueTable,
+        removed: *mut ::std::os::raw::c_int,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn table_get_column_info(
         table: *const GlueTable,
@@ -556,6 +1192,19 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn table_get_array_column_data(
+        table: *const GlueTable,
+        col_name: *const StringBridge,
+        row_start: ::std::os::raw::c_ulong,
+        n_rows: ::std::os::raw::c_ulong,
+        n_dims: ::std::os::raw::c_ulong,
+        slice_start: *const ::std::os::raw::c_ulong,
+        slice_length: *const ::std::os::raw::c_ulong,
+        data: *mut ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn table_get_cell_info(
         table: *const GlueTable,
@@ -567,6 +1216,17 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn table_get_cell_shapes(
+        table: *const GlueTable,
+        col_name: *const StringBridge,
+        start_row: ::std::os::raw::c_ulong,
+        n_rows: ::std::os::raw::c_ulong,
+        n_dims: *mut ::std::os::raw::c_int,
+        dims: *mut ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn table_get_cell(
         table: *const GlueTable,
@@ -615,6 +1275,87 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn table_remove_rows(
+        table: *mut GlueTable,
+        row_numbers: *const ::std::os::raw::c_ulong,
+        n_rows: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_flush(
+        table: *mut GlueTable,
+        fsync: ::std::os::raw::c_uchar,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_sort(
+        table: *const GlueTable,
+        col_names: *const StringBridge,
+        descending: *const ::std::os::raw::c_uchar,
+        n_keys: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_select_rows(
+        table: *const GlueTable,
+        row_numbers: *const ::std::os::raw::c_ulong,
+        n_rows: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_concat(
+        tables: *const *const GlueTable,
+        n_tables: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTable;
+}
+extern "C" {
+    pub fn table_set_concat_max_threads(
+        n_threads: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_sort_groups(
+        table: *const GlueTable,
+        col_names: *const StringBridge,
+        n_keys: ::std::os::raw::c_ulong,
+        row_numbers: *mut ::std::os::raw::c_ulong,
+        boundaries: *mut ::std::os::raw::c_ulong,
+        n_groups: *mut ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_export_arrow(
+        table: *const GlueTable,
+        col_names: *const StringBridge,
+        n_cols: ::std::os::raw::c_ulong,
+        row_start: ::std::os::raw::c_ulong,
+        n_rows: ::std::os::raw::c_ulong,
+        array: *mut ArrowArray,
+        schema: *mut ArrowSchema,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_export_columnar(
+        table: *const GlueTable,
+        path: *const StringBridge,
+        col_names: *const StringBridge,
+        n_cols: ::std::os::raw::c_ulong,
+        codecs: *const ::std::os::raw::c_uchar,
+        rows_per_group: ::std::os::raw::c_ulong,
+        n_threads: ::std::os::raw::c_ulong,
+        n_row_groups: *mut ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn table_row_alloc(
         table: *const GlueTable,
@@ -622,6 +1363,14 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> *mut GlueTableRow;
 }
+extern "C" {
+    pub fn table_row_alloc_columns(
+        table: *const GlueTable,
+        col_names: *const StringBridge,
+        n_cols: ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTableRow;
+}
 extern "C" {
     pub fn table_row_free(row: *mut GlueTableRow, exc: *mut ExcInfo) -> ::std::os::raw::c_int;
 }
@@ -694,3 +1443,84 @@ extern "C" {
         exc: *mut ExcInfo,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn row_group_reader_alloc(
+        table: *const GlueTable,
+        col_names: *const StringBridge,
+        n_cols: ::std::os::raw::c_ulong,
+        block_rows: ::std::os::raw::c_ulong,
+        prefetch: ::std::os::raw::c_uchar,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueRowGroupReader;
+}
+extern "C" {
+    pub fn row_group_reader_free(
+        reader: *mut GlueRowGroupReader,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn row_group_reader_next(
+        reader: *mut GlueRowGroupReader,
+        block_start: *mut ::std::os::raw::c_ulong,
+        n_rows: *mut ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn row_group_reader_get_column_info(
+        reader: *const GlueRowGroupReader,
+        col_index: ::std::os::raw::c_ulong,
+        data_type: *mut GlueDataType,
+        n_dim: *mut ::std::os::raw::c_int,
+        dims: *mut ::std::os::raw::c_ulong,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn row_group_reader_get_column_data(
+        reader: *const GlueRowGroupReader,
+        col_index: ::std::os::raw::c_ulong,
+        data: *mut *const ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn row_group_reader_get_column_strings(
+        reader: *const GlueRowGroupReader,
+        col_index: ::std::os::raw::c_ulong,
+        callback: StringBridgeCallback,
+        ctxt: *mut ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_watcher_alloc(
+        table: *const GlueTable,
+        poll_interval: f64,
+        exc: *mut ExcInfo,
+    ) -> *mut GlueTableWatcher;
+}
+extern "C" {
+    pub fn table_watcher_free(
+        watcher: *mut GlueTableWatcher,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_watcher_wait(
+        watcher: *mut GlueTableWatcher,
+        timeout: f64,
+        changed: *mut ::std::os::raw::c_uchar,
+        change: *mut TableChange,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn table_watcher_get_changed_columns(
+        watcher: *const GlueTableWatcher,
+        callback: StringBridgeCallback,
+        ctxt: *mut ::std::os::raw::c_void,
+        exc: *mut ExcInfo,
+    ) -> ::std::os::raw::c_int;
+}
@@ -1,10 +1,12 @@
 // Copyright 2017-2021 Peter Williams <peter@newton.cx> and collaborators
 // Licensed under the MIT License.
 
-use std::{env, fs, path::PathBuf};
+use std::{env, fs, path::PathBuf, process::Command};
 
 fn main() {
-    cc::Build::new()
+    let mut build = cc::Build::new();
+
+    build
         .cpp(true)
         .warnings(true)
         .flag_if_supported("-std=c++11")
@@ -17,8 +19,33 @@ fn main() {
         // Without this, using casa in multiple threads causes segfaults
         .define("USE_THREADS", "1")
         .include(".")
-        .files(FILES)
-        .compile("libcasatables_impl.a");
+        .files(FILES);
+
+    // Let the bucket files be opened with O_DIRECT if asked for.
+    if env::var("CARGO_CFG_TARGET_OS").as_deref() == Ok("linux") {
+        build.define("HAVE_O_DIRECT", "1");
+    }
+
+    // With the `hdf5` feature, build the HDF5 support (HDF5StMan and
+    // MultiHDF5). Otherwise those classes throw an exception when used.
+    let hdf5 = if env::var_os("CARGO_FEATURE_HDF5").is_some() {
+        let hdf5 = find_hdf5();
+        build.define("HAVE_HDF5", "1").includes(&hdf5.include_dirs);
+        Some(hdf5)
+    } else {
+        None
+    };
+
+    build.compile("libcasatables_impl.a");
+
+    if let Some(hdf5) = hdf5 {
+        for dir in &hdf5.lib_dirs {
+            println!("cargo:rustc-link-search=native={}", dir.display());
+        }
+        println!("cargo:rustc-link-lib=hdf5");
+        // HDF5StMan inflates the deflated chunks itself.
+        println!("cargo:rustc-link-lib=z");
+    }
 
     for file in FILES {
         println!("cargo:rerun-if-changed={}", file);
@@ -43,6 +70,46 @@ fn main() {
     println!("cargo:include={}/include", dst.to_str().unwrap());
 }
 
+/// The locations of the HDF5 headers and libraries.
+struct Hdf5Dirs {
+    include_dirs: Vec<PathBuf>,
+    lib_dirs: Vec<PathBuf>,
+}
+
+/// Find HDF5 in `$HDF5_DIR` if set, otherwise by using pkg-config.
+fn find_hdf5() -> Hdf5Dirs {
+    println!("cargo:rerun-if-env-changed=HDF5_DIR");
+
+    if let Some(dir) = env::var_os("HDF5_DIR") {
+        let dir = PathBuf::from(dir);
+        return Hdf5Dirs {
+            include_dirs: vec![dir.join("include")],
+            lib_dirs: vec![dir.join("lib")],
+        };
+    }
+
+    let output = Command::new("pkg-config")
+        .args(["--cflags-only-I", "--libs-only-L", "hdf5"])
+        .output()
+        .ok()
+        .filter(|o| o.status.success())
+        .expect("the `hdf5` feature needs HDF5: set $HDF5_DIR or make it known to pkg-config");
+    let mut dirs = Hdf5Dirs {
+        include_dirs: Vec::new(),
+        lib_dirs: Vec::new(),
+    };
+
+    for flag in String::from_utf8_lossy(&output.stdout).split_whitespace() {
+        if let Some(dir) = flag.strip_prefix("-I") {
+            dirs.include_dirs.push(dir.into());
+        } else if let Some(dir) = flag.strip_prefix("-L") {
+            dirs.lib_dirs.push(dir.into());
+        }
+    }
+
+    dirs
+}
+
 const FILES: &[&str] = &[
     "casacore/casa/Arrays/Array2.cc",
     "casacore/casa/Arrays/Array2Math.cc",
@@ -98,7 +165,9 @@ const FILES: &[&str] = &[
     "casacore/casa/HDF5/HDF5Object.cc",
     "casacore/casa/HDF5/HDF5Record.cc",
     "casacore/casa/IO/AipsIO.cc",
+    "casacore/casa/IO/AlignedBufferPool.cc",
     "casacore/casa/IO/BaseSinkSource.cc",
+    "casacore/casa/IO/BlockCacheIO.cc",
     "casacore/casa/IO/BucketBase.cc",
     "casacore/casa/IO/BucketBuffered.cc",
     "casacore/casa/IO/BucketCache.cc",
@@ -124,6 +193,7 @@ const FILES: &[&str] = &[
     "casacore/casa/IO/MultiHDF5.cc",
     "casacore/casa/IO/RawIO.cc",
     "casacore/casa/IO/RegularFileIO.cc",
+    "casacore/casa/IO/SharedMemoryLock.cc",
     "casacore/casa/IO/StreamIO.cc",
     "casacore/casa/IO/TapeIO.cc",
     "casacore/casa/IO/TypeIO.cc",
@@ -158,6 +228,7 @@ const FILES: &[&str] = &[
     "casacore/casa/OS/MemoryTrace.cc",
     "casacore/casa/OS/ModcompConversion.cc",
     "casacore/casa/OS/ModcompDataConversion.cc",
+    "casacore/casa/OS/ParallelJobs.cc",
     "casacore/casa/OS/Path.cc",
     "casacore/casa/OS/PrecTimer.cc",
     "casacore/casa/OS/RawDataConversion.cc",
@@ -242,6 +313,8 @@ const FILES: &[&str] = &[
     "casacore/tables/DataMan/DataManInfo.cc",
     "casacore/tables/DataMan/ForwardCol.cc",
     "casacore/tables/DataMan/ForwardColRow.cc",
+    "casacore/tables/DataMan/HDF5StMan.cc",
+    "casacore/tables/DataMan/HDF5StManColumn.cc",
     "casacore/tables/DataMan/IncrementalStMan.cc",
     "casacore/tables/DataMan/IncrStManAccessor.cc",
     "casacore/tables/DataMan/ISMBase.cc",
@@ -302,6 +375,7 @@ const FILES: &[&str] = &[
     "casacore/tables/Tables/BaseTabIter.cc",
     "casacore/tables/Tables/BaseTable.cc",
     "casacore/tables/Tables/ColDescSet.cc",
+    "casacore/tables/Tables/ColumnarExporter.cc",
     "casacore/tables/Tables/ColumnCache.cc",
     "casacore/tables/Tables/ColumnDesc.cc",
     "casacore/tables/Tables/ColumnSet.cc",
@@ -320,6 +394,7 @@ const FILES: &[&str] = &[
     "casacore/tables/Tables/RefRows.cc",
     "casacore/tables/Tables/RefTable.cc",
     "casacore/tables/Tables/RowCopier.cc",
+    "casacore/tables/Tables/RowGroupReader.cc",
     "casacore/tables/Tables/RowNumbers.cc",
     "casacore/tables/Tables/ScaColDesc_tmpl.cc",
     "casacore/tables/Tables/ScalarColumn_tmpl.cc",
@@ -344,8 +419,10 @@ const FILES: &[&str] = &[
     "casacore/tables/Tables/TableRecord.cc",
     "casacore/tables/Tables/TableRecordRep.cc",
     "casacore/tables/Tables/TableRow.cc",
+    "casacore/tables/Tables/TableSnapshot.cc",
     "casacore/tables/Tables/TableSyncData.cc",
     "casacore/tables/Tables/TableTrace.cc",
+    "casacore/tables/Tables/TableWatcher.cc",
     "casacore/tables/Tables/TabPath.cc",
 ];
 
@@ -477,7 +554,9 @@ const HEADERS: &[&str] = &[
     "casacore/casa/IO/AipsIOCarray.h",
     "casacore/casa/IO/AipsIOCarray.tcc",
     "casacore/casa/IO/AipsIO.h",
+    "casacore/casa/IO/AlignedBufferPool.h",
     "casacore/casa/IO/BaseSinkSource.h",
+    "casacore/casa/IO/BlockCacheIO.h",
     "casacore/casa/IO/BucketBase.h",
     "casacore/casa/IO/BucketBuffered.h",
     "casacore/casa/IO/BucketCache.h",
@@ -506,6 +585,7 @@ const HEADERS: &[&str] = &[
     "casacore/casa/IO/MultiHDF5.h",
     "casacore/casa/IO/RawIO.h",
     "casacore/casa/IO/RegularFileIO.h",
+    "casacore/casa/IO/SharedMemoryLock.h",
     "casacore/casa/iosfwd.h",
     "casacore/casa/iosstrfwd.h",
     "casacore/casa/iostream.h",
@@ -557,6 +637,7 @@ const HEADERS: &[&str] = &[
     "casacore/casa/OS/ModcompConversion.h",
     "casacore/casa/OS/ModcompDataConversion.h",
     "casacore/casa/OS/Mutex.h",
+    "casacore/casa/OS/ParallelJobs.h",
     "casacore/casa/OS/Path.h",
     "casacore/casa/OS/PrecTimer.h",
     "casacore/casa/OS/RawDataConversion.h",
@@ -680,6 +761,8 @@ const HEADERS: &[&str] = &[
     "casacore/tables/DataMan/DataManInfo.h",
     "casacore/tables/DataMan/ForwardCol.h",
     "casacore/tables/DataMan/ForwardColRow.h",
+    "casacore/tables/DataMan/HDF5StMan.h",
+    "casacore/tables/DataMan/HDF5StManColumn.h",
     "casacore/tables/DataMan.h",
     "casacore/tables/DataMan/IncrementalStMan.h",
     "casacore/tables/DataMan/IncrStManAccessor.h",
@@ -761,6 +844,7 @@ const HEADERS: &[&str] = &[
     "casacore/tables/Tables/BaseTabIter.h",
     "casacore/tables/Tables/BaseTable.h",
     "casacore/tables/Tables/ColDescSet.h",
+    "casacore/tables/Tables/ColumnarExporter.h",
     "casacore/tables/Tables/ColumnCache.h",
     "casacore/tables/Tables/ColumnDesc.h",
     "casacore/tables/Tables/ColumnSet.h",
@@ -782,6 +866,7 @@ const HEADERS: &[&str] = &[
     "casacore/tables/Tables/RefRows.h",
     "casacore/tables/Tables/RefTable.h",
     "casacore/tables/Tables/RowCopier.h",
+    "casacore/tables/Tables/RowGroupReader.h",
     "casacore/tables/Tables/RowNumbers.h",
     "casacore/tables/Tables/ScaColData.h",
     "casacore/tables/Tables/ScaColData.tcc",
@@ -811,11 +896,13 @@ const HEADERS: &[&str] = &[
     "casacore/tables/Tables/TableRecord.h",
     "casacore/tables/Tables/TableRecordRep.h",
     "casacore/tables/Tables/TableRow.h",
+    "casacore/tables/Tables/TableSnapshot.h",
     "casacore/tables/Tables/TableSyncData.h",
     "casacore/tables/Tables/TableTrace.h",
     "casacore/tables/Tables/TableUtil.h",
     "casacore/tables/Tables/TableVector.h",
     "casacore/tables/Tables/TableVector.tcc",
+    "casacore/tables/Tables/TableWatcher.h",
     "casacore/tables/Tables/TabPath.h",
     "casacore/tables/Tables/TabVecLogic.h",
     "casacore/tables/Tables/TabVecLogic.tcc",
@@ -178,6 +178,14 @@ Int Record::fieldNumber (const String& fieldName) const
 {
     return description().fieldNumber (fieldName);
 }
+Int Record::fieldNumber (const String& fieldName, Int hint) const
+{
+    return description().fieldNumber (fieldName, hint);
+}
+uInt64 Record::descriptionId() const
+{
+    return description().layoutId();
+}
 DataType Record::type (Int whichField) const
 {
     return description().type (whichField);
@@ -292,6 +292,12 @@ public:
     // -1 is returned if the field name is unknown.
     virtual Int fieldNumber (const String& fieldName) const;
 
+    // Get the field number from the field name, testing field hint first.
+    virtual Int fieldNumber (const String& fieldName, Int hint) const;
+
+    // Get the layout id of the description.
+    virtual uInt64 descriptionId() const;
+
     // Get the data type of this field.
     virtual DataType type (Int whichField) const;
 
@@ -192,6 +192,15 @@ public:
     // does not exist.
     Int fieldNumber (const String& fieldName) const;
 
+    // Same as above, but first test if field <src>hint</src> has the name.
+    // It is faster if the caller knows the field number is likely the same
+    // as in a similar record.
+    Int fieldNumber (const String& fieldName, Int hint) const;
+
+    // Get the identity of the field names and their order.
+    // Descriptions with equal layout ids map names to the same field numbers.
+    uInt64 layoutId() const;
+
     // Number of fields in the description.
     uInt nfields() const;
 
@@ -388,6 +397,15 @@ inline Int RecordDesc::fieldNumber (const String& fieldName) const
 {
     return desc_p.ref().fieldNumber (fieldName);
 }
+inline Int RecordDesc::fieldNumber (const String& fieldName, Int hint) const
+{
+    return desc_p.ref().fieldNumber (fieldName, hint);
+}
+
+inline uInt64 RecordDesc::layoutId() const
+{
+    return desc_p.ref().layoutId();
+}
 
 inline uInt RecordDesc::nfields() const
 {
@@ -33,6 +33,7 @@
 
 #include <casacore/casa/stdio.h>
 #include <casacore/casa/iostream.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -46,7 +47,7 @@ RecordDescRep::RecordDescRep()
   tableDescNames_p(0),
   comments_p(0)
 {
-    // Nothing
+    newLayout();
 }
 
 RecordDescRep::RecordDescRep (const RecordDescRep& other)
@@ -57,7 +58,8 @@ RecordDescRep::RecordDescRep (const RecordDescRep& other)
   shapes_p(0),
   is_array_p(0),
   tableDescNames_p(0),
-  comments_p(0)
+  comments_p(0),
+  layout_id_p(0)
 {
     copy_other (other);
 }
@@ -90,7 +92,8 @@ void RecordDescRep::addFieldName (const String& fieldName, DataType type)
     uInt n = n_p - 1;
     types_p[n] = type;
     names_p[n] = fieldName;
-    name_map_p.insert (std::make_pair(fieldName, n));
+    indexField (n);
+    newLayout();
     sub_records_p[n] = 0;
     is_array_p[n] = False;
     shapes_p[n].resize(1);
@@ -323,14 +326,6 @@ uInt RecordDescRep::removeField (Int whichField)
 	sub_records_p[whichField] = 0;
     }
     n_p--;
-    // Remove the field from the name map.
-    // Decrement the field number of all fields following it.
-    name_map_p.erase (names_p[whichField]);
-    for (auto& x : name_map_p) {
-        if (x.second > whichField) {
-            x.second -= 1;
-        }
-    }
     types_p.remove (whichField);
     names_p.remove (whichField);
     sub_records_p.remove (whichField);
@@ -338,16 +333,18 @@ uInt RecordDescRep::removeField (Int whichField)
     is_array_p.remove (whichField);
     tableDescNames_p.remove (whichField);
     comments_p.remove (whichField);
+    // The fields following it get a lower number.
+    rebuildIndex();
+    newLayout();
     return n_p;
 }
 
 void RecordDescRep::renameField (const String& newName, Int whichField)
 {
     AlwaysAssert (whichField>=0 && whichField < Int(n_p), AipsError);
-    Int inx = name_map_p[names_p[whichField]];
-    name_map_p.erase (names_p[whichField]);
-    name_map_p.insert (std::make_pair(newName, inx));
     names_p[whichField] = newName;
+    rebuildIndex();
+    newLayout();
 }
 
 void RecordDescRep::setShape (const IPosition& shape, Int whichField)
@@ -359,8 +356,72 @@ void RecordDescRep::setShape (const IPosition& shape, Int whichField)
 
 Int RecordDescRep::fieldNumber (const String& fieldName) const
 {
-    std::map<String,Int>::const_iterator iter = name_map_p.find (fieldName);
-    return (iter == name_map_p.end()  ?  -1 : iter->second);
+    if (n_p == 0) {
+        return -1;
+    }
+    uInt hash = hashName (fieldName);
+    uInt mask = name_index_p.size() - 1;
+    // Compare the names only if the hash values match.
+    for (uInt slot = hash & mask;  name_index_p[slot].second >= 0;
+         slot = (slot + 1) & mask) {
+        if (name_index_p[slot].first == hash  &&
+            names_p[name_index_p[slot].second] == fieldName) {
+            return name_index_p[slot].second;
+        }
+    }
+    return -1;
+}
+
+Int RecordDescRep::fieldNumber (const String& fieldName, Int hint) const
+{
+    if (hint >= 0  &&  uInt(hint) < n_p  &&  names_p[hint] == fieldName) {
+        return hint;
+    }
+    return fieldNumber (fieldName);
+}
+
+uInt RecordDescRep::hashName (const String& fieldName)
+{
+    // FNV-1a
+    uInt hash = 2166136261u;
+    for (String::const_iterator iter = fieldName.begin();
+         iter != fieldName.end(); ++iter) {
+        hash = (hash ^ uChar(*iter)) * 16777619u;
+    }
+    return hash;
+}
+
+void RecordDescRep::indexField (uInt whichField)
+{
+    if (2 * n_p > name_index_p.size()) {
+        rebuildIndex();
+        return;
+    }
+    uInt hash = hashName (names_p[whichField]);
+    uInt mask = name_index_p.size() - 1;
+    uInt slot = hash & mask;
+    while (name_index_p[slot].second >= 0) {
+        slot = (slot + 1) & mask;
+    }
+    name_index_p[slot] = std::make_pair (hash, Int(whichField));
+}
+
+void RecordDescRep::rebuildIndex()
+{
+    size_t size = 8;
+    while (size < 2 * n_p) {
+        size *= 2;
+    }
+    name_index_p.assign (size, std::make_pair (0u, -1));
+    for (uInt i=0; i<n_p; ++i) {
+        indexField (i);
+    }
+}
+
+void RecordDescRep::newLayout()
+{
+    static std::atomic<uInt64> lastLayoutId(0);
+    layout_id_p = ++lastLayoutId;
 }
 
 String RecordDescRep::makeName (Int whichField) const
@@ -516,7 +577,8 @@ void RecordDescRep::copy_other (const RecordDescRep& other)
     n_p = other.n_p;
     types_p = other.types_p;
     names_p = other.names_p;
-    name_map_p = other.name_map_p;
+    name_index_p = other.name_index_p;
+    layout_id_p = other.layout_id_p;
     shapes_p = other.shapes_p;
     is_array_p = other.is_array_p;
     tableDescNames_p = other.tableDescNames_p;
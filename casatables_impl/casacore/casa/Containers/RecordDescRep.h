@@ -36,7 +36,8 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/iosfwd.h>
-#include <map>
+#include <utility>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -153,6 +154,17 @@ public:
     // does not exist.
     Int fieldNumber (const String& fieldName) const;
 
+    // Same as above, but first test if field <src>hint</src> has the name.
+    Int fieldNumber (const String& fieldName, Int hint) const;
+
+    // Get the identity of the field names and their order.
+    // It changes whenever a field is added, removed or renamed, but is
+    // kept by a copy. So records with equal layout ids have the same field
+    // numbers for the same names, which lets RecordFieldId cache them.
+    // It is never 0.
+    uInt64 layoutId() const
+        { return layout_id_p; }
+
     // Number of fields in the description.
     uInt nfields() const;
 
@@ -265,6 +277,18 @@ protected:
     void copy_other (const RecordDescRep& other);
     // </group>
 
+    // Give the description a new layout id.
+    void newLayout();
+
+    // Add a field to the name index, growing it if needed.
+    void indexField (uInt whichField);
+
+    // Rebuild the name index from scratch.
+    void rebuildIndex();
+
+    // Get the hash value of a field name.
+    static uInt hashName (const String& fieldName);
+
 private:
     // Test if all fields are part of the other description.
     // The flag equalDataTypes is set to True if the data types of the
@@ -290,8 +314,13 @@ private:
     Block<String> tableDescNames_p;
     // Comments for each field.
     Block<String> comments_p;
-    // Mapping of field name to field number.
-    std::map<String,Int> name_map_p;
+    // Index of the field names as an open addressing hash table with linear
+    // probing. Each slot holds the hash value of the name and the field
+    // number (-1 for an empty slot). Its size is a power of 2 and at
+    // least twice the number of fields.
+    std::vector<std::pair<uInt,Int> > name_index_p;
+    // The layout id.
+    uInt64 layout_id_p;
 };
 
 inline uInt RecordDescRep::nfields() const
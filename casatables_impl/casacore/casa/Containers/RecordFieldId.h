@@ -33,6 +33,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -64,6 +65,15 @@ class RecordInterface;
 // because that is the natural identification.
 // However, identification by means of field number is much faster
 // and could be used when it is known.
+// <br>A RecordFieldId given by name remembers the field number it was
+// resolved to, together with the layout id of the record description
+// (see RecordDesc::layoutId). When the same object is used again for a
+// record with that layout (e.g. the same record or a copy of it),
+// the name lookup is skipped. For a record with another layout the
+// remembered number is tried first, so a record with an identical but
+// separately built description only needs a name comparison.
+// So it pays to keep a RecordFieldId object when accessing a field of
+// many similar records.
 // </synopsis>
 
 // <example>
@@ -110,37 +120,110 @@ public:
     // Is the id given by name?
     Bool byName() const;
 
+    // Copy constructor and assignment (copy semantics).
+    // <group>
+    RecordFieldId (const RecordFieldId& other);
+    RecordFieldId& operator= (const RecordFieldId& other);
+    // </group>
+
+    // Get the field number found before for a record with the given layout id.
+    // -1 is returned if not known.
+    Int cachedNumber (uInt64 layoutId) const;
+
+    // Remember the field number found for a record with the given layout id.
+    // Nothing is done if the layout id is 0.
+    void setCachedNumber (uInt64 layoutId, Int fieldNumber) const;
+
+    // Get the field number found last, whatever the layout id.
+    // It can be used as a hint for a record with another layout.
+    // -1 is returned if no number was found yet.
+    Int lastNumber() const;
+
 private:
     Bool    byName_p;
     Int     number_p;
     String  name_p;
+    //# Layout id in the upper 40 bits and field number in the lower 24 bits.
+    //# It is atomic, so a const object can be shared by threads.
+    mutable std::atomic<uInt64> cache_p;
 };
 
 
 
 inline RecordFieldId::RecordFieldId (Int fieldNumber)
 : byName_p (False),
-  number_p (fieldNumber)
+  number_p (fieldNumber),
+  cache_p  (0)
 {}
 
 inline RecordFieldId::RecordFieldId (const String& fieldName)
 : byName_p (True),
   number_p (-1),
-  name_p   (fieldName)
+  name_p   (fieldName),
+  cache_p  (0)
 {}
 
 inline RecordFieldId::RecordFieldId (const std::string& fieldName)
 : byName_p (True),
   number_p (-1),
-  name_p   (fieldName)
+  name_p   (fieldName),
+  cache_p  (0)
 {}
 
 inline RecordFieldId::RecordFieldId (const Char* fieldName)
 : byName_p (True),
   number_p (-1),
-  name_p   (fieldName)
+  name_p   (fieldName),
+  cache_p  (0)
+{}
+
+inline RecordFieldId::RecordFieldId (const RecordFieldId& other)
+: byName_p (other.byName_p),
+  number_p (other.number_p),
+  name_p   (other.name_p),
+  cache_p  (other.cache_p.load (std::memory_order_relaxed))
 {}
 
+inline RecordFieldId& RecordFieldId::operator= (const RecordFieldId& other)
+{
+    if (this != &other) {
+        byName_p = other.byName_p;
+        number_p = other.number_p;
+        name_p   = other.name_p;
+        cache_p.store (other.cache_p.load (std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+inline Int RecordFieldId::cachedNumber (uInt64 layoutId) const
+{
+    uInt64 cache = cache_p.load (std::memory_order_relaxed);
+    if (layoutId == 0  ||  cache >> 24 != layoutId) {
+        return -1;
+    }
+    return Int(cache & 0xffffff);
+}
+
+inline Int RecordFieldId::lastNumber() const
+{
+    uInt64 cache = cache_p.load (std::memory_order_relaxed);
+    if (cache == 0) {
+        return -1;
+    }
+    return Int(cache & 0xffffff);
+}
+
+inline void RecordFieldId::setCachedNumber (uInt64 layoutId,
+                                            Int fieldNumber) const
+{
+    if (layoutId != 0  &&  layoutId >> 40 == 0  &&
+        fieldNumber >= 0  &&  fieldNumber < 0x1000000) {
+        cache_p.store (layoutId << 24 | uInt64(fieldNumber),
+                       std::memory_order_relaxed);
+    }
+}
+
 inline Int RecordFieldId::fieldNumber() const
 {
     return number_p;
@@ -97,10 +97,34 @@ RecordDesc RecordInterface::description() const
 }
 
 
+uInt64 RecordInterface::descriptionId() const
+{
+    return 0;
+}
+
+Int RecordInterface::fieldNumber (const String& fieldName, Int) const
+{
+    return fieldNumber (fieldName);
+}
+
+Int RecordInterface::nameToNumber (const RecordFieldId& id) const
+{
+    uInt64 layout = descriptionId();
+    Int whichField = id.cachedNumber (layout);
+    if (whichField < 0) {
+        // Another layout; the number found there is likely the same.
+	whichField = fieldNumber (id.fieldName(), id.lastNumber());
+	if (whichField >= 0) {
+	    id.setCachedNumber (layout, whichField);
+	}
+    }
+    return whichField;
+}
+
 Int RecordInterface::newIdToNumber (const RecordFieldId& id) const
 {
     if (id.byName()) {
-	return fieldNumber (id.fieldName());
+	return nameToNumber (id);
     }
     Int nfield = nfields();
     if (id.fieldNumber() > nfield) {
@@ -117,13 +141,24 @@ Int RecordInterface::idToNumber (const RecordFieldId& id) const
     if (! id.byName()) {
 	return id.fieldNumber();
     }
-    Int whichField = fieldNumber (id.fieldName());
+    Int whichField = nameToNumber (id);
     if (whichField < 0) {
 	throw (AipsError ("RecordInterface: field " + id.fieldName() +
 			  " is unknown"));
     }
     return whichField;
 }
+Int RecordInterface::findField (const RecordFieldId& id) const
+{
+    if (id.byName()) {
+	return nameToNumber (id);
+    }
+    Int whichField = id.fieldNumber();
+    if (whichField < 0  ||  whichField >= Int(nfields())) {
+	return -1;
+    }
+    return whichField;
+}
 
 
 String RecordInterface::name (const RecordFieldId& id) const
@@ -237,10 +237,20 @@ public:
     // -1 is returned if the field name is unknown.
     virtual Int fieldNumber (const String& fieldName) const = 0;
 
+    // Get the layout id of the description (see RecordDesc::layoutId).
+    // It is used by idToNumber to reuse the field number a RecordFieldId
+    // found before in a record with the same layout.
+    // The default implementation returns 0, which disables that.
+    virtual uInt64 descriptionId() const;
+
     // Get the field number for the given field id.
     // It throws an exception if id is unrecognized (e.g. an unknown name).
     Int idToNumber (const RecordFieldId&) const;
 
+    // Get the field number for the given field id.
+    // It returns -1 if the field does not exist.
+    Int findField (const RecordFieldId&) const;
+
     // Test if a field name exists.
     //# Is here for backward compatibility with KeywordSet.
     Bool isDefined (const String& fieldName) const;
@@ -522,6 +532,12 @@ protected:
     // It returns -1 if an unknown name was given.
     Int newIdToNumber (const RecordFieldId&) const;
 
+    // Get the field number from the field name, where field
+    // <src>hint</src> is tested first.
+    // -1 is returned if the field name is unknown.
+    // The default implementation ignores the hint.
+    virtual Int fieldNumber (const String& fieldName, Int hint) const;
+
     // Add a scalar field with the given type and value.
     // An exception is thrown if the record structure is fixed
     // or if the name is invalid.
@@ -539,6 +555,10 @@ private:
     // Get the description of this record.
     virtual RecordDesc getDescription() const = 0;
 
+    // Look up a field given by name, using the number cached in the id.
+    // It returns -1 if the name is unknown.
+    Int nameToNumber (const RecordFieldId&) const;
+
     // Holds the callback function plus argument.
     CheckFieldFunction* checkFunction_p;
     const void*         checkArgument_p;
@@ -109,10 +109,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
 			    const IPosition& shape, const IPosition& tileShape,
-			    const HDF5DataType& type)
+			    const HDF5DataType& type, uInt compressLevel)
     : itsDataType (type)
   {
-    create (parentHid, name, shape, tileShape);
+    create (parentHid, name, shape, tileShape, compressLevel);
   }
 
   HDF5DataSet::HDF5DataSet (const HDF5Object& parentHid, const String& name,
@@ -193,20 +193,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 #ifdef HAVE_HDF5
 
   void HDF5DataSet::create (const HDF5Object& parentHid, const String& name,
-			    const IPosition& shape, const IPosition& tileShape)
+			    const IPosition& shape, const IPosition& tileShape,
+			    uInt compressLevel)
   {
     itsParent = &parentHid;
     setName (name);
+    itsCompressLevel = std::min (compressLevel, 9u);
+    itsShuffle       = itsCompressLevel > 0;
+    itsRawChunks     = False;
     // Get the array shape and tile shape. Adjust as needed.
     AlwaysAssert (shape.nelements() >= tileShape.nelements(), AipsError);
     itsShape     = shape;
     itsTileShape = IPosition(shape.nelements(), 1);
     // Trailing elements already have value 1; set the first elements.
     for (uInt i=0; i<tileShape.nelements(); ++i) {
+      itsTileShape[i] = tileShape[i];
       if (shape[i] > 0) {
         itsTileShape[i] = std::min(tileShape[i], shape[i]);
       }
-      itsTileShape[i] = std::max(ssize_t(1), tileShape[i]);
+      itsTileShape[i] = std::max(ssize_t(1), itsTileShape[i]);
     }
     // Create access property for later setting of cache size.
     itsDaplid = H5Pcreate (H5P_DATASET_ACCESS);
@@ -227,18 +232,32 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     AlwaysAssert (itsPLid.getHid() >= 0, AipsError);
     Block<hsize_t> cs = HDF5DataType::fromShape (itsTileShape);
     H5Pset_chunk(itsPLid, rank, cs.storage());
+    if (itsCompressLevel > 0) {
+      if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+        throw HDF5Error("Data set array " + name + " cannot be compressed;"
+                        " the deflate filter is not available");
+      }
+      H5Pset_shuffle(itsPLid);
+      H5Pset_deflate(itsPLid, itsCompressLevel);
+    }
     // Create the data set.
     setHid (H5Dcreate2(parentHid, name.chars(), itsDataType.getHidFile(),
 		       itsDSid, 0, itsPLid, 0));
     if (! isValid()) {
       throw HDF5Error("Data set array " + name + " could not be created");
     }
+#if H5_VERSION_GE(1,10,2)
+    itsRawChunks = True;
+#endif
   }
 
   void HDF5DataSet::open (const HDF5Object& parentHid, const String& name)
   {
     itsParent = &parentHid;
     setName (name);
+    itsCompressLevel = 0;
+    itsShuffle       = False;
+    itsRawChunks     = False;
     // Open the dataset.
     setHid (H5Dopen2(parentHid, name.chars(), 0));
     if (! isValid()) {
@@ -282,6 +301,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         throw HDF5Error("Data set array " + name + " tile shape error");
       }
       itsTileShape = HDF5DataType::toShape(shp);
+      // Find out which filters are used. The raw chunks can only be
+      // decoded by the caller if at most shuffle followed by deflate is used.
+      Bool otherFilter = False;
+      int nfilter = H5Pget_nfilters(itsPLid);
+      for (int i=0; i<nfilter; ++i) {
+        unsigned int flags;
+        unsigned int cdValues[8];
+        size_t ncdValues = 8;
+        H5Z_filter_t filter = H5Pget_filter2 (itsPLid, i, &flags, &ncdValues,
+                                              cdValues, 0, 0, 0);
+        if (filter == H5Z_FILTER_SHUFFLE  &&  i == 0) {
+          itsShuffle = True;
+        } else if (filter == H5Z_FILTER_DEFLATE  &&  i == nfilter-1) {
+          itsCompressLevel = (ncdValues > 0  ?  std::max(cdValues[0], 1u) : 1);
+        } else {
+          otherFilter = True;
+        }
+      }
+#if H5_VERSION_GE(1,10,2)
+      itsRawChunks = !otherFilter;
+#else
+      (void)otherFilter;
+#endif
     }
   }
 
@@ -342,6 +384,37 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return HDF5DataType::getDataType (dtid);
   }
 
+  Bool HDF5DataSet::readRawChunk (const IPosition& start,
+                                  std::vector<char>& buf, uInt& filterMask)
+  {
+    if (! itsRawChunks) {
+      throw HDF5Error("Raw chunks of data set array " + getName() +
+                      " cannot be read");
+    }
+#if H5_VERSION_GE(1,10,2)
+    Block<hsize_t> offset = HDF5DataType::fromShape(start);
+    hsize_t nbytes = 0;
+    if (H5Dget_chunk_storage_size (getHid(), offset.storage(), &nbytes) < 0) {
+      throw HDF5Error("invalid chunk offset for dataset " + getName());
+    }
+    // A chunk without storage has not been written yet.
+    if (nbytes == 0) {
+      return False;
+    }
+    buf.resize (nbytes);
+    uint32_t mask = 0;
+    if (H5Dread_chunk (getHid(), H5P_DEFAULT, offset.storage(), &mask,
+                       buf.data()) < 0) {
+      throw HDF5Error("reading raw chunk from data set array " + getName());
+    }
+    filterMask = mask;
+    return True;
+#else
+    (void)start; (void)buf; (void)filterMask;
+    return False;
+#endif
+  }
+
   void HDF5DataSet::get (const Slicer& section, ArrayBase& arr, Bool resize)
   {
     const IPosition& shp = section.length();
@@ -453,7 +526,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 #else
 
   void HDF5DataSet::create (const HDF5Object&, const String&,
-			    const IPosition&, const IPosition&)
+			    const IPosition&, const IPosition&, uInt)
   {
     HDF5Object::throwNoHDF5();
   }
@@ -487,6 +560,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void HDF5DataSet::extend (const IPosition&)
   {}
 
+  Bool HDF5DataSet::readRawChunk (const IPosition&, std::vector<char>&, uInt&)
+    { return False; }
+
 #endif
 
 }
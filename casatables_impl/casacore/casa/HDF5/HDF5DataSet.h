@@ -36,6 +36,7 @@
 #include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/DataType.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -68,7 +69,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // axis with length 0, whereafter the extend function can be used to
   // extend the data set.
   // The data can be stored in a tiled (chunked) way by specifying the tile
-  // shape when creating it.
+  // shape when creating it. The chunks can be compressed using the HDF5
+  // shuffle and deflate filters.
   // <br>
   // When opening an existing data set, it is checked if the given data type
   // matches the data set's data type. For a compound data type, it only
@@ -80,6 +82,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // <p>
   // Note that Casacore arrays are in Fortran order, while HDF5 uses C order.
   // Therefore array axes are reversed, thus axes in shapes, slicers, etc.
+  // <br>
+  // The raw (still compressed) data of a chunk can be read, so the chunks
+  // can be decoded outside the HDF5 library (e.g., in parallel).
   // </synopsis> 
 
   // <motivation>
@@ -94,6 +99,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   public: 
     // Create an HDF5 data set in the given hid (file or group).
     // It gets the given name, shape (also tile shape), and data type.
+    // A compression level 1-9 means that the chunks are compressed using
+    // the shuffle and deflate filters; 0 means no compression.
     // <group>
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
 		 const IPosition& tileShape, const Bool*);
@@ -114,7 +121,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
 		 const IPosition& tileShape, const DComplex*);
     HDF5DataSet (const HDF5Object&, const String&, const IPosition& shape,
-		 const IPosition& tileShape, const HDF5DataType&);
+		 const IPosition& tileShape, const HDF5DataType&,
+		 uInt compressLevel=0);
     // </group>
 
     // Open an existing HDF5 data set in the given hid (file or group).
@@ -153,6 +161,28 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     const IPosition& tileShape() const
       { return itsTileShape; }
 
+    // Get the deflate compression level (0 = not compressed).
+    uInt compressLevel() const
+      { return itsCompressLevel; }
+
+    // Is the shuffle filter used before compression?
+    Bool isShuffled() const
+      { return itsShuffle; }
+
+    // Can the raw chunks be read and decoded by the caller?
+    // This is the case if the data set is chunked and uses no other filters
+    // than shuffle and deflate, and if the HDF5 library supports it.
+    Bool canReadRawChunks() const
+      { return itsRawChunks; }
+
+    // Read the raw (still filtered) data of the chunk starting at the
+    // given position (which must be a multiple of the tile shape).
+    // The buffer is resized as needed. The filter mask tells which filters
+    // have been skipped for the chunk (bit 0 is the first filter).
+    // False is returned if the chunk has not been written yet.
+    Bool readRawChunk (const IPosition& start, std::vector<char>& buf,
+                       uInt& filterMask);
+
     // Get a section of data into the array.
     // The array is resized if its shape does not match the slicer's shape.
     // This is only possible if the array is empty or if resize=True.
@@ -178,7 +208,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   protected:
     // Create the data set.
     void create (const HDF5Object&, const String&,
-		 const IPosition& shape, const IPosition& tileShape);
+		 const IPosition& shape, const IPosition& tileShape,
+		 uInt compressLevel=0);
 
     // Open the data set and check if the external data type matches.
     void open (const HDF5Object&, const String&);
@@ -199,6 +230,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     IPosition          itsTileShape;
     HDF5DataType       itsDataType;
     const HDF5Object*  itsParent;
+    uInt               itsCompressLevel;
+    Bool               itsShuffle;
+    Bool               itsRawChunks;
   };
 
 }
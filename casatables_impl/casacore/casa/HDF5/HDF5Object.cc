@@ -34,6 +34,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGI
   HDF5Object::~HDF5Object()
   {}
 
+  std::recursive_mutex& HDF5Object::libraryMutex()
+  {
+    static std::recursive_mutex mutex;
+    return mutex;
+  }
+
 #ifdef HAVE_HDF5
   Bool HDF5Object::hasHDF5Support()
     { return True; }
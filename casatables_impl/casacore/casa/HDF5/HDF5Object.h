@@ -31,6 +31,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <mutex>
 
 //# Define hid_t and hsize_t if not defined (thus if HDF5 disabled).
 //# They should be the same as used by HDF5.
@@ -81,6 +82,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Check if there is HDF5 support compiled in.
     static Bool hasHDF5Support();
 
+    // Get the mutex to be held when calling the HDF5 library, because it
+    // is not assumed to be thread-safe. It is the same for all users in
+    // the process (e.g. HDF5StMan and MultiHDF5). It is recursive, so
+    // functions holding it can call other functions taking it.
+    static std::recursive_mutex& libraryMutex();
+
     // Close the hid if valid.
     virtual void close() = 0;
 
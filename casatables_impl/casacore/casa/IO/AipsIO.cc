@@ -31,6 +31,8 @@
 #include <casacore/casa/IO/ByteIO.h>
 #include <casacore/casa/IO/RegularFileIO.h>
 #include <casacore/casa/IO/MFFileIO.h>
+#include <casacore/casa/IO/MMapfdIO.h>
+#include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <cstring>                  //# for strcmp with gcc-4.3
@@ -53,19 +55,21 @@ AipsIO::AipsIO()
   objlen_p (10),
   objtln_p (10),
   objptr_p (10),
-  hasCachedType_p(False)
+  hasCachedType_p(False),
+  mappedFD_p (-1)
 {}
 
 AipsIO::AipsIO (const String& fileName, ByteIO::OpenOption fop,
-		uInt filebufSize, MultiFileBase* mfile)
+		uInt filebufSize, MultiFileBase* mfile, Bool mapped)
 : opened_p (0),
   maxlev_p (10),
   objlen_p (10),
   objtln_p (10),
-  objptr_p (10)
+  objptr_p (10),
+  mappedFD_p (-1)
 {
     // Open the file.
-  open (fileName, fop, filebufSize, mfile);
+  open (fileName, fop, filebufSize, mfile, mapped);
 }
 
 AipsIO::AipsIO (ByteIO* file)
@@ -73,7 +77,8 @@ AipsIO::AipsIO (ByteIO* file)
   maxlev_p   (10),
   objlen_p   (10),
   objtln_p   (10),
-  objptr_p   (10)
+  objptr_p   (10),
+  mappedFD_p (-1)
 {
     open (file);
 }
@@ -83,7 +88,8 @@ AipsIO::AipsIO (TypeIO* file)
   maxlev_p   (10),
   objlen_p   (10),
   objtln_p   (10),
-  objptr_p   (10)
+  objptr_p   (10),
+  mappedFD_p (-1)
 {
     open (file);
 }
@@ -98,12 +104,15 @@ AipsIO::~AipsIO()
 
 
 void AipsIO::open (const String& fileName, ByteIO::OpenOption fop,
-		   uInt filebufSize, MultiFileBase* mfile)
+		   uInt filebufSize, MultiFileBase* mfile, Bool mapped)
 {
     // Initialize everything for the open.
     openInit (fop);
     if (mfile) {
       file_p = new MFFileIO (*mfile, fileName, fopt_p);
+    } else if (mapped  &&  fopt_p == ByteIO::Old) {
+      mappedFD_p = RegularFileIO::openCreate (RegularFile(fileName), fopt_p);
+      file_p = new MMapfdIO (mappedFD_p, fileName);
     } else {
       file_p = new RegularFileIO (fileName, fopt_p, filebufSize);
     }
@@ -172,6 +181,10 @@ void AipsIO::close()
 	delete io_p;
 	delete file_p;
     }
+    if (mappedFD_p >= 0) {
+	FiledesIO::close (mappedFD_p);
+	mappedFD_p = -1;
+    }
     io_p     = 0;
     file_p   = 0;
     opened_p = 0;
@@ -901,6 +914,99 @@ AipsIO& AipsIO::getnew (uInt& nrv, String*& var)
 }
 
 
+// The following routines get an entire vector in one go without copying
+// if the data are directly addressable and in local format.
+// uInt64 has the same format as Int64.
+
+template<typename T>
+AipsIO& AipsIO::doGetview (uInt& nrv, const T*& var, Block<T>& buffer,
+                           DataType dtype)
+{
+    operator>> (nrv);
+    const void* ptr = 0;
+    if (io_p->isLocalFormat (dtype)) {
+	ptr = io_p->byteIO().readView (Int64(nrv) * sizeof(T));
+    }
+    if (ptr == 0) {
+	buffer.resize (nrv, True, False);
+	get (nrv, buffer.storage());
+	var = buffer.storage();
+    } else {
+	objlen_p[level_p] += nrv * sizeof(T);
+	testgetLength();
+	// The data in the file might not be aligned properly.
+	if (size_t(ptr) % alignof(T) == 0) {
+	    var = static_cast<const T*>(ptr);
+	} else {
+	    buffer.resize (nrv, True, False);
+	    memcpy (static_cast<void*>(buffer.storage()), ptr, nrv * sizeof(T));
+	    var = buffer.storage();
+	}
+    }
+    return (*this);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const Char*& var, Block<Char>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpChar);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const uChar*& var, Block<uChar>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpUChar);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const short*& var, Block<short>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpShort);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const unsigned short*& var, Block<unsigned short>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpUShort);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const int*& var, Block<int>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpInt);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const unsigned int*& var, Block<unsigned int>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpUInt);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const Int64*& var, Block<Int64>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpInt64);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const uInt64*& var, Block<uInt64>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpInt64);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const float*& var, Block<float>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpFloat);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const double*& var, Block<double>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpDouble);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const Complex*& var, Block<Complex>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpComplex);
+}
+
+AipsIO& AipsIO::getview (uInt& nrv, const DComplex*& var, Block<DComplex>& buffer)
+{
+    return doGetview (nrv, var, buffer, TpDComplex);
+}
+
+
 // getNextType gets the object type of the next piece of
 // information to read. It can only be used if a file has been
 // opened and if no put is in operation.
@@ -990,6 +1096,20 @@ uInt AipsIO::getend()
     }
 }
 
+uInt AipsIO::skipObject()
+{
+    getNextType();                         // reads the object header
+    uInt len = objtln_p[level_p];
+    if (len == magicval_p) {
+	throw (AipsError ("AipsIO::skipObject: length of object " +
+			  objectType_p + " is unknown"));
+    }
+    io_p->seek (Int64(len) - objlen_p[level_p], ByteIO::Current);
+    objlen_p[level_p] = len;
+    hasCachedType_p = False;
+    return getend();
+}
+
 
 // Throw errors on behalf of testput and testget.
 // testget and testput are inline and it would be a bit expensive to
@@ -35,6 +35,7 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/IO/ByteIO.h>
+#include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/vector.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -93,6 +94,14 @@ class MultiFileBase;
 // a new array allocated on the heap.  It returns the nr of values read
 // and a pointer to the array.
 // The data must be read back in the same order as it was written.
+// AipsIO.getview (&nr, &arr, buffer) is like getnew, but does not copy the
+// values if possible (see below).
+// <p>
+// An existing file can be opened memory-mapped. The values are then
+// converted directly from the mapped data (thus without intermediate
+// buffering), while getview returns a pointer to the mapped data if the
+// values are stored in local format. The same is done if AipsIO is used on
+// a <linkto class=MemoryIO>MemoryIO</linkto> object.
 // <p>
 // The functions <src>putstart(type,version)</src>
 // and <src>putend()</src> must be called
@@ -176,11 +185,13 @@ public:
     // using buffered IO with a buffer of the given size.
     // <br>If the MultiFileBase pointer is not null, a virtual file in the
     // MultiFileBase will be used instead of a regular file.
+    // <br>If <src>mapped=True</src>, an existing regular file opened
+    // readonly is memory-mapped instead of using buffered IO.
     explicit AipsIO (const String& fileName,
 		     ByteIO::OpenOption = ByteIO::Old,
 		     uInt filebufSize=65536,
 ////		     uInt filebufSize=1048576,
-                     MultiFileBase* mfile=0);
+                     MultiFileBase* mfile=0, Bool mapped=False);
 
     // Construct from a stream object derived from ByteIO.
     // This can for instance by used to use AipsIO on a file descriptor
@@ -199,7 +210,8 @@ public:
     // Open/create file (either a regular file or a MultiFileBase virtual file).
     // An exception is thrown if the object contains an already open file.
     void open (const String& fileName, ByteIO::OpenOption = ByteIO::Old,
-	       uInt filebufSize=65536, MultiFileBase* mfile=0);
+	       uInt filebufSize=65536, MultiFileBase* mfile=0,
+               Bool mapped=False);
 
     // Open by connecting to the given byte stream.
     // This can for instance by used to use AipsIO on a file descriptor
@@ -393,12 +405,45 @@ public:
     AipsIO& getnew (uInt& nrval, String*& values);
     // </group>
 
+    // Read in values as written by the function put (like getnew), but
+    // avoid copying them if possible.
+    // If the data are directly addressable (memory-mapped file or MemoryIO)
+    // and stored in local format, <src>values</src> points to the data
+    // themselves. The pointer is valid until the AipsIO object is closed.
+    // Otherwise the values are read into <src>buffer</src> (resized as
+    // needed) and <src>values</src> points to it.
+    // <group>
+    AipsIO& getview (uInt& nrval, const Char*& values, Block<Char>& buffer);
+    AipsIO& getview (uInt& nrval, const uChar*& values, Block<uChar>& buffer);
+    AipsIO& getview (uInt& nrval, const short*& values, Block<short>& buffer);
+    AipsIO& getview (uInt& nrval, const unsigned short*& values,
+                     Block<unsigned short>& buffer);
+    AipsIO& getview (uInt& nrval, const int*& values, Block<int>& buffer);
+    AipsIO& getview (uInt& nrval, const unsigned int*& values,
+                     Block<unsigned int>& buffer);
+    AipsIO& getview (uInt& nrval, const Int64*& values, Block<Int64>& buffer);
+    AipsIO& getview (uInt& nrval, const uInt64*& values,
+                     Block<uInt64>& buffer);
+    AipsIO& getview (uInt& nrval, const float*& values, Block<float>& buffer);
+    AipsIO& getview (uInt& nrval, const double*& values, Block<double>& buffer);
+    AipsIO& getview (uInt& nrval, const Complex*& values,
+                     Block<Complex>& buffer);
+    AipsIO& getview (uInt& nrval, const DComplex*& values,
+                     Block<DComplex>& buffer);
+    // </group>
+
     // End reading an object. It returns the object length (including
     // possible nested objects).
     // It checks if the entire object has been read (to keep the data
     // stream in sync). If not, an exception is thrown.
     uInt getend();
 
+    // Skip the next object (including its nested objects) without reading
+    // its values. It returns the object length.
+    // An exception is thrown if the object length is unknown, which is the
+    // case if it was written to a stream that cannot seek back.
+    uInt skipObject();
+
 private:
     // Initialize everything for the open.
     // It checks if there is no outstanding open file.
@@ -422,6 +467,11 @@ private:
     // Throw exception for testgetLength
     void testgeterrLength();
 
+    // Implement getview for the given data type.
+    template<typename T>
+    AipsIO& doGetview (uInt& nrval, const T*& values, Block<T>& buffer,
+                       DataType dtype);
+
 
     //  1 = file was opened by AipsIO
     //  0 = file not opened
@@ -457,6 +507,8 @@ private:
     TypeIO*      io_p;
     // Is the file is seekable?
     Bool         seekable_p;
+    // The file descriptor of a memory-mapped file (-1 if not mapped).
+    int          mappedFD_p;
     // magic value to check sync.
     static const uInt magicval_p;
 };
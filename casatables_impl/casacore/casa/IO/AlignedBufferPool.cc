@@ -0,0 +1,192 @@
+//# AlignedBufferPool.cc: Pool of page-aligned I/O buffers
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/IO/AlignedBufferPool.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <stdlib.h>                    // for posix_memalign
+#include <unistd.h>                    // for sysconf
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+    // The state of the pool.
+    struct PoolState
+    {
+        PoolState()
+            : maxPooled (64*1024*1024),
+              pooled    (0),
+              nallocate (0),
+              nreuse    (0)
+            {}
+        // Free the buffers in the free lists until at most nbytes are kept.
+        void shrink (size_t nbytes)
+        {
+            for (std::map<size_t, std::vector<char*> >::iterator
+                     iter=freeList.begin();
+                 iter!=freeList.end()  &&  pooled>nbytes; ++iter) {
+                while (!iter->second.empty()  &&  pooled>nbytes) {
+                    free (iter->second.back());
+                    iter->second.pop_back();
+                    pooled -= iter->first;
+                }
+            }
+        }
+        void clear()
+            { shrink (0); }
+
+        std::mutex mutex;
+        std::map<size_t, std::vector<char*> > freeList;
+        size_t maxPooled;
+        size_t pooled;
+        uInt64 nallocate;
+        uInt64 nreuse;
+    };
+
+    // The state is never deleted, so buffers can still be released by
+    // static objects destructed at exit.
+    PoolState& poolState()
+    {
+        static PoolState* state = new PoolState();
+        return *state;
+    }
+}
+
+
+size_t AlignedBufferPool::alignment()
+{
+    static const size_t align = std::max (size_t(4096),
+                                          size_t(sysconf(_SC_PAGESIZE)));
+    return align;
+}
+
+size_t AlignedBufferPool::sizeClass (size_t size)
+{
+    const size_t page = alignment();
+    size_t npage = std::max (size_t(1), (size + page - 1) / page);
+    // Find the smallest power of 2 (or 1.5 times it) holding npage.
+    size_t cls = 1;
+    while (cls < npage) {
+        if (cls > 1  &&  cls + cls/2 >= npage) {
+            return (cls + cls/2) * page;
+        }
+        cls *= 2;
+    }
+    return cls * page;
+}
+
+char* AlignedBufferPool::allocate (size_t size)
+{
+    size_t cls = sizeClass (size);
+    PoolState& state = poolState();
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.nallocate++;
+        std::map<size_t, std::vector<char*> >::iterator iter =
+            state.freeList.find (cls);
+        if (iter != state.freeList.end()  &&  !iter->second.empty()) {
+            char* buffer = iter->second.back();
+            iter->second.pop_back();
+            state.pooled -= cls;
+            state.nreuse++;
+            return buffer;
+        }
+    }
+    void* ptr;
+    if (posix_memalign (&ptr, alignment(), cls) != 0) {
+        throw AllocError ("AlignedBufferPool: failed to allocate aligned buffer",
+                          cls);
+    }
+    return static_cast<char*>(ptr);
+}
+
+void AlignedBufferPool::release (char* buffer, size_t size)
+{
+    if (buffer == 0) {
+        return;
+    }
+    size_t cls = sizeClass (size);
+    PoolState& state = poolState();
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.pooled + cls <= state.maxPooled) {
+            state.freeList[cls].push_back (buffer);
+            state.pooled += cls;
+            return;
+        }
+    }
+    free (buffer);
+}
+
+void AlignedBufferPool::setMaxPooled (size_t nbytes)
+{
+    PoolState& state = poolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.maxPooled = nbytes;
+    state.shrink (nbytes);
+}
+
+size_t AlignedBufferPool::maxPooled()
+{
+    PoolState& state = poolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.maxPooled;
+}
+
+size_t AlignedBufferPool::pooled()
+{
+    PoolState& state = poolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.pooled;
+}
+
+uInt64 AlignedBufferPool::nAllocate()
+{
+    PoolState& state = poolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.nallocate;
+}
+
+uInt64 AlignedBufferPool::nReuse()
+{
+    PoolState& state = poolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.nreuse;
+}
+
+void AlignedBufferPool::clear()
+{
+    PoolState& state = poolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.clear();
+}
+
+} //# NAMESPACE CASACORE - END
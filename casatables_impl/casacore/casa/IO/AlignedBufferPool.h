@@ -0,0 +1,132 @@
+//# AlignedBufferPool.h: Pool of page-aligned I/O buffers
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_ALIGNEDBUFFERPOOL_H
+#define CASA_ALIGNEDBUFFERPOOL_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <cstddef>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Process-wide pool of page-aligned I/O buffers.
+// </summary>
+
+// <use visibility=local>
+
+// <synopsis>
+// AlignedBufferPool hands out buffers aligned on a page boundary, whose
+// (allocated) size is a multiple of the page size. Such buffers can be
+// used for I/O on a file opened with O_DIRECT. They are used for the
+// buckets and tiles kept in the caches of the storage managers and for
+// the buffers of the bucket and MultiFile classes.
+// <p>
+// The requested size is rounded up to a size class (a power of 2 or 1.5
+// times a power of 2 pages), so the waste is at most one third.
+// A released buffer is kept in a free list of its size class to be reused,
+// unless the total size of the free buffers would exceed the maximum
+// (default 64 MB). The pool is thread-safe.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//    char* buf = AlignedBufferPool::allocate (bucketSize);
+//    ...
+//    AlignedBufferPool::release (buf, bucketSize);
+// </srcblock>
+// </example>
+
+class AlignedBufferPool
+{
+public:
+    // Get a buffer of at least <src>size</src> bytes (at least one page).
+    // The contents of the buffer are undefined.
+    static char* allocate (size_t size);
+
+    // Return a buffer obtained from <src>allocate</src>. The size must be
+    // the same as given to <src>allocate</src>. A null pointer is ignored.
+    static void release (char* buffer, size_t size);
+
+    // Get the alignment of the buffers. It is the page size of the
+    // system (at least 4096), which is at least the memory alignment
+    // direct I/O needs.
+    static size_t alignment();
+
+    // Get the size actually allocated for a buffer of the given size.
+    static size_t sizeClass (size_t size);
+
+    // Set or get the maximum total size of the free buffers kept.
+    // Setting it releases free buffers if needed.
+    // <group>
+    static void setMaxPooled (size_t nbytes);
+    static size_t maxPooled();
+    // </group>
+
+    // Get the total size of the free buffers kept.
+    static size_t pooled();
+
+    // Get the number of allocations and the number of them served from the
+    // pool.
+    // <group>
+    static uInt64 nAllocate();
+    static uInt64 nReuse();
+    // </group>
+
+    // Release all free buffers.
+    static void clear();
+};
+
+
+// <summary>
+// Buffer from the AlignedBufferPool released when going out of scope.
+// </summary>
+// <use visibility=local>
+class AlignedBuffer
+{
+public:
+    explicit AlignedBuffer (size_t size)
+        : itsSize (size),
+          itsData (AlignedBufferPool::allocate (size))
+        {}
+    ~AlignedBuffer()
+        { AlignedBufferPool::release (itsData, itsSize); }
+    char* data()
+        { return itsData; }
+private:
+    AlignedBuffer (const AlignedBuffer&);
+    AlignedBuffer& operator= (const AlignedBuffer&);
+    size_t itsSize;
+    char*  itsData;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
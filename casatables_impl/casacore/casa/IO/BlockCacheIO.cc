@@ -0,0 +1,274 @@
+//# BlockCacheIO.cc: Cache fixed-size blocks of another ByteIO object
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/IO/BlockCacheIO.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+BlockCacheIO::BlockCacheIO (ByteIO* file, uInt blockSize, uInt64 cacheSize)
+: file_p      (file),
+  blockSize_p (std::max (blockSize, 1u)),
+  maxBlocks_p (std::max (cacheSize / blockSize_p, uInt64(1))),
+  offset_p    (0),
+  length_p    (file->length()),
+  naccess_p   (0),
+  nmiss_p     (0)
+{}
+
+BlockCacheIO::~BlockCacheIO()
+{
+    writeDirty();
+}
+
+Int64 BlockCacheIO::read (Int64 size, void* buf, Bool throwException)
+{
+    char* ptr = static_cast<char*>(buf);
+    Int64 n = std::max (Int64(0), std::min (size, length_p - offset_p));
+    Int64 done = 0;
+    while (done < n) {
+        Int64 blocknr = offset_p / blockSize_p;
+        Int64 inblock = offset_p - blocknr * blockSize_p;
+        Int64 nr = 0;
+        if (inblock == 0  &&  n - done >= blockSize_p) {
+            nr = readDirect (blocknr, (n - done) / blockSize_p, ptr + done);
+        }
+        if (nr == 0) {
+            CachedBlock& block = getBlock (blocknr, False);
+            nr = std::min (blockSize_p - inblock, n - done);
+            memcpy (ptr + done, block.data.data() + inblock, nr);
+        }
+        done     += nr;
+        offset_p += nr;
+    }
+    if (throwException  &&  n < size) {
+        throw AipsError ("BlockCacheIO::read - incorrect number of bytes ("
+                         + String::toString(n) + " out of "
+                         + String::toString(size) + ") read for file "
+                         + fileName());
+    }
+    return n;
+}
+
+void BlockCacheIO::write (Int64 size, const void* buf)
+{
+    const char* ptr = static_cast<const char*>(buf);
+    Int64 done = 0;
+    while (done < size) {
+        Int64 blocknr = offset_p / blockSize_p;
+        Int64 inblock = offset_p - blocknr * blockSize_p;
+        Int64 nr = 0;
+        if (inblock == 0  &&  size - done >= blockSize_p) {
+            nr = writeDirect (blocknr, (size - done) / blockSize_p,
+                              ptr + done);
+        }
+        if (nr == 0) {
+            nr = std::min (blockSize_p - inblock, size - done);
+            CachedBlock& block = getBlock (blocknr, nr == blockSize_p);
+            memcpy (block.data.data() + inblock, ptr + done, nr);
+            block.dirty = True;
+        }
+        done     += nr;
+        offset_p += nr;
+        //# Update the length immediately, because a dirty block written
+        //# when removed from the cache must not be cut off.
+        length_p = std::max (length_p, offset_p);
+    }
+}
+
+BlockCacheIO::CachedBlock& BlockCacheIO::getBlock (Int64 blocknr,
+                                                   Bool overwrite)
+{
+    naccess_p++;
+    auto iter = index_p.find (blocknr);
+    if (iter != index_p.end()) {
+        lru_p.splice (lru_p.begin(), lru_p, iter->second);
+        return lru_p.front();
+    }
+    nmiss_p++;
+    if (lru_p.size() >= maxBlocks_p) {
+        //# Reuse the least recently used block.
+        lru_p.splice (lru_p.begin(), lru_p, std::prev (lru_p.end()));
+        if (lru_p.front().dirty) {
+            writeBlock (lru_p.front());
+        }
+        index_p.erase (lru_p.front().blocknr);
+    } else {
+        lru_p.emplace_front();
+        lru_p.front().data.resize (blockSize_p);
+    }
+    CachedBlock& block = lru_p.front();
+    block.blocknr = blocknr;
+    block.dirty   = False;
+    index_p[blocknr] = lru_p.begin();
+    if (! overwrite) {
+        //# The part after the end of the file reads as zeroes.
+        file_p->seek (blocknr * blockSize_p);
+        Int64 nr = std::max (Int64(0), file_p->read (blockSize_p,
+                                                     block.data.data(),
+                                                     False));
+        memset (block.data.data() + nr, 0, blockSize_p - nr);
+    }
+    return block;
+}
+
+Int64 BlockCacheIO::readDirect (Int64 blocknr, Int64 nblocks, char* buf)
+{
+    Int64 n = 0;
+    while (n < nblocks  &&  index_p.find (blocknr + n) == index_p.end()) {
+        n++;
+    }
+    if (n > 0) {
+        Int64 size = n * blockSize_p;
+        file_p->seek (blocknr * blockSize_p);
+        Int64 nr = std::max (Int64(0), file_p->read (size, buf, False));
+        memset (buf + nr, 0, size - nr);
+        naccess_p += n;
+        nmiss_p   += n;
+    }
+    return n * blockSize_p;
+}
+
+Int64 BlockCacheIO::writeDirect (Int64 blocknr, Int64 nblocks,
+                                 const char* buf)
+{
+    Int64 n = 0;
+    while (n < nblocks  &&  index_p.find (blocknr + n) == index_p.end()) {
+        n++;
+    }
+    if (n > 0) {
+        file_p->seek (blocknr * blockSize_p);
+        file_p->write (n * blockSize_p, buf);
+        naccess_p += n;
+    }
+    return n * blockSize_p;
+}
+
+void BlockCacheIO::writeBlock (CachedBlock& block)
+{
+    Int64 start = block.blocknr * blockSize_p;
+    Int64 size  = std::min (blockSize_p, length_p - start);
+    if (size > 0) {
+        file_p->seek (start);
+        file_p->write (size, block.data.data());
+    }
+    block.dirty = False;
+}
+
+void BlockCacheIO::writeDirty()
+{
+    std::vector<CachedBlock*> dirty;
+    for (CachedBlock& block : lru_p) {
+        if (block.dirty) {
+            dirty.push_back (&block);
+        }
+    }
+    std::sort (dirty.begin(), dirty.end(),
+               [] (const CachedBlock* left, const CachedBlock* right)
+               { return left->blocknr < right->blocknr; });
+    for (CachedBlock* block : dirty) {
+        writeBlock (*block);
+    }
+}
+
+void BlockCacheIO::flush()
+{
+    writeDirty();
+    file_p->flush();
+}
+
+void BlockCacheIO::fsync()
+{
+    writeDirty();
+    file_p->flush();
+    file_p->fsync();
+}
+
+void BlockCacheIO::resync()
+{
+    //# As in FilebufIO, the data written must have been flushed before.
+    for (const CachedBlock& block : lru_p) {
+        AlwaysAssert (!block.dirty, AipsError);
+    }
+    lru_p.clear();
+    index_p.clear();
+    file_p->resync();
+    length_p = file_p->length();
+}
+
+void BlockCacheIO::reopenRW()
+{
+    file_p->reopenRW();
+}
+
+String BlockCacheIO::fileName() const
+{
+    return file_p->fileName();
+}
+
+Int64 BlockCacheIO::length()
+{
+    return length_p;
+}
+
+Bool BlockCacheIO::isReadable() const
+{
+    return file_p->isReadable();
+}
+
+Bool BlockCacheIO::isWritable() const
+{
+    return file_p->isWritable();
+}
+
+Bool BlockCacheIO::isSeekable() const
+{
+    return True;
+}
+
+Int64 BlockCacheIO::doSeek (Int64 offset, ByteIO::SeekOption dir)
+{
+    switch (dir) {
+    case ByteIO::Begin:
+        offset_p = offset;
+        break;
+    case ByteIO::Current:
+        offset_p += offset;
+        break;
+    case ByteIO::End:
+        offset_p = length_p + offset;
+        break;
+    }
+    return offset_p;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,187 @@
+//# BlockCacheIO.h: Cache fixed-size blocks of another ByteIO object
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_BLOCKCACHEIO_H
+#define CASA_BLOCKCACHEIO_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/ByteIO.h>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Cache fixed-size blocks of another ByteIO object.
+// </summary>
+
+// <use visibility=local>
+
+// <prerequisite>
+//    <li> <linkto class=ByteIO>ByteIO</linkto>
+// </prerequisite>
+
+// <synopsis>
+// BlockCacheIO keeps the most recently used blocks of another ByteIO
+// object in memory, indexed by their file offset. It is meant for a file
+// that is accessed randomly in small pieces, such as the file holding
+// the indirect arrays of a storage manager, where the single buffer of
+// a <linkto class=FilebufIO>FilebufIO</linkto> is refilled at each seek.
+// <p>
+// Written data are kept in the cache until the block is removed from it
+// (the least recently used block is removed when the cache is full) or
+// until <src>flush</src> is called. Whole blocks not in the cache are read
+// or written directly, so a large array does not wipe the cache.
+// <br>The underlying ByteIO object is not owned, but it should not be used
+// directly while the BlockCacheIO object exists.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//    RegularFileIO file (RegularFile("file.dat"), ByteIO::Update);
+//    // Cache up to 128 blocks of 8 KiB.
+//    BlockCacheIO cached (&file, 8192, 1024*1024);
+//    CanonicalIO io (&cached);
+// </srcblock>
+// </example>
+
+
+class BlockCacheIO: public ByteIO
+{
+public:
+    // Cache blocks of <src>blockSize</src> bytes of the given ByteIO object
+    // using at most <src>cacheSize</src> bytes (but at least one block).
+    BlockCacheIO (ByteIO* file, uInt blockSize, uInt64 cacheSize);
+
+    // The destructor writes the dirty blocks.
+    virtual ~BlockCacheIO();
+
+    // Write <src>size</src> bytes at the current offset.
+    virtual void write (Int64 size, const void* buf);
+
+    // Read <src>size</src> bytes at the current offset. It returns the
+    // number of bytes read, which is less than <src>size</src> if the end
+    // of the file is reached (in which case an exception is thrown if
+    // <src>throwException=True</src>).
+    virtual Int64 read (Int64 size, void* buf, Bool throwException=True);
+
+    // Write the dirty blocks and flush the underlying file.
+    virtual void flush();
+
+    // Write the dirty blocks and fsync the underlying file.
+    virtual void fsync();
+
+    // Clear the cache and resync the underlying file (after it was changed
+    // by another process). The cache must not contain data not written
+    // yet (i.e. <src>flush</src> must have been called after a write),
+    // otherwise an exception is thrown.
+    virtual void resync();
+
+    // Reopen the underlying file for read/write access.
+    virtual void reopenRW();
+
+    // Get the name of the underlying file.
+    virtual String fileName() const;
+
+    // Get the length of the file (including data in the cache).
+    virtual Int64 length();
+
+    // Tell if the underlying file is readable or writable.
+    // <group>
+    virtual Bool isReadable() const;
+    virtual Bool isWritable() const;
+    // </group>
+
+    // The file is always seekable.
+    virtual Bool isSeekable() const;
+
+    // Get the number of block accesses and of the ones not found in the
+    // cache.
+    // <group>
+    uInt64 nAccess() const
+        { return naccess_p; }
+    uInt64 nMiss() const
+        { return nmiss_p; }
+    // </group>
+
+protected:
+    // Set the current offset.
+    virtual Int64 doSeek (Int64 offset, ByteIO::SeekOption);
+
+private:
+    // A cached block.
+    struct CachedBlock
+    {
+        Int64             blocknr;
+        Bool              dirty;
+        std::vector<char> data;
+    };
+
+    // Forbid copy constructor and assignment.
+    // <group>
+    BlockCacheIO (const BlockCacheIO&);
+    BlockCacheIO& operator= (const BlockCacheIO&);
+    // </group>
+
+    // Get a block from the cache or read it (unless it is overwritten
+    // entirely) and make it the most recently used one.
+    CachedBlock& getBlock (Int64 blocknr, Bool overwrite);
+
+    // Read or write the whole blocks not in the cache starting at the
+    // given block directly. It returns the number of bytes done (which
+    // is 0 if the first block is in the cache).
+    // <group>
+    Int64 readDirect (Int64 blocknr, Int64 nblocks, char* buf);
+    Int64 writeDirect (Int64 blocknr, Int64 nblocks, const char* buf);
+    // </group>
+
+    // Write a block to the underlying file.
+    void writeBlock (CachedBlock& block);
+
+    // Write all dirty blocks in the order of their offsets.
+    void writeDirty();
+
+
+    ByteIO*   file_p;
+    Int64     blockSize_p;
+    size_t    maxBlocks_p;
+    Int64     offset_p;
+    Int64     length_p;
+    uInt64    naccess_p;
+    uInt64    nmiss_p;
+    //# The blocks in order of use (most recently used first).
+    std::list<CachedBlock> lru_p;
+    std::unordered_map<Int64, std::list<CachedBlock>::iterator> index_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
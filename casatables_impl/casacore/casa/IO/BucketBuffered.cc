@@ -29,6 +29,7 @@
 #include <casacore/casa/IO/BucketBuffered.h>
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/IO/FilebufIO.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <cstring>   //# for memset
@@ -44,12 +45,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     AlwaysAssert (itsFile->bufferedFile() != 0, AipsError);
     // Allocate a buffer that can hold a bucket.
-    itsBuffer = new char[bucketSize];
+    itsBuffer = AlignedBufferPool::allocate (bucketSize);
   }
 
   BucketBuffered::~BucketBuffered()
   {
-    delete [] itsBuffer;
+    AlignedBufferPool::release (itsBuffer, itsBucketSize);
   }
 
   void BucketBuffered::read (uInt bucketNr, uInt bucketOffset, uInt nbytes,
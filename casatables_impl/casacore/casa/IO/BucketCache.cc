@@ -28,8 +28,12 @@
 
 //# Includes
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -74,8 +78,9 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
 	resize (1);
     }
     // Allocate a buffer (for data in external format).
+    // It is page-aligned to make direct I/O possible.
     // Initialize it to prevent "uninitialized memory errors" when writing.
-    its_Buffer = new char[bucketSize];
+    its_Buffer = AlignedBufferPool::allocate (bucketSize);
     for (uInt i=0; i<bucketSize; i++) {
 	its_Buffer[i] = 0;
     }
@@ -97,7 +102,7 @@ BucketCache::~BucketCache()
     // It is not flushed (that should have been done before).
     // In that way no needless flushes are done for a temporary table.
     clear (0, False);
-    delete [] its_Buffer;
+    AlignedBufferPool::release (its_Buffer, its_BucketSize);
 }
 
 void BucketCache::clear (uInt fromSlot, Bool doFlush)
@@ -125,14 +130,57 @@ Bool BucketCache::flush (uInt fromSlot)
     if (fromSlot == 0  &&  its_NewNrOfBuckets > 0) {
 	initializeBuckets (its_NewNrOfBuckets - 1);
     }
-    Bool hasWritten = False;
+    // Collect the dirty buckets and sort them on bucket number.
+    std::vector<std::pair<uInt,uInt> > dirty;
     for (uInt i=fromSlot; i<its_CacheSizeUsed; i++) {
 	if (its_Dirty[i]) {
-	    writeBucket (i);
-	    hasWritten = True;
+	    dirty.push_back (std::make_pair (its_BucketNr[i], i));
 	}
     }
-    return hasWritten;
+    if (dirty.empty()) {
+	return False;
+    }
+    std::sort (dirty.begin(), dirty.end());
+    // Runs of consecutive buckets are gathered in a buffer and written
+    // at once; the buffer is limited to about 4 MB. It is taken from the
+    // AlignedBufferPool, so it can be written directly if O_DIRECT is used.
+    uInt maxRun = std::max (1u, (4u*1024*1024) / its_BucketSize);
+    std::vector<size_t> runs;
+    size_t maxLength = 1;
+    for (size_t i=0; i<dirty.size(); ) {
+	size_t nr = 1;
+	while (i+nr < dirty.size()  &&  nr < maxRun  &&
+	       dirty[i+nr].first == dirty[i].first + nr) {
+	    nr++;
+	}
+	runs.push_back (nr);
+	maxLength = std::max (maxLength, nr);
+	i += nr;
+    }
+    std::unique_ptr<AlignedBuffer> runBuffer;
+    if (maxLength > 1) {
+	runBuffer.reset (new AlignedBuffer (maxLength * its_BucketSize));
+    }
+    size_t i = 0;
+    for (size_t nr : runs) {
+	if (nr == 1) {
+	    writeBucket (dirty[i].second);
+	} else {
+	    for (size_t j=0; j<nr; j++) {
+		uInt slotNr = dirty[i+j].second;
+		its_WriteCallBack (its_Owner,
+				   runBuffer->data() + j * its_BucketSize,
+				   its_Cache[slotNr]);
+		its_Dirty[slotNr] = 0;
+		nwrite_p++;
+	    }
+	    its_file->seek (its_StartOffset +
+			    Int64(dirty[i].first) * its_BucketSize);
+	    its_file->write (runBuffer->data(), nr * its_BucketSize);
+	}
+	i += nr;
+    }
+    return True;
 }
 
 void BucketCache::resize (uInt cacheSize)
@@ -341,6 +389,7 @@ void BucketCache::getSlot (uInt bucketNr)
 	    its_DeleteCallBack (its_Owner, its_Cache[its_ActualSlot]);
 	    its_Cache[its_ActualSlot] = 0;
 	    its_SlotNr[its_BucketNr[its_ActualSlot]] = -1;
+	    nevict_p++;
 	}
     }
     setLRU();
@@ -418,6 +467,7 @@ void BucketCache::initStatistics()
     nread_p   = 0;
     ninit_p   = 0;
     nwrite_p  = 0;
+    nevict_p  = 0;
 }
 
 } //# NAMESPACE CASACORE - END
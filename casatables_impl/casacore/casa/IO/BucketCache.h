@@ -237,6 +237,8 @@ public:
     // By default the entire cache is flushed.
     // When the entire cache is flushed, possible remaining uninitialized
     // buckets will be initialized first.
+    // The dirty buckets are written in order of their file offset, where
+    // consecutive buckets are written with a single write call.
     // A True status is returned when buckets had to be written.
     Bool flush (uInt fromSlot = 0);
 
@@ -319,6 +321,21 @@ public:
     // Show the statistics.
     void showStatistics (ostream& os) const;
 
+    // Get the statistics since they were last initialized: the number of
+    // bucket accesses, the number of buckets read from the file (i.e.
+    // cache misses), initialized, and written, and the number of buckets
+    // removed from the cache to make room for another one.
+    // <group>
+    uInt64 nAccess() const;
+    uInt64 nRead() const;
+    uInt64 nInit() const;
+    uInt64 nWrite() const;
+    uInt64 nEvict() const;
+    // </group>
+
+    // Get the bucket size.
+    uInt bucketSize() const;
+
 private:
     // The file used.
     BucketFile* its_file;
@@ -365,10 +382,11 @@ private:
     // The first free bucket (-1 = no free buckets).
     Int  its_FirstFree;
     // The statistics.
-    uInt naccess_p;
-    uInt nread_p;
-    uInt ninit_p;
-    uInt nwrite_p;
+    uInt64 naccess_p;
+    uInt64 nread_p;
+    uInt64 ninit_p;
+    uInt64 nwrite_p;
+    uInt64 nevict_p;
 
 
     // Copy constructor is not possible.
@@ -409,6 +427,24 @@ inline Int BucketCache::firstFreeBucket() const
 inline uInt BucketCache::nFreeBucket() const
     { return its_NrOfFree; }
 
+inline uInt64 BucketCache::nAccess() const
+    { return naccess_p; }
+
+inline uInt64 BucketCache::nRead() const
+    { return nread_p; }
+
+inline uInt64 BucketCache::nInit() const
+    { return ninit_p; }
+
+inline uInt64 BucketCache::nWrite() const
+    { return nwrite_p; }
+
+inline uInt64 BucketCache::nEvict() const
+    { return nevict_p; }
+
+inline uInt BucketCache::bucketSize() const
+    { return its_BucketSize; }
+
 
 
 
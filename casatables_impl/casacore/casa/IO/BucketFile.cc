@@ -32,12 +32,17 @@
 #include <casacore/casa/IO/MMapfdIO.h>
 #include <casacore/casa/IO/FilebufIO.h>
 #include <casacore/casa/IO/MFFileIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/IO/RegularFileIO.h>
+#include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/OS/Path.h>
 #include <casacore/casa/OS/DOos.h>
 #include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>                // needed for errno
@@ -56,10 +61,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 BucketFile::BucketFile (const String& fileName,
                         uInt bufSizeFile, Bool mappedFile,
-                        MultiFileBase* mfile)
+                        MultiFileBase* mfile, Bool useODirect)
 : name_p         (Path(fileName).expandedName()),
   isWritable_p   (True),
   isMapped_p     (mappedFile),
+  useODirect_p   (useODirect && !mappedFile),
   bufSize_p      (bufSizeFile),
   fd_p           (-1),
   file_p         (),
@@ -73,7 +79,7 @@ BucketFile::BucketFile (const String& fileName,
       isMapped_p = False;
       bufSize_p  = 0;
     } else {
-      fd_p   = FiledesIO::create (name_p.chars());
+      fd_p   = openFile (True);
       file_p = new FiledesIO (fd_p, name_p);
     }
     createMapBuf();
@@ -81,10 +87,11 @@ BucketFile::BucketFile (const String& fileName,
 
 BucketFile::BucketFile (const String& fileName, Bool isWritable,
                         uInt bufSizeFile, Bool mappedFile,
-                        MultiFileBase* mfile)
+                        MultiFileBase* mfile, Bool useODirect)
 : name_p         (Path(fileName).expandedName()),
   isWritable_p   (isWritable),
   isMapped_p     (mappedFile),
+  useODirect_p   (useODirect && !mappedFile),
   bufSize_p      (bufSizeFile),
   fd_p           (-1),
   file_p         (),
@@ -111,6 +118,59 @@ CountedPtr<ByteIO> BucketFile::makeFilebufIO (uInt bufferSize)
   return new FilebufIO (fd_p, bufferSize);
 }
 
+namespace {
+  // A readonly MemoryIO on a part of a memory-mapped file.
+  // It owns the mapping and the file descriptor.
+  class MappedPartIO : public MemoryIO
+  {
+  public:
+    MappedPartIO (int fd, void* map, size_t mapLength, Int64 skip,
+                  Int64 size)
+      : MemoryIO (static_cast<const char*>(map) + skip, size),
+        itsFd (fd), itsMap (map), itsMapLength (mapLength)
+      {}
+    virtual ~MappedPartIO()
+      {
+        ::munmap (itsMap, itsMapLength);
+        FiledesIO::close (itsFd);
+      }
+  private:
+    MappedPartIO (const MappedPartIO&);
+    MappedPartIO& operator= (const MappedPartIO&);
+    int    itsFd;
+    void*  itsMap;
+    size_t itsMapLength;
+  };
+}
+
+CountedPtr<ByteIO> BucketFile::makeMappedIO (Int64 offset)
+{
+  if (mfile_p) {
+    return CountedPtr<ByteIO>();
+  }
+  // Use a separate descriptor, because fd_p can be opened with O_DIRECT.
+  int fd = FiledesIO::open (name_p.chars(), False, False);
+  if (fd < 0) {
+    return CountedPtr<ByteIO>();
+  }
+  struct stat st;
+  if (::fstat (fd, &st) != 0  ||  offset < 0  ||  offset >= st.st_size) {
+    FiledesIO::close (fd);
+    return CountedPtr<ByteIO>();
+  }
+  // The offset of a mapping must be a multiple of the page size.
+  const Int64 pageSize = ::sysconf (_SC_PAGESIZE);
+  Int64 start = offset / pageSize * pageSize;
+  size_t mapLength = st.st_size - start;
+  void* map = ::mmap (0, mapLength, PROT_READ, MAP_SHARED, fd, start);
+  if (map == MAP_FAILED) {
+    FiledesIO::close (fd);
+    return CountedPtr<ByteIO>();
+  }
+  return new MappedPartIO (fd, map, mapLength, offset - start,
+                           st.st_size - offset);
+}
+
 
 void BucketFile::close()
 {
@@ -130,13 +190,25 @@ void BucketFile::open()
         file_p = new MFFileIO (*mfile_p, name_p,
                                isWritable_p ? ByteIO::Update : ByteIO::Old);
       } else {
-        fd_p   = FiledesIO::open (name_p.chars(), isWritable_p);
+        fd_p   = openFile (False);
         file_p = new FiledesIO (fd_p, name_p);
       }
       createMapBuf();
     }
 }
 
+int BucketFile::openFile (Bool create) const
+{
+    if (! useODirect_p) {
+        return (create  ?  FiledesIO::create (name_p.chars())
+                        :  FiledesIO::open (name_p.chars(), isWritable_p));
+    }
+    // RegularFileIO falls back to normal I/O if O_DIRECT cannot be used.
+    ByteIO::OpenOption opt = (create  ?  ByteIO::New :
+                              isWritable_p  ?  ByteIO::Update : ByteIO::Old);
+    return RegularFileIO::openCreate (RegularFile(name_p), opt, True);
+}
+
 void BucketFile::createMapBuf()
 {
     deleteMapBuf();
@@ -179,6 +251,24 @@ void BucketFile::fsync()
     file_p->fsync();
 }
 
+void BucketFile::fdatasync()
+{
+    if (fd_p < 0) {
+        file_p->fsync();
+    } else {
+#if defined(__APPLE__)
+        int res = ::fsync (fd_p);
+#else
+        int res = ::fdatasync (fd_p);
+#endif
+        if (res != 0) {
+            int error = errno;
+            throw AipsError ("BucketFile: error in fdatasync of file "
+                             + name_p + ": " + strerror(error));
+        }
+    }
+}
+
 
 void BucketFile::setRW()
 {
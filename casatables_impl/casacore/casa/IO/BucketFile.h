@@ -80,6 +80,11 @@ class MultiFileBase;
 //       the access using the FilebufIO member.
 // </ul>
 // A MultiFileBase file can only be accessed in the unbuffered way.
+// <br>An ordinary file accessed in the unbuffered or buffered way can be
+// opened with O_DIRECT (if supported by the OS and file system), so the
+// kernel's file cache is bypassed. It avoids that large scans evict the
+// cached data of other processes. The storage managers cache the data
+// themselves.
 // </synopsis> 
 
 // <motivation>
@@ -113,9 +118,11 @@ public:
     // It can be indicated if a MMapfdIO and/or FilebufIO object must be
     // created for the file. If a MultiFileBase is used, memory-mapped IO
     // cannot be used and mappedFile is ignored.
+    // <br>useODirect tells if an ordinary file that is not memory-mapped
+    // should be opened with O_DIRECT.
     explicit BucketFile (const String& fileName,
                          uInt bufSizeFile=0, Bool mappedFile=False,
-                         MultiFileBase* mfile=0);
+                         MultiFileBase* mfile=0, Bool useODirect=False);
 
     // Create a BucketFile object for an existing file.
     // The file should be opened by the <src>open</src>.
@@ -125,7 +132,7 @@ public:
     // cannot be used and mappedFile is ignored.
     BucketFile (const String& fileName, Bool writable,
                 uInt bufSizeFile=0, Bool mappedFile=False,
-                MultiFileBase* mfile=0);
+                MultiFileBase* mfile=0, Bool useODirect=False);
 
     // The destructor closes the file (if open).
     virtual ~BucketFile();
@@ -134,6 +141,19 @@ public:
     // That object should not close the file.
     virtual CountedPtr<ByteIO> makeFilebufIO (uInt bufferSize);
 
+    // Make a (temporary) readonly IO object for the part of the file from
+    // the given offset till its end, so that part can be read from a
+    // memory map without copying. Position 0 of the object is the given
+    // offset. Only that part is mapped, using a separate file descriptor
+    // that is not opened with O_DIRECT.
+    // <br>A null pointer is returned if the file cannot be mapped (e.g.
+    // because it is part of a MultiFileBase or the offset is beyond the
+    // end of the file).
+    // <br>The file must not be truncated or rewritten by other processes
+    // while the object exists (e.g. by holding a table lock), because
+    // accessing a mapping beyond the end of a file gives a bus error.
+    virtual CountedPtr<ByteIO> makeMappedIO (Int64 offset);
+
     // Get the mapped file object.
     MMapfdIO* mappedFile()
       { return mappedFile_p; }
@@ -154,6 +174,13 @@ public:
     // Fsync the file (i.e. force the data to be physically written).
     virtual void fsync();
 
+    // Fsync the data of the file, but not its metadata that is not needed
+    // to read the data back (such as the modification time).
+    // It is cheaper than <src>fsync</src> because usually no inode has to
+    // be written. A file in a MultiFileBase is fsync-ed as a whole.
+    // An exception is thrown if it fails.
+    virtual void fdatasync();
+
     // Set the file to read/write access. It is reopened if not writable.
     // It does nothing if the file is already writable.
     virtual void setRW();
@@ -193,6 +220,7 @@ private:
     // The (logical) writability of the file.
     Bool isWritable_p;
     Bool isMapped_p;
+    Bool useODirect_p;
     uInt bufSize_p;
     int  fd_p;    //  fd (if used) of unbuffered file
     // The unbuffered file.
@@ -211,6 +239,9 @@ private:
     // Forbid assignment.
     BucketFile& operator= (const BucketFile&);
 
+    // Create or open the ordinary file (with O_DIRECT if needed).
+    int openFile (Bool create) const;
+
     // Create the mapped or buffered file object.
     void createMapBuf();
 
@@ -56,6 +56,11 @@ void ByteIO::pwrite (Int64 size, Int64 offset, const void* buf)
     doSeek(cur, ByteIO::Begin);
 }
 
+const void* ByteIO::readView (Int64)
+{
+    return 0;
+}
+
 Int64 ByteIO::pread (Int64 size, Int64 offset, void* buf,
                      Bool throwException)
 {
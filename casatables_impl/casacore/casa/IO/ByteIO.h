@@ -111,6 +111,16 @@ public:
     // The file offset is not changed
     virtual Int64 pread (Int64 size, Int64 offset, void* buf, Bool throwException=True);
 
+    // Get a pointer to the next <src>size</src> bytes and move the position
+    // beyond them, if the data of the byte stream are directly addressable
+    // (e.g., a memory-mapped file). Otherwise, or if fewer than
+    // <src>size</src> bytes are left, a null pointer is returned and the
+    // position is not changed. It makes it possible to read data without
+    // copying them.
+    // <br>The pointer is valid until the stream is written or closed.
+    // The default implementation returns a null pointer.
+    virtual const void* readView (Int64 size);
+
     // Reopen the underlying IO stream for read/write access.
     // Nothing will be done if the stream is writable already.
     // Otherwise it will be reopened and an exception will be thrown
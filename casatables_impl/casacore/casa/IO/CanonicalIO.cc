@@ -271,7 +271,10 @@ size_t CanonicalIO::read (size_t nvalues, Bool* value)
 size_t CanonicalIO::read (size_t nvalues, Char* value)
 {
     if (CONVERT_CAN_CHAR) {
-	if (nvalues * SIZE_CAN_CHAR <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_CHAR);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_CHAR <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_CHAR, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -289,7 +292,10 @@ size_t CanonicalIO::read (size_t nvalues, Char* value)
 size_t CanonicalIO::read (size_t nvalues, uChar* value)
 {
     if (CONVERT_CAN_UCHAR) {
-	if (nvalues * SIZE_CAN_UCHAR <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_UCHAR);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_UCHAR <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_UCHAR, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -307,7 +313,10 @@ size_t CanonicalIO::read (size_t nvalues, uChar* value)
 size_t CanonicalIO::read (size_t nvalues, Short* value)
 {
     if (CONVERT_CAN_SHORT) {
-	if (nvalues * SIZE_CAN_SHORT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_SHORT);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_SHORT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_SHORT, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -325,7 +334,10 @@ size_t CanonicalIO::read (size_t nvalues, Short* value)
 size_t CanonicalIO::read (size_t nvalues, uShort* value)
 {
     if (CONVERT_CAN_USHORT) {
-	if (nvalues * SIZE_CAN_USHORT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_USHORT);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_USHORT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_USHORT, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -343,7 +355,10 @@ size_t CanonicalIO::read (size_t nvalues, uShort* value)
 size_t CanonicalIO::read (size_t nvalues, Int* value)
 {
     if (CONVERT_CAN_INT) {
-	if (nvalues * SIZE_CAN_INT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_INT);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_INT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_INT, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -361,7 +376,10 @@ size_t CanonicalIO::read (size_t nvalues, Int* value)
 size_t CanonicalIO::read (size_t nvalues, uInt* value)
 {
     if (CONVERT_CAN_UINT) {
-	if (nvalues * SIZE_CAN_UINT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_UINT);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_UINT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_UINT, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -379,7 +397,10 @@ size_t CanonicalIO::read (size_t nvalues, uInt* value)
 size_t CanonicalIO::read (size_t nvalues, Int64* value)
 {
     if (CONVERT_CAN_INT64) {
-	if (nvalues * SIZE_CAN_INT64 <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_INT64);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_INT64 <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_INT64, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -397,7 +418,10 @@ size_t CanonicalIO::read (size_t nvalues, Int64* value)
 size_t CanonicalIO::read (size_t nvalues, uInt64* value)
 {
     if (CONVERT_CAN_UINT64) {
-	if (nvalues * SIZE_CAN_UINT64 <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_UINT64);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_UINT64 <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_UINT64, itsBuffer);
 	    CanonicalConversion::toLocal(value, itsBuffer, nvalues);
 	} else {
@@ -415,7 +439,10 @@ size_t CanonicalIO::read (size_t nvalues, uInt64* value)
 size_t CanonicalIO::read (size_t nvalues, float* value)
 {
     if (CONVERT_CAN_FLOAT) {
-	if (nvalues * SIZE_CAN_FLOAT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_FLOAT);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_FLOAT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_FLOAT, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -433,7 +460,10 @@ size_t CanonicalIO::read (size_t nvalues, float* value)
 size_t CanonicalIO::read (size_t nvalues, double* value)
 {
     if (CONVERT_CAN_DOUBLE) {
-	if (nvalues * SIZE_CAN_DOUBLE <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_CAN_DOUBLE);
+	if (mapped != 0) {
+	    CanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_CAN_DOUBLE <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_CAN_DOUBLE, itsBuffer);
 	    CanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -463,5 +493,35 @@ size_t CanonicalIO::read (size_t nvalues, String* value)
     return TypeIO::read (nvalues, value);
 }
 
+Bool CanonicalIO::isLocalFormat (DataType dtype) const
+{
+    switch (dtype) {
+    case TpChar:
+	return !CONVERT_CAN_CHAR;
+    case TpUChar:
+	return !CONVERT_CAN_UCHAR;
+    case TpShort:
+	return !CONVERT_CAN_SHORT;
+    case TpUShort:
+	return !CONVERT_CAN_USHORT;
+    case TpInt:
+	return !CONVERT_CAN_INT;
+    case TpUInt:
+	return !CONVERT_CAN_UINT;
+    case TpInt64:
+	return !CONVERT_CAN_INT64;
+    case TpFloat:
+	return !CONVERT_CAN_FLOAT;
+    case TpDouble:
+	return !CONVERT_CAN_DOUBLE;
+    case TpComplex:
+	return !CONVERT_CAN_FLOAT  &&  sizeof(Complex) == 2*sizeof(Float);
+    case TpDComplex:
+	return !CONVERT_CAN_DOUBLE  &&  sizeof(DComplex) == 2*sizeof(Double);
+    default:
+	return False;
+    }
+}
+
 } //# NAMESPACE CASACORE - END
 
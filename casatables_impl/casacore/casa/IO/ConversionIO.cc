@@ -164,7 +164,10 @@ size_t ConversionIO::read (size_t nvalues, T* value) \
     if (aips_name2(itsCopy,T)) { \
 	itsByteIO->read (size, value); \
     } else { \
-	if (size <= itsBufferLength) { \
+	const void* mapped = itsByteIO->readView (size); \
+	if (mapped != 0) { \
+	    itsConversion->toLocal (value, mapped, nvalues); \
+	} else if (size <= itsBufferLength) { \
 	    itsByteIO->read (size, itsBuffer); \
 	    itsConversion->toLocal (value, itsBuffer, nvalues); \
 	} else { \
@@ -189,5 +192,35 @@ CONVERSIONIO_DOIT(uInt64)
 CONVERSIONIO_DOIT(Float)
 CONVERSIONIO_DOIT(Double)
 
+Bool ConversionIO::isLocalFormat (DataType dtype) const
+{
+    switch (dtype) {
+    case TpChar:
+	return itsCopyChar;
+    case TpUChar:
+	return itsCopyuChar;
+    case TpShort:
+	return itsCopyShort;
+    case TpUShort:
+	return itsCopyuShort;
+    case TpInt:
+	return itsCopyInt;
+    case TpUInt:
+	return itsCopyuInt;
+    case TpInt64:
+	return itsCopyInt64;
+    case TpFloat:
+	return itsCopyFloat;
+    case TpDouble:
+	return itsCopyDouble;
+    case TpComplex:
+	return itsCopyFloat  &&  sizeof(Complex) == 2*sizeof(Float);
+    case TpDComplex:
+	return itsCopyDouble  &&  sizeof(DComplex) == 2*sizeof(Double);
+    default:
+	return False;
+    }
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -137,6 +137,9 @@ public:
     virtual size_t read (size_t nvalues, String* value);
     // </group>
 
+    // Tell if values of the given data type are stored in local format.
+    virtual Bool isLocalFormat (DataType dtype) const;
+
 private:
     // Initialize the <src>itsSize</src> and <src>itsCopy</src> variables.
     void init();
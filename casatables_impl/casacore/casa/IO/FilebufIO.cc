@@ -28,10 +28,13 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/LargeIOFuncDef.h>
 #include <casacore/casa/IO/FilebufIO.h>
+#include <casacore/casa/IO/FiledesIO.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <algorithm>
 #include <errno.h>                     // needed for errno
 #include <casacore/casa/string.h>               // needed for strerror
 
@@ -42,6 +45,8 @@ FilebufIO::FilebufIO()
 : itsSeekable   (False),
   itsReadable   (False),
   itsWritable   (False),
+  itsDirect     (False),
+  itsAlign      (0),
   itsFile       (-1),
   itsBufSize    (0),
   itsBufLen     (0),
@@ -53,7 +58,9 @@ FilebufIO::FilebufIO()
 {}
 
 FilebufIO::FilebufIO (int fd, uInt bufferSize)
-: itsFile       (-1),
+: itsDirect     (False),
+  itsAlign      (0),
+  itsFile       (-1),
   itsBufSize    (0),
   itsBufLen     (0),
   itsBuffer     (0),
@@ -87,14 +94,20 @@ void FilebufIO::setBuffer (Int64 bufSize)
 {
   if (itsBuffer) {
     flush();
-    delete [] itsBuffer;
+    AlignedBufferPool::release (itsBuffer, itsBufSize);
     itsBuffer    = 0;
     itsBufSize   = 0;
     itsBufLen    = 0;
     itsBufOffset = -1;
   }
   if (bufSize > 0) {
-    itsBuffer  = new char[bufSize];
+    // Keep the buffers aligned for direct I/O.
+    if (itsDirect) {
+      const Int64 align = std::max (itsAlign,
+                                    Int64(AlignedBufferPool::alignment()));
+      bufSize = (bufSize + align - 1) / align * align;
+    }
+    itsBuffer  = AlignedBufferPool::allocate (bufSize);
     itsBufSize = bufSize;
     itsBufOffset = -Int(itsBufSize+1);
   }
@@ -122,6 +135,11 @@ void FilebufIO::fillRWFlags (int fd)
   } else {
     itsReadable = True;
   }
+  itsDirect = False;
+#ifdef HAVE_O_DIRECT
+  itsDirect = (flags & O_DIRECT) != 0;
+#endif
+  itsAlign = (itsDirect  ?  FiledesIO::directAlignment (fd) : 0);
 }
 
 void FilebufIO::fillSeekable()
@@ -146,6 +164,16 @@ void FilebufIO::flush()
   }
 }
 
+void FilebufIO::fsync()
+{
+  flush();
+  if (itsFile >= 0  &&  ::fsync (itsFile) != 0) {
+    int error = errno;
+    throw AipsError ("FilebufIO: error in fsync of file "
+                     + fileName() + ": " + strerror(error));
+  }
+}
+
 void FilebufIO::resync()
 {
   AlwaysAssert (!itsDirty, AipsError);
@@ -158,7 +186,14 @@ void FilebufIO::resync()
 
 void FilebufIO::writeBuffer (Int64 offset, const char* buf, Int64 size)
 {
-  if (size > 0) {
+  if (size > 0  &&  itsDirect) {
+    // Direct I/O does not use the file offset.
+    if (FiledesIO::pwriteDirect (itsFile, size, offset, buf, itsAlign) != size) {
+      int error = errno;
+      throw AipsError (String("FilebufIO: write error for file ")
+		       + fileName() + ": " + strerror(error));
+    }
+  } else if (size > 0) {
     if (offset != itsSeekOffset) {
       ::traceLSEEK (itsFile, offset, SEEK_SET);
       itsSeekOffset = offset;
@@ -176,11 +211,18 @@ void FilebufIO::writeBuffer (Int64 offset, const char* buf, Int64 size)
 Int64 FilebufIO::readBuffer (Int64 offset, char* buf, Int64 size,
                                   Bool throwException)
 {
-  if (offset != itsSeekOffset) {
-    ::traceLSEEK (itsFile, offset, SEEK_SET);
-    itsSeekOffset = offset;
+  Int64 bytesRead;
+  if (itsDirect) {
+    // Direct I/O does not use the file offset.
+    itsSeekOffset = -1;
+    bytesRead = FiledesIO::preadDirect (itsFile, size, offset, buf, itsAlign);
+  } else {
+    if (offset != itsSeekOffset) {
+      ::traceLSEEK (itsFile, offset, SEEK_SET);
+      itsSeekOffset = offset;
+    }
+    bytesRead = ::traceREAD (itsFile, buf, size);
   }
-  Int64 bytesRead = ::traceREAD (itsFile, buf, size);
   int error = errno;
   if (bytesRead > Int(size)) { // Should never be executed
     itsSeekOffset = -1;
@@ -205,7 +247,9 @@ Int64 FilebufIO::readBuffer (Int64 offset, char* buf, Int64 size,
                        + fileName());
     }
   }
-  itsSeekOffset += bytesRead;
+  if (!itsDirect) {
+    itsSeekOffset += bytesRead;
+  }
   return bytesRead;
 }
 
@@ -63,6 +63,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // from a file descriptor (e.g. for a pipe or socket).
 // The constructor will determine automatically if the file is
 // readable, writable and seekable.
+// <br>The buffer is taken from the
+// <linkto class=AlignedBufferPool>AlignedBufferPool</linkto>. If the file
+// was opened with O_DIRECT, the buffer size is rounded up to a multiple of
+// the page size and the I/O is done as explained in
+// <linkto class=FiledesIO>FiledesIO</linkto>.
 // </synopsis>
 
 // <example>
@@ -125,6 +130,10 @@ public:
     // Flush the current buffer.
     virtual void flush();
 
+    // Flush the current buffer and fsync the file.
+    // An exception is thrown if the fsync fails.
+    virtual void fsync();
+
     // Resync the file (i.e. empty the current buffer).
     virtual void resync();
   
@@ -184,6 +193,8 @@ private:
     Bool        itsSeekable;
     Bool        itsReadable;
     Bool        itsWritable;
+    Bool        itsDirect;           // file opened with O_DIRECT?
+    Int64       itsAlign;            // alignment needed for direct I/O
     int         itsFile;
     Int64       itsBufSize;          // the buffer size
     Int64       itsBufLen;           // the current buffer length used
@@ -28,10 +28,15 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/LargeIOFuncDef.h>
 #include <casacore/casa/IO/FiledesIO.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
+#include <casacore/casa/OS/File.h>     // for fileFSTAT
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstring>
 #include <errno.h>                     // needed for errno
 #include <casacore/casa/string.h>               // needed for strerror
 
@@ -42,6 +47,8 @@ FiledesIO::FiledesIO()
 : itsSeekable (False),
   itsReadable (False),
   itsWritable (False),
+  itsDirect   (False),
+  itsAlign    (0),
   itsFile     (-1)
 {}
 
@@ -84,6 +91,11 @@ void FiledesIO::fillRWFlags (int fd)
     } else {
 	itsReadable = True;
     }
+    itsDirect = False;
+#ifdef HAVE_O_DIRECT
+    itsDirect = (flags & O_DIRECT) != 0;
+#endif
+    itsAlign = (itsDirect  ?  directAlignment (fd) : 0);
 }
 
 void FiledesIO::fillSeekable()
@@ -99,7 +111,17 @@ void FiledesIO::write (Int64 size, const void* buf)
 	throw AipsError ("FiledesIO::write - " + itsFileName
                          + " is not writable");
     }
-    if (::traceWRITE(itsFile, (Char *)buf, size) != size) {
+    Int64 nw;
+    if (itsDirect) {
+        Int64 offset = ::traceLSEEK (itsFile, 0, SEEK_CUR);
+        nw = pwriteDirect (itsFile, size, offset, buf, itsAlign);
+        if (nw > 0) {
+            ::traceLSEEK (itsFile, offset + nw, SEEK_SET);
+        }
+    } else {
+        nw = ::traceWRITE(itsFile, (Char *)buf, size);
+    }
+    if (nw != size) {
         int error = errno;
 	throw AipsError ("FiledesIO::write - write error in "
                          + itsFileName + ": " + strerror(error));
@@ -114,7 +136,9 @@ void FiledesIO::pwrite (Int64 size, Int64 offset, const void* buf)
 	throw AipsError ("FiledesIO::pwrite - " + itsFileName
                          + " is not writable");
     }
-    if (::tracePWRITE(itsFile, (Char *)buf, size, offset) != size) {
+    Int64 nw = (itsDirect  ?  pwriteDirect (itsFile, size, offset, buf, itsAlign)
+                :  ::tracePWRITE(itsFile, (Char *)buf, size, offset));
+    if (nw != size) {
         int error = errno;
 	throw AipsError ("FiledesIO::pwrite - write error in "
                          + itsFileName + ": " + strerror(error));
@@ -128,7 +152,16 @@ Int64 FiledesIO::read (Int64 size, void* buf, Bool throwException)
     throw AipsError ("FiledesIO::read " + itsFileName
                      + " - is not readable");
   }
-  Int64 bytesRead = ::traceREAD (itsFile, (Char *)buf, size);
+  Int64 bytesRead;
+  if (itsDirect) {
+    Int64 offset = ::traceLSEEK (itsFile, 0, SEEK_CUR);
+    bytesRead = preadDirect (itsFile, size, offset, buf, itsAlign);
+    if (bytesRead > 0) {
+      ::traceLSEEK (itsFile, offset + bytesRead, SEEK_SET);
+    }
+  } else {
+    bytesRead = ::traceREAD (itsFile, (Char *)buf, size);
+  }
   int error = errno;
   if (bytesRead > size) { // Should never be executed
     throw AipsError ("FiledesIO::read " + itsFileName
@@ -156,7 +189,8 @@ Int64 FiledesIO::pread (Int64 size, Int64 offset, void* buf, Bool throwException
     throw AipsError ("FiledesIO::pread " + itsFileName
                      + " - is not readable");
   }
-  Int64 bytesRead = ::tracePREAD (itsFile, (Char *)buf, size, offset);
+  Int64 bytesRead = (itsDirect  ?  preadDirect (itsFile, size, offset, buf, itsAlign)
+                     :  ::tracePREAD (itsFile, (Char *)buf, size, offset));
   int error = errno;
   if (bytesRead > size) { // Should never be executed
     throw AipsError ("FiledesIO::pread " + itsFileName
@@ -229,7 +263,11 @@ String FiledesIO::fileName() const
 
 void FiledesIO::fsync()
 {
-    ::fsync (itsFile);
+    if (::fsync (itsFile) != 0) {
+        int error = errno;
+        throw AipsError ("FiledesIO: error in fsync of file "
+                         + itsFileName + ": " + strerror(error));
+    }
 }
 
 int FiledesIO::create (const Char* name, int mode)
@@ -259,6 +297,111 @@ int FiledesIO::open (const Char* name, Bool writable, Bool throwExcp)
     return fd;
 }
 
+namespace {
+  // Tell if direct I/O can be done without an intermediate buffer.
+  inline Bool isAligned (Int64 size, Int64 offset, const void* buf,
+                         Int64 align)
+  {
+    return size % align == 0  &&  offset % align == 0
+      &&  reinterpret_cast<size_t>(buf) % align == 0;
+  }
+
+  // Read a block into buf, filling the part past end-of-file with zeroes.
+  Bool readPage (int fd, Int64 offset, char* buf, Int64 align)
+  {
+    Int64 nr = ::tracePREAD (fd, buf, align, offset);
+    if (nr < 0) {
+      return False;
+    }
+    memset (buf + nr, 0, align - nr);
+    return True;
+  }
+}
+
+Int64 FiledesIO::directAlignment (int fd)
+{
+  //# Use the alignment reported by the file system (Linux 6.1 and later).
+  //# The buffers of the pool are aligned on a page, so a larger memory
+  //# alignment cannot be used.
+#ifdef STATX_DIOALIGN
+  struct statx stx;
+  if (::statx (fd, "", AT_EMPTY_PATH, STATX_DIOALIGN, &stx) == 0
+      &&  (stx.stx_mask & STATX_DIOALIGN) != 0
+      &&  stx.stx_dio_offset_align > 0) {
+    Int64 align = std::max (stx.stx_dio_offset_align, stx.stx_dio_mem_align);
+    if (align <= Int64(AlignedBufferPool::alignment())) {
+      return align;
+    }
+  }
+#else
+  (void)fd;
+#endif
+  return AlignedBufferPool::alignment();
+}
+
+Int64 FiledesIO::preadDirect (int fd, Int64 size, Int64 offset, void* buf,
+                              Int64 align)
+{
+  if (align <= 0) {
+    align = AlignedBufferPool::alignment();
+  }
+  if (isAligned (size, offset, buf, align)) {
+    return ::tracePREAD (fd, (Char*)buf, size, offset);
+  }
+  Int64 start = offset / align * align;
+  Int64 end   = (offset + size + align - 1) / align * align;
+  AlignedBuffer tmp(end - start);
+  Int64 nr = ::tracePREAD (fd, tmp.data(), end - start, start);
+  if (nr < 0) {
+    return nr;
+  }
+  nr = std::max (Int64(0), std::min (size, nr - (offset - start)));
+  memcpy (buf, tmp.data() + (offset - start), nr);
+  return nr;
+}
+
+Int64 FiledesIO::pwriteDirect (int fd, Int64 size, Int64 offset,
+                               const void* buf, Int64 align)
+{
+  if (align <= 0) {
+    align = AlignedBufferPool::alignment();
+  }
+  if (isAligned (size, offset, buf, align)) {
+    return ::tracePWRITE (fd, (Char*)buf, size, offset);
+  }
+  Int64 start = offset / align * align;
+  Int64 end   = (offset + size + align - 1) / align * align;
+  AlignedBuffer tmp(end - start);
+  // Fill the partial pages at the edges with the current contents.
+  if (offset > start) {
+    if (! readPage (fd, start, tmp.data(), align)) {
+      return -1;
+    }
+  }
+  if (offset + size < end  &&  (end - align > start  ||  offset == start)) {
+    if (! readPage (fd, end - align, tmp.data() + (end - align - start),
+                    align)) {
+      return -1;
+    }
+  }
+  memcpy (tmp.data() + (offset - start), buf, size);
+  // Get the file size to be able to cut off the padding written past it.
+  struct fileSTAT sfs;
+  if (offset + size < end  &&  ::fileFSTAT (fd, &sfs) != 0) {
+    return -1;
+  }
+  Int64 nw = ::tracePWRITE (fd, tmp.data(), end - start, start);
+  if (nw != end - start) {
+    return (nw < 0  ?  nw : std::max (Int64(0), nw - (offset - start)));
+  }
+  if (offset + size < end  &&  end > Int64(sfs.st_size)) {
+    if (::ftruncate (fd, std::max (Int64(sfs.st_size), offset + size)) != 0) {
+      return -1;
+    }
+  }
+  return size;
+}
+
 void FiledesIO::close (int fd)
 {
   if (fd >= 0) {
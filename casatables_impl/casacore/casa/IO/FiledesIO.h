@@ -59,6 +59,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // The constructor will determine automatically if the file is
 // readable, writable and seekable.
 // Note that on destruction the file descriptor is NOT closed.
+// <p>
+// If the file was opened with O_DIRECT, offsets, sizes and buffers have
+// to be aligned on the (logical) block size of the device. In that case
+// FiledesIO does unaligned I/O through a page-aligned buffer taken from
+// the <linkto class=AlignedBufferPool>AlignedBufferPool</linkto>, so it
+// can be used in the same way as for other files.
 // </synopsis>
 
 // <example>
@@ -146,6 +152,7 @@ public:
     virtual String fileName() const;
 
     // Fsync the file (i.e. force the data to be physically written).
+    // An exception is thrown if the fsync fails.
     virtual void fsync();
 
     // Some static convenience functions for file create/open/close.
@@ -157,6 +164,39 @@ public:
     static void close (int fd);
     // </group>
 
+    // Read or write at the given offset in a file opened with O_DIRECT.
+    // The I/O is done through an aligned buffer unless the offset,
+    // size and buffer are a multiple of <src>align</src> (as returned by
+    // <src>directAlignment</src>; 0 means the page size). The partial
+    // blocks at the edges of a write are read first and the file is
+    // truncated to its logical size if the write extends it. The number of
+    // bytes read or written is returned (-1 with errno set in case of an
+    // error).
+    // <br>Note that this read-modify-write of the edge blocks is not atomic:
+    // data written meanwhile by another writer to the same blocks can get
+    // lost. Writers of the same file have to write disjoint blocks (as
+    // MultiFile and BucketCache do) or serialize their writes.
+    // <group>
+    static Int64 preadDirect (int fd, Int64 size, Int64 offset, void* buf,
+                              Int64 align = 0);
+    static Int64 pwriteDirect (int fd, Int64 size, Int64 offset,
+                               const void* buf, Int64 align = 0);
+    // </group>
+
+    // Get the alignment of offset, size and memory needed for direct I/O
+    // on the file. It is obtained from the file system if it tells it
+    // (using statx), otherwise the page size is used.
+    static Int64 directAlignment (int fd);
+
+    // Get the alignment needed for direct I/O (0 if not opened with
+    // O_DIRECT).
+    Int64 directAlign() const
+      { return itsAlign; }
+
+    // Tell if the file was opened with O_DIRECT.
+    Bool isDirect() const
+      { return itsDirect; }
+
 
 protected:
     // Get the file descriptor.
@@ -177,6 +217,8 @@ private:
     Bool   itsSeekable;
     Bool   itsReadable;
     Bool   itsWritable;
+    Bool   itsDirect;
+    Int64  itsAlign;                 //# alignment needed for direct I/O
     int    itsFile;
     String itsFileName;
 
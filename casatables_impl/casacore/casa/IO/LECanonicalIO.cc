@@ -271,7 +271,10 @@ size_t LECanonicalIO::read (size_t nvalues, Bool* value)
 size_t LECanonicalIO::read (size_t nvalues, Char* value)
 {
     if (CONVERT_LECAN_CHAR) {
-	if (nvalues * SIZE_LECAN_CHAR <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_CHAR);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_CHAR <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_CHAR, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -289,7 +292,10 @@ size_t LECanonicalIO::read (size_t nvalues, Char* value)
 size_t LECanonicalIO::read (size_t nvalues, uChar* value)
 {
     if (CONVERT_LECAN_UCHAR) {
-	if (nvalues * SIZE_LECAN_UCHAR <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_UCHAR);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_UCHAR <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_UCHAR, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -307,7 +313,10 @@ size_t LECanonicalIO::read (size_t nvalues, uChar* value)
 size_t LECanonicalIO::read (size_t nvalues, Short* value)
 {
     if (CONVERT_LECAN_SHORT) {
-	if (nvalues * SIZE_LECAN_SHORT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_SHORT);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_SHORT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_SHORT, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -325,7 +334,10 @@ size_t LECanonicalIO::read (size_t nvalues, Short* value)
 size_t LECanonicalIO::read (size_t nvalues, uShort* value)
 {
     if (CONVERT_LECAN_USHORT) {
-	if (nvalues * SIZE_LECAN_USHORT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_USHORT);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_USHORT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_USHORT, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -343,7 +355,10 @@ size_t LECanonicalIO::read (size_t nvalues, uShort* value)
 size_t LECanonicalIO::read (size_t nvalues, Int* value)
 {
     if (CONVERT_LECAN_INT) {
-	if (nvalues * SIZE_LECAN_INT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_INT);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_INT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_INT, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -361,7 +376,10 @@ size_t LECanonicalIO::read (size_t nvalues, Int* value)
 size_t LECanonicalIO::read (size_t nvalues, uInt* value)
 {
     if (CONVERT_LECAN_UINT) {
-	if (nvalues * SIZE_LECAN_UINT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_UINT);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_UINT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_UINT, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -379,7 +397,10 @@ size_t LECanonicalIO::read (size_t nvalues, uInt* value)
 size_t LECanonicalIO::read (size_t nvalues, Int64* value)
 {
     if (CONVERT_LECAN_INT64) {
-	if (nvalues * SIZE_LECAN_INT64 <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_INT64);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_INT64 <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_INT64, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -397,7 +418,10 @@ size_t LECanonicalIO::read (size_t nvalues, Int64* value)
 size_t LECanonicalIO::read (size_t nvalues, uInt64* value)
 {
     if (CONVERT_LECAN_UINT64) {
-	if (nvalues * SIZE_LECAN_UINT64 <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_UINT64);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_UINT64 <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_UINT64, itsBuffer);
 	    LECanonicalConversion::toLocal(value, itsBuffer, nvalues);
 	} else {
@@ -415,7 +439,10 @@ size_t LECanonicalIO::read (size_t nvalues, uInt64* value)
 size_t LECanonicalIO::read (size_t nvalues, float* value)
 {
     if (CONVERT_LECAN_FLOAT) {
-	if (nvalues * SIZE_LECAN_FLOAT <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_FLOAT);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_FLOAT <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_FLOAT, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -433,7 +460,10 @@ size_t LECanonicalIO::read (size_t nvalues, float* value)
 size_t LECanonicalIO::read (size_t nvalues, double* value)
 {
     if (CONVERT_LECAN_DOUBLE) {
-	if (nvalues * SIZE_LECAN_DOUBLE <= itsBufferLength) {
+	const void* mapped = itsByteIO->readView (nvalues * SIZE_LECAN_DOUBLE);
+	if (mapped != 0) {
+	    LECanonicalConversion::toLocal (value, mapped, nvalues);
+	} else if (nvalues * SIZE_LECAN_DOUBLE <= itsBufferLength) {
 	    itsByteIO->read (nvalues * SIZE_LECAN_DOUBLE, itsBuffer);
 	    LECanonicalConversion::toLocal (value, itsBuffer, nvalues);
 	} else {
@@ -463,5 +493,35 @@ size_t LECanonicalIO::read (size_t nvalues, String* value)
     return TypeIO::read (nvalues, value);
 }
 
+Bool LECanonicalIO::isLocalFormat (DataType dtype) const
+{
+    switch (dtype) {
+    case TpChar:
+	return !CONVERT_LECAN_CHAR;
+    case TpUChar:
+	return !CONVERT_LECAN_UCHAR;
+    case TpShort:
+	return !CONVERT_LECAN_SHORT;
+    case TpUShort:
+	return !CONVERT_LECAN_USHORT;
+    case TpInt:
+	return !CONVERT_LECAN_INT;
+    case TpUInt:
+	return !CONVERT_LECAN_UINT;
+    case TpInt64:
+	return !CONVERT_LECAN_INT64;
+    case TpFloat:
+	return !CONVERT_LECAN_FLOAT;
+    case TpDouble:
+	return !CONVERT_LECAN_DOUBLE;
+    case TpComplex:
+	return !CONVERT_LECAN_FLOAT  &&  sizeof(Complex) == 2*sizeof(Float);
+    case TpDComplex:
+	return !CONVERT_LECAN_DOUBLE  &&  sizeof(DComplex) == 2*sizeof(Double);
+    default:
+	return False;
+    }
+}
+
 } //# NAMESPACE CASACORE - END
 
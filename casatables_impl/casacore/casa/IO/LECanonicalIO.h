@@ -131,6 +131,9 @@ public:
     virtual size_t read (size_t nvalues, String* value);
     // </group>
 
+    // Tell if values of the given data type are stored in local format.
+    virtual Bool isLocalFormat (DataType dtype) const;
+
 private:
     //# The buffer
     char* itsBuffer;
@@ -30,6 +30,7 @@
 #include <casacore/casa/IO/FiledesIO.h>
 #include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
+#include <casacore/casa/IO/SharedMemoryLock.h>
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/OS/Path.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
@@ -37,6 +38,7 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/sstream.h>
 
@@ -73,9 +75,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 LockFile::LockFile (const String& fileName, double inspectInterval,
 		    Bool create, Bool setRequestFlag, Bool mustExist,
-		    uInt seqnr, Bool permLocking, Bool noLocking)
+		    uInt seqnr, Bool permLocking, Bool noLocking,
+		    Bool sharedMemory)
 : itsFileIO      (0),
   itsCanIO       (0),
+  itsShm         (0),
   itsWritable    (True),
   itsAddToList   (setRequestFlag),
   itsInterval    (inspectInterval),
@@ -135,12 +139,26 @@ LockFile::LockFile (const String& fileName, double inspectInterval,
         itsCanIO  = new CanonicalIO (itsFileIO);
         // Set the file to in use by acquiring a read lock.
         itsUseLocker.acquire (FileLocker::Read, 1);
+        if (sharedMemory) {
+          itsShm = SharedMemoryLock::attach (fd, seqnr);
+        }
       }
     }
 }
 
 LockFile::~LockFile()
 {
+    if (itsShm != 0) {
+        //# Always remove the segment name, so it cannot be left behind
+        //# (e.g. if the lock file is readonly, the in-use lock cannot be
+        //# converted to a write lock to test if other processes use it).
+        //# Processes still using the segment keep it mapped. A process
+        //# attaching hereafter creates a new segment, which is harmless
+        //# because the fcntl lock remains the actual lock and the request
+        //# list in the lock file is still inspected once per second.
+        itsShm->remove();
+        delete itsShm;
+    }
     delete itsCanIO;
     delete itsFileIO;
     int fd = itsLocker.fd();
@@ -177,7 +195,11 @@ Bool LockFile::acquire (MemoryIO* info, FileLocker::LockType type,
 	    addReqId();
 	    added = True;
 	}
-	succ = itsLocker.acquire (type, nattempts);
+	if (itsShm != 0) {
+	    succ = acquireShared (type, nattempts);
+	} else {
+	    succ = itsLocker.acquire (type, nattempts);
+	}
     }
     //# Do not read info if we did not acquire the lock.
     if (!succ) {
@@ -212,7 +234,50 @@ Bool LockFile::release (const MemoryIO* info)
     if (info != 0) {
 	putInfo (*info);
     }
-    return itsLocker.release();
+    Bool succ = itsLocker.release();
+    if (itsShm != 0) {
+	itsShm->wake();
+    }
+    return succ;
+}
+
+Bool LockFile::acquireShared (FileLocker::LockType type, uInt nattempts)
+{
+    //# Register as waiter, so the process holding the lock sees it
+    //# in inspect. Retry when a lock is released on this host, but at
+    //# least every second for locks held by processes not using the segment.
+    //# As in FileLocker, nattempts-1 is the maximum wait time.
+    //# If all slots are in use, wait in the usual way.
+    Int slot = itsShm->addWaiter();
+    if (slot < 0) {
+	return itsLocker.acquire (type, nattempts);
+    }
+    Time start;
+    Bool succ = False;
+    while (True) {
+	uInt count = itsShm->releaseCount();
+	if (itsLocker.acquire (type, 1)) {
+	    succ = True;
+	    break;
+	}
+	if (itsLocker.lastError() != EAGAIN
+        &&  itsLocker.lastError() != EACCES) {
+	    break;
+	}
+	double wait = 1;
+	if (nattempts > 0) {
+	    wait = nattempts - 1 - start.age();
+	    if (wait <= 0) {
+		break;
+	    }
+	    if (wait > 1) {
+		wait = 1;
+	    }
+	}
+	itsShm->wait (count, wait);
+    }
+    itsShm->removeWaiter (slot);
+    return succ;
 }
 
 Bool LockFile::inspect (Bool always)
@@ -221,17 +286,29 @@ Bool LockFile::inspect (Bool always)
     if (itsFileIO == 0) {
 	return False;
     }
+    //# Processes using the shared memory segment can be seen without IO.
+    //# Then the lock file only needs to be inspected for other processes,
+    //# which is done at most once per second.
+    double interval = itsInterval;
+    if (itsShm != 0) {
+      if (itsShm->nrWaiting() > 0) {
+	return True;
+      }
+      if (interval < 1) {
+	interval = 1;
+      }
+    }
 
     if (!always) {
       //# Only check elapsed time every n-th request (where n=25 at present),
       //# as the elapsed time calculation is computationally expensive
-      if (itsInterval > 0 && itsInspectCount++ < 25) {
+      if (interval > 0 && itsInspectCount++ < 25) {
 	return False;
       }
       itsInspectCount = 0;
 
       //# Only inspect if time interval has passed.
-      if (itsInterval > 0  &&  itsLastTime.age() < itsInterval) {
+      if (interval > 0  &&  itsLastTime.age() < interval) {
 	return False;
       }
     }
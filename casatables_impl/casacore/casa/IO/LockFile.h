@@ -43,6 +43,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 class FiledesIO;
 class MemoryIO;
 class CanonicalIO;
+class SharedMemoryLock;
 
 
 // <summary> 
@@ -132,6 +133,17 @@ class CanonicalIO;
 // locks held by the other LockFile objects. This behaviour is due to the way
 // file locking is working on UNIX machines (certainly on Solaris 2.6).
 // One can use the test program tLockFile to test for this behaviour.
+// <p>
+// Optionally a <linkto class=SharedMemoryLock>SharedMemoryLock</linkto>
+// segment is used for the processes on the same host. A waiting process
+// then also registers itself in the segment and is woken as soon as the
+// lock is released on this host, while <src>inspect</src> tests the
+// segment without any IO. The request list in the lock file is still
+// maintained for processes not using the segment, but it is inspected at
+// most once per second. The fcntl lock on the lock file remains the
+// actual lock, so the segment is only an accelerator. It is not used for
+// a lock file on a network file system, because processes on other hosts
+// cannot see it.
 // </synopsis>
 
 // <example>
@@ -194,10 +206,13 @@ public:
     // way showLock() can find out if if table is permanently locked.
     // <br> The <src>noLocking</src> argument is used to indicate that
     // no locking is needed. It means that acquiring a lock always succeeds.
+    // <br> The <src>sharedMemory</src> argument tells if a shared memory
+    // segment should be used for processes on the same host (if possible).
     explicit LockFile (const String& fileName, double inspectInterval = 0,
 		       Bool create = False, Bool addToRequestList = True,
 		       Bool mustExist = True, uInt seqnr = 0,
-		       Bool permLocking = False, Bool noLocking = False);
+		       Bool permLocking = False, Bool noLocking = False,
+		       Bool sharedMemory = False);
 
     // The destructor does not delete the file, because it is not known
     // when the last process using the lock file will stop.
@@ -264,6 +279,9 @@ public:
     // Get the block of request id's.
     const Block<Int>& reqIds() const;
 
+    // Is a shared memory segment used?
+    Bool usesSharedMemory() const;
+
     // Get the request id's and the info from the lock file.
     void getInfo (MemoryIO& info);
 
@@ -314,12 +332,16 @@ private:
     // Get the number of request id's.
     Int getNrReqId() const;
 
+    // Wait for the lock using the shared memory segment.
+    Bool acquireShared (FileLocker::LockType type, uInt nattempts);
+
 
     //# The member variables.
     FileLocker   itsLocker;
     FileLocker   itsUseLocker;
     FiledesIO*   itsFileIO;
     CanonicalIO* itsCanIO;
+    SharedMemoryLock* itsShm;
     Bool         itsWritable;         //# lock file is writable?
     Bool         itsAddToList;        //# Should acquire add to request list?
     double       itsInterval;         //# interval between inspections
@@ -377,6 +399,10 @@ inline const Block<Int>& LockFile::reqIds() const
 {
     return itsReqId;
 }
+inline Bool LockFile::usesSharedMemory() const
+{
+    return itsShm != 0;
+}
 
 
 
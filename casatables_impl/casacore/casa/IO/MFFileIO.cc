@@ -96,7 +96,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   void MFFileIO::fsync()
-  {}
+  {
+    itsFile.flush();
+    itsFile.fsync();
+  }
 
   String MFFileIO::fileName() const
   {
@@ -105,7 +108,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   Int64 MFFileIO::length()
   {
-    return itsFile.info()[itsId].fsize;
+    return itsFile.fileSize (itsId);
   }
        
   Bool MFFileIO::isReadable() const
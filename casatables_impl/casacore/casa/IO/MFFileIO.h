@@ -124,6 +124,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     virtual String fileName() const;
 
     // Fsync the file (i.e. force the data to be physically written).
+    // It flushes and fsyncs the entire MultiFileBase.
     virtual void fsync();
 
     // Reset the position pointer to the given value. It returns the
@@ -152,8 +152,24 @@ namespace casacore
     return szrd;
   }
 
+  const void* MMapfdIO::readView (Int64 size)
+  {
+    if (itsPtr == 0  ||  size < 0  ||  itsPosition + size > itsFileSize) {
+      return 0;
+    }
+    const char* ptr = itsPtr + itsPosition;
+    itsPosition += size;
+    return ptr;
+  }
+
   Int64 MMapfdIO::doSeek (Int64 offset, ByteIO::SeekOption dir)
   {
+    // The file position is not moved by read and write, so a relative
+    // seek has to be done from the position in the mapped file.
+    if (dir == ByteIO::Current) {
+      offset += itsPosition;
+      dir = ByteIO::Begin;
+    }
     itsPosition = FiledesIO::doSeek (offset, dir);
     return itsPosition;
   }
@@ -103,6 +103,10 @@ public:
   // the system call returns an undocumented value.
   virtual Int64 read (Int64 size, void* buf, Bool throwException=True);
 
+  // Get a pointer to the next <src>size</src> bytes in the mapped file
+  // and move the position beyond them (thus without copying).
+  virtual const void* readView (Int64 size);
+
   // Get a read or write pointer to the given position in the mapped file.
   // An exception is thrown if beyond end-of-file or it not writable.
   // These functions should be used with care. If the pointer is used to
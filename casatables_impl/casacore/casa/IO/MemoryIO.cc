@@ -157,6 +157,17 @@ Int64 MemoryIO::read (Int64 size, void* buf, Bool throwException)
   return bytesRead;
 }
 
+const void* MemoryIO::readView (Int64 size)
+{
+  if (!itsReadable  ||  size < 0  ||  itsPosition < 0
+  ||  itsPosition + size > itsUsed) {
+    return 0;
+  }
+  const uChar* ptr = itsBuffer + itsPosition;
+  itsPosition += size;
+  return ptr;
+}
+
 Int64 MemoryIO::doSeek (Int64 offset, ByteIO::SeekOption dir)
 {
   // Determine the new position.
@@ -173,6 +173,10 @@ public:
     // or the buffer pointer is at an invalid position.
     virtual Int64 read (Int64 size, void* buf, Bool throwException=True);    
 
+    // Get a pointer to the next <src>size</src> bytes in the buffer
+    // and move the position beyond them (thus without copying).
+    virtual const void* readView (Int64 size);
+
     // Clear the buffer; i.e. set the data length and seek pointer to zero.
     void clear();
 
@@ -41,8 +41,9 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   MultiFile::MultiFile (const String& name, ByteIO::OpenOption option,
-                        Int blockSize, Bool useODirect)
-    : MultiFileBase (name, blockSize, useODirect)
+                        Int blockSize, Bool useODirect, uInt nshard)
+    : MultiFileBase (name, blockSize, useODirect),
+      itsNShard     (std::max (nshard, 1u))
   {
     itsFD = RegularFileIO::openCreate (itsName, option, itsUseODirect);
     itsIO.attach (itsFD, itsName);
@@ -50,6 +51,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       // New file; first block is for administration.
       setNewFile();
       itsNrBlock = 1;
+      openShards (option);
     } else {
       readHeader();
     }
@@ -61,14 +63,51 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     close();
   }
 
+  String MultiFile::shardName (uInt shard) const
+  {
+    return itsName + "_shard" + String::toString(shard);
+  }
+
+  void MultiFile::openShards (ByteIO::OpenOption option)
+  {
+    // The first shard is the main file itself.
+    for (uInt i=itsShardIO.size()+1; i<itsNShard; ++i) {
+      int fd = RegularFileIO::openCreate (shardName(i), option,
+                                          itsUseODirect);
+      itsShardFD.push_back (fd);
+      itsShardIO.push_back (std::make_shared<FiledesIO> (fd, shardName(i)));
+    }
+  }
+
+  void MultiFile::closeShards()
+  {
+    for (size_t i=0; i<itsShardIO.size(); ++i) {
+      itsShardIO[i]->detach();
+      FiledesIO::close (itsShardFD[i]);
+    }
+    itsShardIO.clear();
+    itsShardFD.clear();
+  }
+
+  FiledesIO& MultiFile::blockIO (Int64 physblk, Int64& offset)
+  {
+    Int64 shard = physblk % itsNShard;
+    offset = (physblk / itsNShard) * itsBlockSize;
+    return shard == 0  ?  itsIO : *itsShardIO[shard-1];
+  }
+
   void MultiFile::flushFile()
   {
     itsIO.flush();
+    for (size_t i=0; i<itsShardIO.size(); ++i) {
+      itsShardIO[i]->flush();
+    }
   }
 
   void MultiFile::close()
   {
     flush();
+    closeShards();
     FiledesIO::close (itsFD);
   }
 
@@ -85,12 +124,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsFD = fd;
     itsIO.attach (itsFD, itsName);
     itsIO.setWritable();
+    // Do the same for the shards.
+    closeShards();
+    openShards (ByteIO::Update);
     itsWritable = True;
   }
 
   void MultiFile::fsync()
   {
     itsIO.fsync();
+    for (size_t i=0; i<itsShardIO.size(); ++i) {
+      itsShardIO[i]->fsync();
+    }
   }
 
   void MultiFile::writeHeader()
@@ -105,8 +150,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     cio.write (1, &itsBlockSize);         // reserve space for header size
     cio.write (1, &itsBlockSize);
     cio.write (1, &itsHdrCounter);
-    aio.putstart ("MultiFile", 1);
+    // Version 2 is only used for a sharded file, so unsharded files can
+    // still be read by older software.
+    aio.putstart ("MultiFile", itsNShard > 1 ? 2 : 1);
     aio << itsNrBlock << itsInfo << itsFreeBlocks;
+    if (itsNShard > 1) {
+      aio << itsNShard;
+    }
     aio.putend();
     Int64 todo = mio.length();
     uChar* buf = const_cast<uChar*>(mio.getBuffer());
@@ -167,16 +217,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     CanonicalIO cio(&mio);
     AipsIO aio(&cio);
     Int version = aio.getstart ("MultiFile");
-    AlwaysAssert (version==1, AipsError);
+    AlwaysAssert (version<=2, AipsError);
     aio >> itsNrBlock >> itsInfo >> itsFreeBlocks;
+    itsNShard = 1;
+    if (version > 1) {
+      aio >> itsNShard;
+    }
     aio.getend();
     // Initialize remaining info fields.
     for (vector<MultiFileInfo>::iterator iter=itsInfo.begin();
          iter!=itsInfo.end(); ++iter) {
-      iter->curBlock = -1;
-      iter->dirty    = False;
-      iter->allocBuffer (itsBlockSize, itsUseODirect);
+      iter->cache = std::make_shared<MultiFileCache>();
     }
+    openShards (itsIO.isWritable() ? ByteIO::Update : ByteIO::Old);
   }
 
   void MultiFile::doAddFile (MultiFileInfo&)
@@ -214,13 +267,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void MultiFile::readBlock (MultiFileInfo& info, Int64 blknr,
                              void* buffer)
   {
-    itsIO.pread (itsBlockSize, info.blockNrs[blknr] * itsBlockSize, buffer);
+    Int64 offset;
+    FiledesIO& io = blockIO (info.blockNrs[blknr], offset);
+    io.pread (itsBlockSize, offset, buffer);
   }
 
   void MultiFile::writeBlock (MultiFileInfo& info, Int64 blknr,
                               const void* buffer)
   {
-    itsIO.pwrite (itsBlockSize, info.blockNrs[blknr] * itsBlockSize, buffer);
+    Int64 offset;
+    FiledesIO& io = blockIO (info.blockNrs[blknr], offset);
+    io.pwrite (itsBlockSize, offset, buffer);
   }
 
 
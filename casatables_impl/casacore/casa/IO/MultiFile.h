@@ -77,6 +77,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   //
   // It is possible to delete a virtual file. Its blocks will be added to
   // the free block list (which is also stored in the meta info).
+  //
+  // The data blocks can be striped over multiple shard files (named
+  // <src>name_shard1</src>, <src>name_shard2</src>, etc.), where physical
+  // block <src>i</src> is stored in shard <src>i%nshard</src> (shard 0 being
+  // the file itself). Blocks of different virtual files can then be read
+  // and written in parallel on different devices, for example if the shards
+  // are placed on different OSTs of a Lustre file system or are symbolic
+  // links to files on different disks. The shards are kept next to the
+  // file, so they are copied, renamed and deleted with the table directory.
   // </synopsis>
 
   // <example>
@@ -115,8 +124,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // of the file system the file is on.
     // If useODirect=True, the O_DIRECT flag in used (if supported). It tells the
     // kernel to bypass its file cache to have more predictable I/O behaviour.
+    // Upon creation the number of shards can also be given. For an existing
+    // file the number of shards is read from its header.
     MultiFile (const String& name, ByteIO::OpenOption, Int blockSize=0,
-               Bool useODirect=False);
+               Bool useODirect=False, uInt nshard=1);
 
     // The destructor flushes and closes the file.
     virtual ~MultiFile();
@@ -130,7 +141,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Fsync the file (i.e., force the data to be physically written).
     virtual void fsync();
 
+    // Get the number of shards the data blocks are striped over.
+    uInt nshard() const
+      { return itsNShard; }
+
   private:
+    // Get the name of a shard file.
+    String shardName (uInt shard) const;
+    // Open the shard files not opened yet.
+    void openShards (ByteIO::OpenOption);
+    // Close the shard files.
+    void closeShards();
+    // Get the file holding a physical block and the offset in it.
+    FiledesIO& blockIO (Int64 physblk, Int64& offset);
     // Do the class-specific actions on adding a file.
     virtual void doAddFile (MultiFileInfo&);
     // Do the class-specific actions on deleting a file.
@@ -157,6 +180,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     //# Data members
     FiledesIO itsIO;
     int       itsFD;
+    uInt      itsNShard;
+    vector<std::shared_ptr<FiledesIO>> itsShardIO;   // shards 1..itsNShard-1
+    vector<int> itsShardFD;
   };
 
 
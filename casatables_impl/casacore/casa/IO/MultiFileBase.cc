@@ -34,13 +34,12 @@
 #include <casacore/casa/OS/File.h>     // for fileSTAT
 #include <sys/stat.h>                  // needed for stat or stat64
 #include <string.h>
-#include <stdlib.h>                    // for posix_memalign
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void operator<< (ostream& ios, const MultiFileInfo& info)
-    { ios << info.name << ' ' << info.blockNrs << ' ' << info.fsize << ' '
-          << info.curBlock << ' ' << info.dirty << endl; }
+    { ios << info.name << ' ' << info.blockNrs << ' ' << info.fsize << endl; }
   void operator<< (AipsIO& ios, const MultiFileInfo& info)
     { ios << info.name << info.blockNrs << info.fsize; }
   void operator>> (AipsIO& ios, MultiFileInfo& info)
@@ -53,7 +52,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsHdrCounter (0),
       itsUseODirect (useODirect),
       itsWritable   (False),         // usually reset by derived class
-      itsChanged    (False)
+      itsChanged    (False),
+      itsCacheBlocks (0),            // default is determined on first use
+      itsNrActive   (0),
+      itsNrWaiting  (0)
   {
     // Unset itsUseODirect if the OS does not support it.
 #ifndef HAVE_O_DIRECT
@@ -83,6 +85,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   uInt MultiFileBase::nfile() const
   {
+    std::lock_guard<std::mutex> lock(itsMutex);
     Int nf = 0;
     for (vector<MultiFileInfo>::const_iterator iter=itsInfo.begin();
          iter!=itsInfo.end(); ++iter) {
@@ -93,15 +96,51 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return nf;
   }
 
-  void MultiFileBase::flush()
+  Int64 MultiFileBase::fileSize (Int fileId) const
+  {
+    std::lock_guard<std::mutex> lock(itsMutex);
+    if (fileId < 0  ||  fileId >= Int(itsInfo.size())
+        ||  itsInfo[fileId].name.empty()) {
+      throw AipsError ("MultiFileBase::fileSize - invalid fileId given");
+    }
+    return itsInfo[fileId].fsize;
+  }
+
+  void MultiFileBase::setCacheBlocks (uInt nblocks)
   {
-    // Flush all buffers if needed.
+    ExclusiveGuard guard(*this);
+    itsCacheBlocks = std::max (nblocks, 1u);
+    // Shrink the caches if needed.
     for (vector<MultiFileInfo>::iterator iter=itsInfo.begin();
          iter!=itsInfo.end(); ++iter) {
-      if (iter->dirty) {
-        writeDirty (*iter);
+      std::list<MultiFileCache::CachedBlock>& blocks = iter->cache->blocks;
+      while (blocks.size() > itsCacheBlocks) {
+        if (blocks.back().dirty) {
+          writeBlock (*iter, blocks.back().blknr, blocks.back().buffer->data);
+        }
+        blocks.pop_back();
       }
     }
+  }
+
+  uInt MultiFileBase::cacheBlocks() const
+  {
+    if (itsCacheBlocks > 0) {
+      return itsCacheBlocks;
+    }
+    // Default is 4 MB per file, but at least one block.
+    return std::max (Int64(1), Int64(4*1024*1024) / std::max(itsBlockSize,
+                                                              Int64(1)));
+  }
+
+  void MultiFileBase::flush()
+  {
+    ExclusiveGuard guard(*this);
+    // Write all dirty blocks.
+    for (vector<MultiFileInfo>::iterator iter=itsInfo.begin();
+         iter!=itsInfo.end(); ++iter) {
+      writeDirty (*iter);
+    }
     // Header only needs to be written if blocks were added since last flush.
     if (itsChanged) {
       writeHeader();
@@ -110,15 +149,88 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     flushFile();
   }
 
+  MultiFileInfo& MultiFileBase::getInfo (Int fileId, const char* func)
+  {
+    if (fileId < 0  ||  fileId >= Int(itsInfo.size())
+        ||  itsInfo[fileId].name.empty()) {
+      throw AipsError (String("MultiFileBase::") + func +
+                       " - invalid fileId given");
+    }
+    return itsInfo[fileId];
+  }
+
+  MultiFileCache::CachedBlock* MultiFileBase::findBlock (MultiFileCache& cache,
+                                                         Int64 blknr)
+  {
+    std::list<MultiFileCache::CachedBlock>& blocks = cache.blocks;
+    for (std::list<MultiFileCache::CachedBlock>::iterator iter=blocks.begin();
+         iter!=blocks.end(); ++iter) {
+      if (iter->blknr == blknr) {
+        blocks.splice (blocks.begin(), blocks, iter);
+        return &blocks.front();
+      }
+    }
+    return 0;
+  }
+
+  MultiFileCache::CachedBlock& MultiFileBase::getBlock (MultiFileInfo& info,
+                                                        Int64 blknr, Bool read)
+  {
+    MultiFileCache::CachedBlock* block = findBlock (*info.cache, blknr);
+    if (block) {
+      return *block;
+    }
+    std::list<MultiFileCache::CachedBlock>& blocks = info.cache->blocks;
+    if (blocks.size() >= cacheBlocks()) {
+      // Reuse the least recently used block.
+      blocks.splice (blocks.begin(), blocks, std::prev(blocks.end()));
+      if (blocks.front().dirty) {
+        writeBlock (info, blocks.front().blknr, blocks.front().buffer->data);
+      }
+    } else {
+      MultiFileCache::CachedBlock newBlock;
+      newBlock.buffer = std::make_shared<MultiFileBuffer> (itsBlockSize,
+                                                           itsUseODirect);
+      blocks.push_front (newBlock);
+    }
+    block = &blocks.front();
+    block->blknr = blknr;
+    block->dirty = False;
+    if (read) {
+      readBlock (info, blknr, block->buffer->data);
+    } else {
+      memset (block->buffer->data, 0, itsBlockSize);
+    }
+    return *block;
+  }
+
+  void MultiFileBase::writeDirty (MultiFileInfo& info)
+  {
+    vector<MultiFileCache::CachedBlock*> dirty;
+    for (std::list<MultiFileCache::CachedBlock>::iterator
+           iter=info.cache->blocks.begin();
+         iter!=info.cache->blocks.end(); ++iter) {
+      if (iter->dirty) {
+        dirty.push_back (&*iter);
+      }
+    }
+    std::sort (dirty.begin(), dirty.end(),
+               [] (const MultiFileCache::CachedBlock* left,
+                   const MultiFileCache::CachedBlock* right)
+               { return left->blknr < right->blknr; });
+    for (size_t i=0; i<dirty.size(); ++i) {
+      writeBlock (info, dirty[i]->blknr, dirty[i]->buffer->data);
+      dirty[i]->dirty = False;
+    }
+  }
+
   Int64 MultiFileBase::read (Int fileId, void* buf,
                              Int64 size, Int64 offset)
   {
-    if (fileId >= Int(itsInfo.size())  ||  itsInfo[fileId].name.empty()) {
-      throw AipsError ("MultiFileBase::read - invalid fileId given");
-    }
+    IOGuard guard(*this);
+    MultiFileInfo& info = getInfo (fileId, "read");
+    std::lock_guard<std::mutex> lock(info.cache->mutex);
     char* buffer = static_cast<char*>(buf);
-    MultiFileInfo& info = itsInfo[fileId];
-    char* infoBuffer = info.buffer->data;
     // Determine the logical block to read and the start offset in that block.
     Int64 nrblk = (info.fsize + itsBlockSize - 1) / itsBlockSize;
     Int64 blknr = offset/itsBlockSize;
@@ -129,22 +241,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     while (done < szdo) {
       AlwaysAssert (blknr < nrblk, AipsError);
       Int64 todo = std::min(szdo-done, itsBlockSize-start);
-      // If already in buffer, copy from there.
-      if (blknr == info.curBlock) {
-        memcpy (buffer, infoBuffer+start, todo);
-      } else {
+      MultiFileCache::CachedBlock* block = findBlock (*info.cache, blknr);
+      if (block) {
+        // If already in cache, copy from there.
+        memcpy (buffer, block->buffer->data + start, todo);
+      } else if (todo == itsBlockSize  &&  !itsUseODirect) {
         // Read directly into buffer if it fits exactly and no O_DIRECT.
-        if (todo == itsBlockSize  &&  !itsUseODirect) {
-          readBlock (info, blknr, buffer);
-        } else {
-          if (info.dirty) {
-            writeDirty (info);
-          }
-          // Read into file buffer and copy correct part.
-          readBlock (info, blknr, infoBuffer);
-          info.curBlock = blknr;
-          memcpy (buffer, infoBuffer+start, todo);
-        }
+        readBlock (info, blknr, buffer);
+      } else {
+        // Read into the cache and copy correct part.
+        block = &getBlock (info, blknr, True);
+        memcpy (buffer, block->buffer->data + start, todo);
       }
       // Increment counters.
       done += todo;
@@ -158,51 +265,38 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   Int64 MultiFileBase::write (Int fileId, const void* buf,
                               Int64 size, Int64 offset)
   {
-    if (fileId >= Int(itsInfo.size())  ||  itsInfo[fileId].name.empty()) {
-      throw AipsError ("MultiFileBase::write - invalid fileId given");
-    }
-    const char* buffer = static_cast<const char*>(buf);
     AlwaysAssert (itsWritable, AipsError);
-    MultiFileInfo& info = itsInfo[fileId];
-    char* infoBuffer = info.buffer->data;
+    IOGuard guard(*this);
+    MultiFileInfo& info = getInfo (fileId, "write");
+    std::lock_guard<std::mutex> lock(info.cache->mutex);
+    const char* buffer = static_cast<const char*>(buf);
     // Determine the logical block to write and the start offset in that block.
     Int64 blknr = offset/itsBlockSize;
     Int64 start = offset - blknr*itsBlockSize;
     Int64 done  = 0;
     // If beyond EOF, add blocks as needed.
+    // The block numbers and free list are shared, so lock while extending.
     Int64 lastblk = blknr + (start+size+itsBlockSize-1) / itsBlockSize;
     Int64 curnrb = (info.fsize+itsBlockSize-1) / itsBlockSize;
     if (lastblk >= curnrb) {
+      std::lock_guard<std::mutex> hdrlock(itsMutex);
       extend (info, lastblk);
       itsChanged = True;
     }
     // Write until all done.
     while (done < size) {
       Int64 todo = std::min(size-done, itsBlockSize-start);
-      // Favor sequential writing, thus write current buffer first.
-      if (blknr == info.curBlock) {
-        memcpy (infoBuffer+start, buffer, todo);
-        info.dirty = True;
-        if (done+todo > size) {
-          writeDirty (info);
-        }
-      } else if (todo == itsBlockSize  &&  !itsUseODirect) {
+      MultiFileCache::CachedBlock* block = findBlock (*info.cache, blknr);
+      if (!block  &&  todo == itsBlockSize  &&  !itsUseODirect) {
         // Write directly from buffer if it fits exactly and no O_DIRECT.
         writeBlock (info, blknr, buffer);
       } else {
-        // Write into temporary buffer and copy correct part.
-        // First write possibly dirty buffer.
-        if (info.dirty) {
-          writeDirty (info);
+        // Write into the cache (new blocks are zeroed).
+        if (!block) {
+          block = &getBlock (info, blknr, blknr < curnrb);
         }
-        if (blknr >= curnrb) {
-          memset (infoBuffer, 0, itsBlockSize);
-        } else {
-          readBlock (info, blknr, infoBuffer);
-        }
-        info.curBlock = blknr;
-        memcpy (infoBuffer+start, buffer, todo);
-        info.dirty = True;
+        memcpy (block->buffer->data + start, buffer, todo);
+        block->dirty = True;
       }
       done += todo;
       buffer += todo;
@@ -210,6 +304,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       start = 0;
     }
     if (offset+size > info.fsize) {
+      std::lock_guard<std::mutex> hdrlock(itsMutex);
       info.fsize = offset+size;
     }
     return done;
@@ -217,12 +312,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiFileBase::resync()
   {
+    ExclusiveGuard guard(*this);
     AlwaysAssert (!itsChanged, AipsError);
-    // Clear all blocknrs.
+    // Clear all cached blocks.
     for (vector<MultiFileInfo>::iterator iter=itsInfo.begin();
          iter!=itsInfo.end(); ++iter) {
-      AlwaysAssert (!iter->dirty, AipsError);
-      iter->curBlock = -1;
+      std::list<MultiFileCache::CachedBlock>& blocks = iter->cache->blocks;
+      for (std::list<MultiFileCache::CachedBlock>::const_iterator
+             biter=blocks.begin(); biter!=blocks.end(); ++biter) {
+        AlwaysAssert (!biter->dirty, AipsError);
+      }
+      blocks.clear();
     }
     readHeader();
   }
@@ -234,6 +334,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     // Only use the basename part (to avoid directory rename problems).
     String bname = Path(fname).baseName();
+    ExclusiveGuard guard(*this);
     // Check that file name is not used yet.
     // Also determine (last) free file slot.
     uInt inx = itsInfo.size();
@@ -251,7 +352,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (inx == itsInfo.size()) {
       itsInfo.resize (inx+1);
     }
-    itsInfo[inx] = MultiFileInfo(itsBlockSize, itsUseODirect);
+    itsInfo[inx] = MultiFileInfo();
     itsInfo[inx].name = bname;
     doAddFile (itsInfo[inx]);
     itsChanged = True;
@@ -262,6 +363,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     // Only use the basename part (to avoid directory rename problems).
     String bname = Path(fname).baseName();
+    std::lock_guard<std::mutex> lock(itsMutex);
     for (size_t i=0; i<itsInfo.size(); ++i) {
       if (bname == itsInfo[i].name) {
         return i;
@@ -276,10 +378,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiFileBase::deleteFile (Int fileId)
   {
-    if (fileId >= Int(itsInfo.size())  ||  itsInfo[fileId].name.empty()) {
-      throw AipsError ("MultiFileBase::deleteFile - invalid fileId given");
-    }
-    MultiFileInfo& info = itsInfo[fileId];
+    ExclusiveGuard guard(*this);
+    MultiFileInfo& info = getInfo (fileId, "deleteFile");
     doDeleteFile (info);
     // Clear this slot.
     info = MultiFileInfo();
@@ -287,43 +387,57 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
-  MultiFileInfo::MultiFileInfo (Int64 bufSize, Bool useODirect)
-    : curBlock (-1),
-      fsize    (0),
-      dirty    (False),
-      buffer   (new MultiFileBuffer (bufSize, useODirect))
+  MultiFileInfo::MultiFileInfo()
+    : fsize (0),
+      cache (new MultiFileCache)
   {}
 
+
+  MultiFileBase::IOGuard::IOGuard (MultiFileBase& file)
+    : itsFile (file)
+  {
+    std::unique_lock<std::mutex> lock(itsFile.itsMutex);
+    // Give precedence to threads waiting to change the file structure.
+    itsFile.itsIOCond.wait (lock, [this] { return itsFile.itsNrWaiting == 0; });
+    itsFile.itsNrActive++;
+  }
+
+  MultiFileBase::IOGuard::~IOGuard()
+  {
+    std::lock_guard<std::mutex> lock(itsFile.itsMutex);
+    if (--itsFile.itsNrActive == 0) {
+      itsFile.itsIOCond.notify_all();
+    }
+  }
+
+  MultiFileBase::ExclusiveGuard::ExclusiveGuard (MultiFileBase& file)
+    : itsFile (file),
+      itsLock (file.itsMutex)
+  {
+    itsFile.itsNrWaiting++;
+    itsFile.itsIOCond.wait (itsLock, [this] { return itsFile.itsNrActive == 0; });
+    itsFile.itsNrWaiting--;
+  }
+
+  MultiFileBase::ExclusiveGuard::~ExclusiveGuard()
+  {
+    itsLock.unlock();
+    itsFile.itsIOCond.notify_all();
+  }
+
   
   MultiFileBuffer::MultiFileBuffer (size_t bufSize, Bool useODirect)
-    : data (0)
+    : data (0),
+      size (bufSize)
   {
-    const size_t align = 4096;
-    // Free buffer (in case used).
-    if (data) {
-      free (data);
-      data = 0;
-    }
     if (bufSize > 0) {
-      if (useODirect  &&  bufSize%align != 0) {
+      if (useODirect  &&  bufSize%AlignedBufferPool::alignment() != 0) {
         throw AipsError("MultiFile bufsize " + String::toString(bufSize) +
-                        " must be a multiple of 4096 when using O_DIRECT");
-      }
-      // Note that the error messages do a malloc as well, but small
-      // compared to the requested malloc, so they'll probably succeed.
-      void* ptr;
-      if (useODirect) {
-        if (posix_memalign (&ptr, align, bufSize) != 0) {
-          throw AllocError("MultiFileBuffer: failed to allocate aligned buffer",
-                           bufSize);
-        }
-      } else {
-        ptr = malloc (bufSize);
-        if (!ptr) {
-          throw AllocError("MultiFileBuffer: failed to allocate buffer", bufSize);
-        }
+                        " must be a multiple of " +
+                        String::toString(AlignedBufferPool::alignment()) +
+                        " when using O_DIRECT");
       }
-      data = static_cast<char*>(ptr);
+      data = AlignedBufferPool::allocate (bufSize);
     }
   }
 
@@ -31,10 +31,15 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/ByteIO.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/casa/vector.h>
 #include <casacore/casa/ostream.h>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -49,21 +54,41 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // Helper class for MultiFileInfo holding a data buffer
   // </summary>
   // <synopsis>
-  // The buffer can be allocated with posix_memalign (for O_DIRECT support).
-  // Hence the memory must be freed using free, which makes it impossible
+  // The buffer is taken from the AlignedBufferPool (for O_DIRECT support).
+  // Hence the memory must be returned to the pool, which makes it impossible
   // to use a shared_ptr to that memory. Hence it is encapsulated in this class.
   // </synopsis>
   struct MultiFileBuffer {
     MultiFileBuffer (size_t bufSize, Bool useODirect);
     ~MultiFileBuffer()
-      { if (data) free (data); }
-    // Data member
-    char* data;
+      { AlignedBufferPool::release (data, size); }
+    // Data members
+    char*  data;
+    size_t size;
   private:
     MultiFileBuffer (const MultiFileBuffer&);
     MultiFileBuffer& operator= (const MultiFileBuffer&);
   };
 
+  // <summary>
+  // Helper class for MultiFileInfo holding the cached data blocks of a file.
+  // </summary>
+  // <synopsis>
+  // The most recently used data blocks of a logical file are kept in a list
+  // (most recently used first). The mutex serializes the I/O on the file,
+  // while I/O on other files can be done concurrently.
+  // </synopsis>
+  // <use visibility=local>
+  struct MultiFileCache {
+    struct CachedBlock {
+      Int64 blknr = -1;         // logical block number
+      Bool  dirty = False;      // has data in buffer been changed?
+      std::shared_ptr<MultiFileBuffer> buffer;
+    };
+    std::mutex             mutex;
+    std::list<CachedBlock> blocks;
+  };
+
   // <summary>
   // Helper class for MultiFileBase containing info per internal file.
   // </summary>
@@ -73,20 +98,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // </synopsis>
   // <use visibility=local>
   struct MultiFileInfo {
-    // Initialize the object and create the buffer with the proper size.
-    // If align>1 (for use of O_DIRECT), the buffer is properly aligned and it
-    // is ensured that its size is a multiple of the alignment.
-    explicit MultiFileInfo (Int64 bufSize=0, Bool useODirect=False);
-    // Allocate the buffer.
-    void allocBuffer (Int64 bufSize, Bool useODirect=False)
-      { buffer = std::shared_ptr<MultiFileBuffer> (new MultiFileBuffer(bufSize, useODirect)); }
+    // Initialize the object with an empty cache.
+    MultiFileInfo();
     //# Data members.
     vector<Int64> blockNrs;     // physical blocknrs for this logical file
-    Int64         curBlock;     // the data block held in buffer (<0 is none)
     Int64         fsize;        // file size (in bytes)
     String        name;         // the virtual file name
-    Bool          dirty;        // has data in buffer been changed?
-    std::shared_ptr<MultiFileBuffer> buffer;       // buffer holding a data block
+    std::shared_ptr<MultiFileCache> cache;   // cached data blocks
     CountedPtr<HDF5Group> group;
     CountedPtr<HDF5DataSet> dataSet;
   };
@@ -131,6 +149,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   //
   // It is possible to delete a virtual file. Its blocks will be added to
   // the free block list (which is also stored in the meta info).
+  //
+  // The most recently used data blocks of each virtual file are cached,
+  // by default up to 4 MB (but at least one block) per file.
+  // Different virtual files can be read and written concurrently by
+  // different threads, for example by the storage managers of a table
+  // sharing the MultiFile. I/O on the same virtual file is serialized.
+  // Adding or deleting a file, flush and resync wait until the I/O in
+  // progress has finished.
   // </synopsis>
 
   // <example>
@@ -229,6 +255,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the nr of virtual files.
     uInt nfile() const;
 
+    // Get the size of a virtual file.
+    Int64 fileSize (Int fileId) const;
+
+    // Set the maximum nr of data blocks cached per virtual file.
+    void setCacheBlocks (uInt nblocks);
+
+    // Get the maximum nr of data blocks cached per virtual file.
+    uInt cacheBlocks() const;
+
     // Get the total nr of data blocks used.
     Int64 size() const
       { return itsNrBlock; }
@@ -242,11 +277,46 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       { return itsFreeBlocks; }
 
   private:
-    void writeDirty (MultiFileInfo& info)
-    {
-      writeBlock (info, info.curBlock, info.buffer->data);
-      info.dirty = False;
-    }
+    // Check the file id and return its info object.
+    MultiFileInfo& getInfo (Int fileId, const char* func);
+
+    // Get the given block into the cache of the file and make it the
+    // most recently used one. If not cached yet, it is read if
+    // <src>read=True</src>, otherwise zeroed. If the cache is full, the
+    // least recently used block is reused (and written if dirty).
+    // The cache mutex must be locked.
+    MultiFileCache::CachedBlock& getBlock (MultiFileInfo& info, Int64 blknr,
+                                           Bool read);
+
+    // Find a block in the cache and make it the most recently used one.
+    // A null pointer is returned if not cached.
+    MultiFileCache::CachedBlock* findBlock (MultiFileCache& cache,
+                                            Int64 blknr);
+
+    // Write the dirty blocks of a file in order of block number.
+    void writeDirty (MultiFileInfo& info);
+
+    // Register I/O on a virtual file during its lifetime.
+    // I/O on other files can be done concurrently.
+    class IOGuard {
+    public:
+      explicit IOGuard (MultiFileBase& file);
+      ~IOGuard();
+    private:
+      MultiFileBase& itsFile;
+    };
+
+    // Wait until no I/O is in progress and keep the object locked during
+    // its lifetime (used when changing the file structure). New I/O waits
+    // until the lock is released.
+    class ExclusiveGuard {
+    public:
+      explicit ExclusiveGuard (MultiFileBase& file);
+      ~ExclusiveGuard();
+    private:
+      MultiFileBase&               itsFile;
+      std::unique_lock<std::mutex> itsLock;
+    };
 
     // Do the class-specific actions on adding a file.
     virtual void doAddFile (MultiFileInfo&) = 0;
@@ -262,11 +332,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // header counter has changed.
     virtual void readHeader (Bool always=True) = 0;
     // Extend the virtual file to fit lastblk.
+    // It is called with the object locked.
     virtual void extend (MultiFileInfo& info, Int64 lastblk) = 0;
     // Write a data block.
+    // It can be called concurrently for different files.
     virtual void writeBlock (MultiFileInfo& info, Int64 blknr,
                              const void* buffer) = 0;
     // Read a data block.
+    // It can be called concurrently for different files.
     virtual void readBlock (MultiFileInfo& info, Int64 blknr,
                             void* buffer) = 0;
 
@@ -280,11 +353,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64  itsNrBlock;    // The total nr of blocks actually used
     Int64  itsHdrCounter; // Counter of header changes
     vector<MultiFileInfo> itsInfo;
-    std::shared_ptr<MultiFileBuffer> itsBuffer;  
     Bool                  itsUseODirect; // use O_DIRECT?
     Bool                  itsWritable;   // Is the file writable?
     Bool                  itsChanged;    // Has header info changed since last flush?
     vector<Int64>         itsFreeBlocks;
+    uInt                  itsCacheBlocks; // Max nr of cached blocks per file
+  private:
+    mutable std::mutex      itsMutex;     // Guards the header info
+    std::condition_variable itsIOCond;
+    uInt                    itsNrActive;  // Nr of I/O operations in progress
+    uInt                    itsNrWaiting; // Nr of threads waiting for exclusive
   };
 
 
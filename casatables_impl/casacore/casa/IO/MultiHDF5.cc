@@ -37,6 +37,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   MultiHDF5::MultiHDF5 (const String& name, ByteIO::OpenOption option,
                         Int blockSize)
     : MultiFileBase (name, blockSize, False),     //# no O_DIRECT in HDF5
+      itsOpenLock   (HDF5Object::libraryMutex()),
       itsFile       (itsName, option)
   {
     if (option == ByteIO::New  ||  option == ByteIO::NewNoReplace) {
@@ -45,6 +46,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       readHeader();
     }
     itsWritable = itsFile.isWritable();
+    itsOpenLock.unlock();
   }
 
   MultiHDF5::~MultiHDF5()
@@ -54,19 +56,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiHDF5::flushFile()
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     itsFile.flush();
   }
 
   void MultiHDF5::close()
   {
+    //# Flush before taking the HDF5 lock, because flush takes the lock of
+    //# the MultiFileBase, which is taken before the HDF5 lock elsewhere.
     flush();
     // Close all datasets and groups.
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     itsInfo.clear();
     itsFile.close();
   }
 
   void MultiHDF5::reopenRW()
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     // Close all datasets and groups.
     itsInfo.clear();
     itsFile.reopenRW();
@@ -79,6 +86,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiHDF5::writeHeader()
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     Record rec;
     itsHdrCounter++;
     rec.define ("blockSize", itsBlockSize);
@@ -96,6 +104,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiHDF5::readHeader (Bool always)
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     Record rec = HDF5Record::readRecord (itsFile, "__MultiHDF5_Header__");
     itsBlockSize  = rec.asInt64 ("blockSize");
     Int64 hdrCounter = rec.asInt64 ("hdrCounter");
@@ -109,7 +118,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Set info fields.
     itsInfo.reserve (names.size());
     for (uInt i=0; i<names.size(); ++i) {
-      MultiFileInfo info(itsBlockSize);
+      MultiFileInfo info;
       info.name  = names[i];
       info.fsize = sizes[i];
       if (! info.name.empty()) {
@@ -123,6 +132,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiHDF5::doAddFile (MultiFileInfo& info)
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     // Create a group and dataset for the file.
     info.group.reset (new HDF5Group (itsFile, info.name, false, true));
     info.dataSet.reset (new HDF5DataSet (*info.group, "FileData",
@@ -133,6 +143,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiHDF5::doDeleteFile (MultiFileInfo& info)
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     // Close the group and dataset.
     info.dataSet.reset();
     info.group.reset();
@@ -142,6 +153,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void MultiHDF5::extend (MultiFileInfo& info, Int64 lastblk)
   {
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     info.dataSet->extend (IPosition(2, itsBlockSize, lastblk+1));
   }
 
@@ -150,6 +162,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     Slicer slicer(IPosition(2, 0, blknr),
                   IPosition(2, itsBlockSize, 1));
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     info.dataSet->get (slicer, buffer);
   }
 
@@ -158,6 +171,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     Slicer slicer(IPosition(2, 0, blknr),
                   IPosition(2, itsBlockSize, 1));
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
     info.dataSet->put (slicer, buffer);
   }
 
@@ -146,6 +146,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                              const void* buffer);
 
     //# Data members
+    //# The HDF5 library is not thread-safe, so all calls to it are
+    //# serialized by HDF5Object::libraryMutex. It is held by this lock
+    //# while the file is opened in the constructor.
+    std::unique_lock<std::recursive_mutex> itsOpenLock;
     HDF5File itsFile;
   };
 
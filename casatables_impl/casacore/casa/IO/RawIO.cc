@@ -211,5 +211,10 @@ size_t RawIO::read (size_t nvalues, String* value)
     return TypeIO::read (nvalues, value);
 }
 
+Bool RawIO::isLocalFormat (DataType dtype) const
+{
+    return isNumeric (dtype)  &&  dtype != TpBool;
+}
+
 } //# NAMESPACE CASACORE - END
 
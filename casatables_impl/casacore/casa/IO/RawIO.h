@@ -124,6 +124,9 @@ public:
     virtual size_t read (size_t nvalues, DComplex* value);
     virtual size_t read (size_t nvalues, String* value);
     // </group>
+
+    // Tell if values of the given data type are stored in local format.
+    virtual Bool isLocalFormat (DataType dtype) const;
 };
 
 
@@ -0,0 +1,250 @@
+//# SharedMemoryLock.cc: Shared memory lock state of processes on the same host
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/IO/SharedMemoryLock.h>
+#include <atomic>
+#include <climits>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+
+#if defined(AIPS_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#include <linux/futex.h>
+#include <time.h>
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+#define SHMLOCK_VERSION 2u
+#define SHMLOCK_NRSLOT 32
+
+//# The layout of the segment. All-zero is the initial state, so a newly
+//# created (thus zero-filled) segment needs no initialization.
+//# The version is set by the first user; a different one means that the
+//# segment was made by an incompatible version and cannot be used.
+//# Besides the number of waiters, the pids of the waiting processes are
+//# kept, so the waiters of a process that died can be removed.
+struct SharedMemoryLockArea
+{
+    std::atomic<uInt>   version;
+    std::atomic<Int>    nwaiting;
+    std::atomic<uInt>   releaseCount;
+    std::atomic<Int>    waiters[SHMLOCK_NRSLOT];
+};
+
+
+#if defined(AIPS_LINUX)
+
+//# Is the file on a file system that can be shared with other hosts?
+static Bool isNetworkFileSystem (int fd)
+{
+    struct statfs fs;
+    if (fstatfs (fd, &fs) != 0) {
+        return True;
+    }
+    switch (static_cast<uInt>(fs.f_type)) {
+    case 0x6969u:          // NFS
+    case 0x517Bu:          // SMB
+    case 0xFF534D42u:      // CIFS
+    case 0xFE534D42u:      // SMB2
+    case 0x5346414Fu:      // AFS
+    case 0x73757245u:      // CODA
+    case 0x0BD00BD0u:      // Lustre
+    case 0x47504653u:      // GPFS
+    case 0x00C36400u:      // CephFS
+    case 0x01021997u:      // 9P
+    case 0x65735546u:      // FUSE (e.g. sshfs)
+        return True;
+    }
+    return False;
+}
+
+SharedMemoryLock* SharedMemoryLock::attach (int fd, uInt seqnr)
+{
+    static_assert (ATOMIC_INT_LOCK_FREE == 2,
+                   "SharedMemoryLock needs lock-free atomics");
+    struct stat st;
+    if (fd < 0  ||  fstat (fd, &st) != 0  ||  isNetworkFileSystem (fd)) {
+        return 0;
+    }
+    String name = "/dev/shm/casacore_lock_" +
+                  String::toString (uInt64(st.st_dev)) + '_' +
+                  String::toString (uInt64(st.st_ino)) + '_' +
+                  String::toString (seqnr);
+    //# The segment gets the permissions of the lock file (limited by the
+    //# umask), but is never writable for others.
+    int shmfd = ::open (name.chars(), O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW,
+                        st.st_mode & 0664);
+    if (shmfd < 0) {
+        return 0;
+    }
+    //# Anyone can create a file in /dev/shm, so an existing segment is only
+    //# used if it cannot have been planted by another user to disturb the
+    //# locking: it must be owned by this user or the owner of the lock file,
+    //# and not be writable for others.
+    //# A newly created segment has size 0; ftruncate zero-fills it.
+    struct stat shmst;
+    void* ptr = MAP_FAILED;
+    if (fstat (shmfd, &shmst) == 0
+    &&  S_ISREG(shmst.st_mode)  &&  (shmst.st_mode & S_IWOTH) == 0
+    &&  (shmst.st_uid == geteuid()  ||  shmst.st_uid == st.st_uid)
+    &&  (shmst.st_size >= off_t(sizeof(SharedMemoryLockArea))
+         ||  ftruncate (shmfd, sizeof(SharedMemoryLockArea)) == 0)) {
+        ptr = mmap (0, sizeof(SharedMemoryLockArea), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, shmfd, 0);
+    }
+    ::close (shmfd);
+    if (ptr == MAP_FAILED) {
+        return 0;
+    }
+    SharedMemoryLockArea* area = static_cast<SharedMemoryLockArea*>(ptr);
+    uInt version = 0;
+    if (! area->version.compare_exchange_strong (version, SHMLOCK_VERSION)
+    &&  version != SHMLOCK_VERSION) {
+        munmap (ptr, sizeof(SharedMemoryLockArea));
+        return 0;
+    }
+    return new SharedMemoryLock (area, name);
+}
+
+SharedMemoryLock::~SharedMemoryLock()
+{
+    munmap (itsArea, sizeof(SharedMemoryLockArea));
+}
+
+void SharedMemoryLock::remove()
+{
+    ::unlink (itsName.chars());
+}
+
+void SharedMemoryLock::wait (uInt count, double seconds)
+{
+    struct timespec ts;
+    ts.tv_sec  = time_t(seconds);
+    ts.tv_nsec = long((seconds - ts.tv_sec) * 1e9);
+    //# The futex is shared between processes, so FUTEX_PRIVATE_FLAG
+    //# cannot be used. It returns immediately if the counter has changed.
+    syscall (SYS_futex, reinterpret_cast<uInt*>(&itsArea->releaseCount),
+             FUTEX_WAIT, count, &ts, 0, 0);
+}
+
+void SharedMemoryLock::wake()
+{
+    itsArea->releaseCount.fetch_add (1);
+    if (itsArea->nwaiting.load() > 0) {
+        syscall (SYS_futex, reinterpret_cast<uInt*>(&itsArea->releaseCount),
+                 FUTEX_WAKE, INT_MAX, 0, 0, 0);
+    }
+}
+
+#else
+
+SharedMemoryLock* SharedMemoryLock::attach (int, uInt)
+{
+    return 0;
+}
+
+SharedMemoryLock::~SharedMemoryLock()
+{}
+
+void SharedMemoryLock::remove()
+{}
+
+void SharedMemoryLock::wait (uInt, double)
+{}
+
+void SharedMemoryLock::wake()
+{}
+
+#endif
+
+
+SharedMemoryLock::SharedMemoryLock (SharedMemoryLockArea* area,
+                                    const String& name)
+: itsArea (area),
+  itsName (name)
+{}
+
+Int SharedMemoryLock::nrWaiting() const
+{
+    //# This is the usual case, so it should be fast.
+    if (itsArea->nwaiting.load (std::memory_order_relaxed) <= 0) {
+        return 0;
+    }
+    //# Waiters of this process are not counted; its threads share the lock.
+    Int self = getpid();
+    Int nr = 0;
+    for (uInt i=0; i<SHMLOCK_NRSLOT; ++i) {
+        Int pid = itsArea->waiters[i].load();
+        if (pid != 0  &&  pid != self) {
+            if (kill (pid, 0) == 0  ||  errno == EPERM) {
+                nr++;
+            } else if (itsArea->waiters[i].compare_exchange_strong (pid, 0)) {
+                itsArea->nwaiting.fetch_sub (1);
+            }
+        }
+    }
+    return nr;
+}
+
+Int SharedMemoryLock::addWaiter()
+{
+    //# The count is only incremented for a waiter that got a slot,
+    //# so it always matches the number of occupied slots.
+    Int pid = getpid();
+    for (uInt i=0; i<SHMLOCK_NRSLOT; ++i) {
+        Int free = 0;
+        if (itsArea->waiters[i].compare_exchange_strong (free, pid)) {
+            itsArea->nwaiting.fetch_add (1);
+            return i;
+        }
+    }
+    return -1;
+}
+
+void SharedMemoryLock::removeWaiter (Int slot)
+{
+    //# The slot might have been cleared by nrWaiting if the pid was reused.
+    Int pid = getpid();
+    if (slot >= 0
+    &&  itsArea->waiters[slot].compare_exchange_strong (pid, 0)) {
+        itsArea->nwaiting.fetch_sub (1);
+    }
+}
+
+uInt SharedMemoryLock::releaseCount() const
+{
+    return itsArea->releaseCount.load();
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,149 @@
+//# SharedMemoryLock.h: Shared memory lock state of processes on the same host
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_SHAREDMEMORYLOCK_H
+#define CASA_SHAREDMEMORYLOCK_H
+
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+struct SharedMemoryLockArea;   //# Only in the .cc file
+
+
+// <summary>
+// Lock state shared by the processes on a host using the same lock file.
+// </summary>
+
+// <use visibility=local>
+
+// <prerequisite>
+//    <li> class <linkto class=LockFile>LockFile</linkto>
+//    <li> man pages of futex and shm_overview
+// </prerequisite>
+
+// <synopsis>
+// A <linkto class=LockFile>LockFile</linkto> keeps its request list in
+// the lock file, so a process holding a lock has to read the file to
+// find out if another process is waiting for it, and a waiting process
+// polls the lock once per second.
+// <p>
+// SharedMemoryLock keeps the same information for the processes on a
+// single host in a small POSIX shared memory segment (in /dev/shm)
+// named after the device and inode of the lock file.
+// It contains:
+// <ul>
+// <li> The number of processes waiting for a lock. It can be inspected
+//      without doing any IO.
+// <li> A release counter used as a futex. A waiting process sleeps on it
+//      and is woken as soon as a lock is released on this host.
+// </ul>
+// The segment does not replace the fcntl lock on the lock file; that
+// remains the actual lock, so processes that do not use the segment
+// (or that run on other hosts) keep working as before, and a process
+// dying while holding a lock cannot leave the table locked.
+// <p>
+// The segment has the permissions of the lock file, but it is never
+// writable for others. An existing segment is not used if it could have
+// been created by another user.
+// <p>
+// The segment can only be used on Linux (because of the futex) and for
+// files on a local file system. <src>attach</src> returns a null pointer
+// otherwise, in which case the caller uses the lock file only.
+// </synopsis>
+
+// <motivation>
+// Avoid a read of the lock file for each lock inspection and the
+// 1 second polling of waiting processes when all processes using a table
+// run on the same host.
+// </motivation>
+
+
+class SharedMemoryLock
+{
+public:
+    // Attach to the shared memory segment of the given (lock) file and
+    // lock number. The segment is created if it does not exist yet.
+    // A null pointer is returned if a segment cannot be used.
+    static SharedMemoryLock* attach (int fd, uInt seqnr);
+
+    // Unmap the segment. It is not removed, because other processes
+    // might still use it.
+    ~SharedMemoryLock();
+
+    // Remove the segment name, so it is not left behind in /dev/shm.
+    // Processes still using the segment keep it mapped; a process
+    // attaching thereafter creates a new segment.
+    void remove();
+
+    // Get the name of the segment.
+    const String& name() const
+        { return itsName; }
+
+    // Get the number of other processes waiting for a lock.
+    // Waiters of processes that do not exist anymore are removed.
+    Int nrWaiting() const;
+
+    // Register this process as waiting for a lock.
+    // It returns the slot to be passed to <src>removeWaiter</src>.
+    // If all slots are in use, -1 is returned and the process is not
+    // registered; the caller should then wait without the segment.
+    Int addWaiter();
+
+    // Unregister this process as waiting for a lock.
+    void removeWaiter (Int slot);
+
+    // Get the release counter.
+    uInt releaseCount() const;
+
+    // Wait until the release counter differs from <src>count</src>
+    // or until <src>seconds</src> have passed.
+    void wait (uInt count, double seconds);
+
+    // Increment the release counter and wake the waiting processes.
+    void wake();
+
+private:
+    SharedMemoryLock (SharedMemoryLockArea* area, const String& name);
+
+    // Forbid copy constructor and assignment.
+    // <group>
+    SharedMemoryLock (const SharedMemoryLock&);
+    SharedMemoryLock& operator= (const SharedMemoryLock&);
+    // </group>
+
+    SharedMemoryLockArea* itsArea;
+    String                itsName;
+};
+
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
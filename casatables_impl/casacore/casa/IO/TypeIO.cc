@@ -136,6 +136,11 @@ size_t TypeIO::write (size_t nvalues, const String* value)
 }
 
 
+Bool TypeIO::isLocalFormat (DataType) const
+{
+    return False;
+}
+
 size_t TypeIO::read (size_t nvalues, Bool* value)
 {
     size_t nb = (nvalues+7) / 8;
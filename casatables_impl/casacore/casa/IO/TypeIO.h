@@ -31,6 +31,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/ByteIO.h>
 #include <casacore/casa/Utilities/CountedPtr.h>
+#include <casacore/casa/Utilities/DataType.h>
 //# The following should be a forward declaration. But our Complex & DComplex
 //# classes are a typedef hence this does not work. Replace the following with
 //# forward declarations when Complex and DComplex are no longer typedefs.
@@ -134,6 +135,13 @@ public:
     virtual size_t read (size_t nvalues, String* value);
     // </group>
 
+    // Tell if values of the given data type are stored in local format,
+    // thus can be used without conversion (e.g., directly in the mapped
+    // data of a <linkto class=MMapfdIO>MMapfdIO</linkto> object).
+    // Only numeric types can be in local format.
+    // The default implementation returns False.
+    virtual Bool isLocalFormat (DataType dtype) const;
+
     // This function sets the position on the given offset.
     // The seek option defines from which file position the seek is done.
     // -1 is returned if not seekable.
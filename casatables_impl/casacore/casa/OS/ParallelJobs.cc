@@ -0,0 +1,77 @@
+//# ParallelJobs.cc: Run a number of jobs using a number of threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/casa/OS/ParallelJobs.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+void ParallelJobs::run (uInt nthread, uInt njob,
+                        const std::function<void(uInt)>& job)
+{
+    nthread = std::min (nthread, njob);
+    if (nthread <= 1) {
+        for (uInt i=0; i<njob; ++i) {
+            job (i);
+        }
+        return;
+    }
+    // Each thread takes the next job until all are done.
+    std::atomic<uInt> next(0);
+    std::vector<std::exception_ptr> errors(njob);
+    auto worker = [&job, &errors, &next, njob]() {
+        for (uInt i=next++; i<njob; i=next++) {
+            try {
+                job (i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve (nthread-1);
+    for (uInt i=1; i<nthread; ++i) {
+        threads.emplace_back (worker);
+    }
+    worker();
+    for (auto& thr : threads) {
+        thr.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception (error);
+        }
+    }
+}
+
+} //# NAMESPACE CASACORE - END
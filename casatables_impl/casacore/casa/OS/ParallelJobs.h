@@ -0,0 +1,72 @@
+//# ParallelJobs.h: Run a number of jobs using a number of threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_PARALLELJOBS_H
+#define CASA_PARALLELJOBS_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <functional>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Run a number of independent jobs using a number of threads.
+// </summary>
+
+// <use visibility=local>
+
+// <synopsis>
+// ParallelJobs runs the jobs 0..njob-1 by calling a function for each of
+// them. The calling thread and at most nthread-1 extra threads take the
+// next job until all are done, so jobs taking different times are
+// balanced over the threads. The jobs are run in the calling thread if
+// only one thread is used.
+// <br>An exception thrown by a job does not stop the other jobs. When all
+// are done, the exception of the lowest job number is rethrown.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//    ParallelJobs::run (4, chunks.size(),
+//                       [&](uInt i) { process (chunks[i]); });
+// </srcblock>
+// </example>
+
+class ParallelJobs
+{
+public:
+    // Run the function for the jobs 0..njob-1 using at most nthread threads.
+    static void run (uInt nthread, uInt njob,
+                     const std::function<void(uInt)>& job);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
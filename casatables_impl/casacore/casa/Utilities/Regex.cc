@@ -80,16 +80,13 @@ String::size_type Regex::match(const Char* s,
     return 0;
   }
   if (ps >= static_cast<Int>(len)) return String::npos;
-  Int matchlen;
-  String::size_type res = search(s, len, matchlen, ps);
-  if (res != String::npos) {
-    if (static_cast<Int>(res) == ps) {
-      res = matchlen;
-    } else {
-      res = String::npos;     // no match from start on
-    }
+  // Only try a match at the start, instead of searching the entire string.
+  std::cmatch result;
+  if (std::regex_search(s+ps, s+len, result, *this,
+                        std::regex_constants::match_continuous)) {
+    return result.length(0);
   }
-  return res;
+  return String::npos;        // no match from start on
 }
 
 Bool Regex::fullMatch(const Char* s, String::size_type len) const
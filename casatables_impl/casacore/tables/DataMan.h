@@ -42,6 +42,7 @@
 #include <casacore/tables/DataMan/TiledColumnStMan.h>
 #include <casacore/tables/DataMan/TiledShapeStMan.h>
 #include <casacore/tables/DataMan/MemoryStMan.h>
+#include <casacore/tables/DataMan/HDF5StMan.h>
 
 //#   virtual column engines
 #include <casacore/tables/DataMan/RetypedArrayEngine.h>
@@ -37,6 +37,7 @@
 #include <casacore/tables/DataMan/TiledColumnStMan.h>
 #include <casacore/tables/DataMan/TiledShapeStMan.h>
 #include <casacore/tables/DataMan/MemoryStMan.h>
+#include <casacore/tables/DataMan/HDF5StMan.h>
 #include <casacore/tables/DataMan/CompressFloat.h>
 #include <casacore/tables/DataMan/CompressComplex.h>
 #include <casacore/tables/DataMan/MappedArrayEngine.h>
@@ -46,6 +47,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/PlainTable.h>
 #include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/OS/DynLib.h>
 #include <casacore/tables/DataMan/DataManError.h>
@@ -69,13 +71,24 @@ DataManager::DataManager()
   asBigEndian_p (False),
   tsmOption_p   (TSMOption::Buffer, 0, 0),
   multiFile_p   (0),
-  clone_p       (0)
+  clone_p       (0),
+  metricsId_p   (-1),
+  cacheBudget_p (0),
+  demandPublished_p (False)
 {
     table_p = new Table;
 }
 
 DataManager::~DataManager()
-    { delete table_p; }
+{
+    if (metricsId_p >= 0) {
+        TableTrace::releaseMetricsDataManager (metricsId_p);
+    }
+    if (demandPublished_p) {
+        PlainTable::tableCache().removeCacheDemand (this);
+    }
+    delete table_p;
+}
 
 
 String DataManager::dataManagerName() const
@@ -159,6 +172,77 @@ void DataManager::setMaximumCacheSize (uInt)
 void DataManager::showCacheStatistics (ostream&) const
 {}
 
+Record DataManager::cacheStatistics() const
+{
+    return Record();
+}
+
+uInt64 DataManager::cacheDemand() const
+{
+    return 0;
+}
+
+void DataManager::setCacheMemory (uInt64)
+{}
+
+void DataManager::resetCacheMemory()
+{}
+
+void DataManager::publishCacheDemand()
+{
+    uInt64 demand = cacheDemand();
+    if (demand > 0  ||  demandPublished_p) {
+        PlainTable::tableCache().setCacheDemand (this, demand);
+        demandPublished_p = True;
+    }
+}
+
+Bool DataManager::canMapFiles() const
+{
+    if (multiFile_p != 0  ||  table_p == 0  ||  table_p->isNull()) {
+        return False;
+    }
+    return table_p->lockOptions().option() != TableLock::NoLocking
+       &&  table_p->hasLock (FileLocker::Read);
+}
+
+Int64 DataManager::vacuum()
+{
+    return 0;
+}
+
+void DataManager::addCacheStatistics (Record& rec, const BucketCache* cache)
+{
+    uInt64 size = 0;
+    uInt64 naccess = 0;
+    uInt64 nread = 0;
+    uInt64 ninit = 0;
+    uInt64 nwrite = 0;
+    uInt64 nevict = 0;
+    uInt64 bucketSize = 0;
+    if (cache) {
+        bucketSize = cache->bucketSize();
+        size    = uInt64(cache->cacheSize()) * bucketSize;
+        naccess = cache->nAccess();
+        nread   = cache->nRead();
+        ninit   = cache->nInit();
+        nwrite  = cache->nWrite();
+        nevict  = cache->nEvict();
+    }
+    //# A bucket not found in the cache is read or (if new) initialized.
+    const char* names[] = {"cachesize", "accesses", "hits", "misses",
+                           "bytesread", "byteswritten", "evictions"};
+    uInt64 values[] = {size, naccess, naccess - nread - ninit, nread + ninit,
+                       nread * bucketSize, nwrite * bucketSize, nevict};
+    for (uInt i=0; i<7; ++i) {
+        Int64 value = values[i];
+        if (rec.isDefined (names[i])) {
+            value += rec.asInt64 (names[i]);
+        }
+        rec.define (names[i], value);
+    }
+}
+
 void DataManager::setTsmOption (const TSMOption& tsmOption)
 {
   AlwaysAssert (multiFile_p==0, AipsError);
@@ -276,6 +360,33 @@ String DataManager::fileName() const
 ByteIO::OpenOption DataManager::fileOption() const
     { return PlainTable::toAipsIOFoption (table_p->tableOption()); }
 
+void DataManager::addMetricsCount (TableTrace::MetricsCounter counter,
+                                   uInt64 n) const
+{
+    int id = metricsId_p.load();
+    if (id < 0) {
+        // Threads using the data manager can register it at the same time.
+        // Only the first id is kept; the others are released.
+        id = TableTrace::metricsDataManager (table_p->tableName(),
+                                             statisticsName());
+        int expected = -1;
+        if (! metricsId_p.compare_exchange_strong (expected, id)) {
+            TableTrace::releaseMetricsDataManager (id);
+            id = expected;
+        }
+    }
+    TableTrace::addCount (id, counter, n);
+}
+
+String DataManager::statisticsName() const
+{
+    String name = dataManagerName();
+    if (name.empty()) {
+        name = keywordName (dataManagerType());
+    }
+    return name;
+}
+
 Bool DataManager::isRegular() const
     { return True; }
 
@@ -289,6 +400,11 @@ void DataManager::prepare()
 {}
 
 
+Bool DataManager::canFsyncFiles() const
+    { return False; }
+void DataManager::fsyncFiles()
+    {}
+
 Bool DataManager::canAddRow() const
     { return False; }
 
@@ -424,6 +540,7 @@ std::map<String,DataManagerCtor> DataManager::initRegisterMap()
   theirRegisterMap.insert (std::make_pair("TiledColumnStMan", TiledColumnStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("TiledShapeStMan",  TiledShapeStMan::makeObject));
   theirRegisterMap.insert (std::make_pair("MemoryStMan",      MemoryStMan::makeObject));
+  theirRegisterMap.insert (std::make_pair("HDF5StMan",        HDF5StMan::makeObject));
 #ifdef HAVE_MPI
 #ifdef HAVE_ADIOS2
   theirRegisterMap.insert (std::make_pair("Adios2StMan",      Adios2StMan::makeObject));
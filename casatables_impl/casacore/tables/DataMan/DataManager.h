@@ -33,10 +33,13 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManagerColumn.h>
 #include <casacore/tables/DataMan/TSMOption.h>
+#include <casacore/tables/Tables/TableTrace.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/IO/ByteIO.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iosfwd>
 #include <map>
 #include <mutex>
@@ -45,6 +48,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 class DataManager;
+class BucketCache;
 class SetupNewTable;
 class Table;
 class MultiFileBase;
@@ -237,6 +241,10 @@ public:
     // By default it returns an empty string.
     virtual String dataManagerName() const;
 
+    // Return the name of the data manager or, if it has no name, the
+    // keyword name of its type. It is used to label its statistics.
+    String statisticsName() const;
+
     // Return the type name of the data manager (in fact its class name).
     // It has to be a unique name, thus if the class is templated
     // the template parameter has to be part of the name.
@@ -297,6 +305,12 @@ public:
     MultiFileBase* multiFile()
       { return multiFile_p; }
 
+    // Can the files of the data manager be memory-mapped for reading?
+    // It is only done if the table holds a lock (thus not for NoLocking),
+    // so no other process can truncate or rewrite a file meanwhile, which
+    // would give a bus error instead of an exception.
+    Bool canMapFiles() const;
+
     // Compose a keyword name from the given keyword appended with the
     // sequence number (e.g. key_0).
     // This makes the keyword name unique if multiple data managers
@@ -309,6 +323,15 @@ public:
     // Get the AipsIO option of the underlying file.
     ByteIO::OpenOption fileOption() const;
 
+    // Add <src>n</src> to a counter of this data manager if metrics mode
+    // is on (see class <linkto class=TableTrace>TableTrace</linkto>).
+    void countMetrics (TableTrace::MetricsCounter counter, uInt64 n=1) const
+    {
+      if (TableTrace::metricsEnabled()) {
+        addMetricsCount (counter, n);
+      }
+    }
+
     // Is this a regular storage manager?
     // It is regular if it allows addition of rows and writing data in them.
     // <br>The default implementation returns True.
@@ -345,6 +368,76 @@ public:
     // Show the data manager's IO statistics. By default it does nothing.
     virtual void showCacheStatistics (std::ostream&) const;
 
+    // Get the statistics of the data manager's cache(s) as a record with
+    // the fields <src>cachesize</src> (in bytes), <src>accesses</src>,
+    // <src>hits</src>, <src>misses</src>, <src>bytesread</src>,
+    // <src>byteswritten</src>, and <src>evictions</src>.
+    // By default an empty record is returned, meaning that the data
+    // manager has no cache.
+    virtual Record cacheStatistics() const;
+
+    // Get the number of bytes the cache needs to hold all data of the
+    // data manager. By default 0 is returned, meaning that the data
+    // manager has no cache whose size can be set.
+    virtual uInt64 cacheDemand() const;
+
+    // Set the size of the cache in bytes. It is rounded to a whole number
+    // of buckets or tiles. By default it does nothing.
+    // A data manager has to remember the cache size it had before the
+    // first call, so <src>resetCacheMemory</src> can restore it.
+    virtual void setCacheMemory (uInt64 nbytes);
+
+    // Give the cache the size it had before <src>setCacheMemory</src>
+    // was called first. Nothing is done if it was not called.
+    // By default it does nothing.
+    virtual void resetCacheMemory();
+
+    // Regain the file space of data no longer in use (e.g. of arrays that
+    // were replaced by arrays with another shape) by compacting the files.
+    // It returns the number of bytes regained.
+    // By default nothing is done and 0 is returned.
+    virtual Int64 vacuum();
+
+    // Assign the cache size (in bytes) this data manager may use.
+    // It is used by <linkto class=TableCache>TableCache</linkto> to
+    // distribute a memory budget over the caches of all open tables.
+    // Because the table may be in use by another thread, the size is
+    // only applied by <src>applyCacheBudget</src>.
+    void assignCacheBudget (uInt64 nbytes)
+      { cacheBudget_p = std::min (std::max (nbytes, uInt64(1)),
+                                  ResetCacheBudget - 1); }
+
+    // Undo the assigned cache sizes; the next <src>applyCacheBudget</src>
+    // restores the cache size used before the first budget was applied.
+    void unassignCacheBudget()
+      { cacheBudget_p = ResetCacheBudget; }
+
+    // Set the cache size to the size assigned by <src>assignCacheBudget</src>
+    // if one was assigned since the last call.
+    // A storage manager has to call it before using its cache.
+    void applyCacheBudget()
+    {
+      if (cacheBudget_p.load (std::memory_order_relaxed) != 0) {
+        uInt64 nbytes = cacheBudget_p.exchange (0);
+        if (nbytes == ResetCacheBudget) {
+          resetCacheMemory();
+        } else if (nbytes != 0) {
+          setCacheMemory (nbytes);
+        }
+      }
+    }
+
+    // Tell the <linkto class=TableCache>TableCache</linkto> how many bytes
+    // the cache needs (see <src>cacheDemand</src>), so a cache budget can
+    // be distributed without accessing data managers used by other threads.
+    // It is done by the table when the data manager is created, opened,
+    // resynced or flushed.
+    void publishCacheDemand();
+
+    // Add the statistics of a BucketCache (which can be null) to a record
+    // as returned by <src>cacheStatistics</src>.
+    static void addCacheStatistics (Record& rec, const BucketCache* cache);
+
     // Create a column in the data manager on behalf of a table column.
     // It calls makeXColumn and checks the data type.
     // <group>
@@ -410,6 +503,12 @@ private:
     MultiFileBase* multiFile_p;      //# MultiFile to use; 0=no MultiFile
     Table*       table_p;            //# Table this data manager belongs to
     mutable DataManager* clone_p;    //# Pointer to clone (used by SetupNewTab)
+    mutable std::atomic<int> metricsId_p; //# -1 = not registered yet
+    std::atomic<uInt64> cacheBudget_p; //# cache size to apply; 0 = none
+    Bool         demandPublished_p;  //# True = known in the TableCache
+
+    //# The value of cacheBudget_p telling to reset the cache size.
+    static const uInt64 ResetCacheBudget = ~uInt64(0);
 
 
     // The copy constructor cannot be used for this base class.
@@ -421,6 +520,10 @@ private:
     // The private declaration of this operator makes it unusable.
     DataManager& operator= (const DataManager&);
 
+    // Register this data manager for metrics if not done yet and add
+    // to its counter.
+    void addMetricsCount (TableTrace::MetricsCounter counter, uInt64 n) const;
+
     // Create a column in the data manager on behalf of a table column.
     //# Should be private, but has to be public because friend
     //# declaration gave internal CFront error.
@@ -473,6 +576,18 @@ private:
     // It returns a True status if it had to flush (i.e. if data have changed).
     virtual Bool flush (AipsIO& ios, Bool fsync) = 0;
 
+    // Does the data manager support fsync-ing its files separately from
+    // flush? If so, a table fsync-ed by Table::flush flushes all its data
+    // managers first and fsyncs their files afterwards (a group commit),
+    // so the system can write the data of all files before having to wait.
+    // <br>The default implementation returns False; flush is then called
+    // with the fsync flag set.
+    virtual Bool canFsyncFiles() const;
+
+    // Fsync the data written by the last flush.
+    // <br>The default implementation does nothing.
+    virtual void fsyncFiles();
+
     // Let the data manager initialize itself for a new table.
     // <br>The default implementation calls the uInt version.
     virtual void create64 (rownr_t nrrow);
@@ -85,6 +85,19 @@ IPosition DataManagerColumn::tileShape (rownr_t)
     return IPosition(0);
 }
 
+void DataManagerColumn::getShapes (rownr_t startRow, rownr_t nrow,
+                                   std::vector<IPosition>& shapes)
+{
+    shapes.resize (nrow);
+    for (rownr_t i=0; i<nrow; ++i) {
+        if (isShapeDefined (startRow + i)) {
+            shapes[i] = shape (startRow + i);
+        } else {
+            shapes[i].resize (0);
+        }
+    }
+}
+
 Bool DataManagerColumn::canChangeShape() const
 {
     return False;
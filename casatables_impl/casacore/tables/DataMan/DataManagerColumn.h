@@ -35,6 +35,7 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Utilities/CountedPtr.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -219,6 +220,13 @@ public:
     // By default it returns a zero-length IPosition.
     virtual IPosition tileShape (rownr_t rownr);
 
+    // Get the shapes of the arrays in <src>nrow</src> rows starting at
+    // <src>startRow</src>. An undefined array gets an empty shape.
+    // By default <src>isShapeDefined</src> and <src>shape</src> are used
+    // for each row.
+    virtual void getShapes (rownr_t startRow, rownr_t nrow,
+                            std::vector<IPosition>& shapes);
+
     // Can the data manager handle chaging the shape of an existing array?
     // Default is no.
     virtual Bool canChangeShape() const;
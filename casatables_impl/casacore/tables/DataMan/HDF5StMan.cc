@@ -0,0 +1,306 @@
+//# HDF5StMan.cc: Storage manager for tiled columns using HDF5 data sets
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/DataMan/HDF5StMan.h>
+#include <casacore/tables/DataMan/HDF5StManColumn.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/HDF5/HDF5File.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/ArrayIO.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/ParallelJobs.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <vector>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+HDF5StMan::HDF5StMan (const String& dataManagerName,
+                      const IPosition& defaultTileShape,
+                      uInt compressLevel,
+                      uInt nthreads)
+: DataManager        (),
+  dataManName_p      (dataManagerName),
+  defaultTileShape_p (defaultTileShape),
+  compressLevel_p    (std::min (compressLevel, 9u)),
+  nthreads_p         (nthreads),
+  nrrow_p            (0),
+  hasPut_p           (False),
+  colSet_p           (0)
+{}
+
+HDF5StMan::HDF5StMan (const String& dataManagerName, const Record& spec)
+: DataManager        (),
+  dataManName_p      (dataManagerName),
+  compressLevel_p    (0),
+  nthreads_p         (0),
+  nrrow_p            (0),
+  hasPut_p           (False),
+  colSet_p           (0)
+{
+    if (spec.isDefined ("DEFAULTTILESHAPE")) {
+        defaultTileShape_p = IPosition (spec.toArrayInt ("DEFAULTTILESHAPE"));
+    }
+    if (spec.isDefined ("COMPRESSLEVEL")) {
+        compressLevel_p = std::min (uInt(spec.asInt ("COMPRESSLEVEL")), 9u);
+    }
+    setProperties (spec);
+}
+
+HDF5StMan::~HDF5StMan()
+{
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    for (uInt i=0; i<ncolumn(); i++) {
+        delete colSet_p[i];
+    }
+    file_p = 0;
+}
+
+DataManager* HDF5StMan::clone() const
+{
+    return new HDF5StMan (dataManName_p, defaultTileShape_p,
+                          compressLevel_p, nthreads_p);
+}
+
+DataManager* HDF5StMan::makeObject (const String& dataManagerName,
+                                    const Record& spec)
+{
+    return new HDF5StMan (dataManagerName, spec);
+}
+
+String HDF5StMan::dataManagerType() const
+{
+    return "HDF5StMan";
+}
+
+String HDF5StMan::dataManagerName() const
+{
+    return dataManName_p;
+}
+
+Record HDF5StMan::dataManagerSpec() const
+{
+    Record rec = getProperties();
+    rec.define ("DEFAULTTILESHAPE", defaultTileShape_p.asVector());
+    rec.define ("COMPRESSLEVEL", Int(compressLevel_p));
+    return rec;
+}
+
+Record HDF5StMan::getProperties() const
+{
+    Record rec;
+    rec.define ("NThreads", Int(nthreads_p));
+    return rec;
+}
+
+void HDF5StMan::setProperties (const Record& rec)
+{
+    if (rec.isDefined ("NThreads")) {
+        nthreads_p = std::max (rec.asInt ("NThreads"), 0);
+    }
+}
+
+uInt HDF5StMan::nthreads() const
+{
+    if (nthreads_p > 0) {
+        return nthreads_p;
+    }
+    return std::max (HostInfo::numCPUs(true), 1);
+}
+
+HDF5File& HDF5StMan::file()
+{
+    AlwaysAssert (! file_p.null(), AipsError);
+    return *file_p;
+}
+
+void HDF5StMan::runParallel (uInt njob,
+                             const std::function<void(uInt)>& job) const
+{
+    ParallelJobs::run (nthreads(), njob, job);
+}
+
+Bool HDF5StMan::canAddRow() const
+{
+    return True;
+}
+
+Bool HDF5StMan::canAddColumn() const
+{
+    return True;
+}
+
+DataManagerColumn* HDF5StMan::makeScalarColumn (const String& name,
+                                                int dataType, const String&)
+{
+    return makeColumn (name, dataType, False);
+}
+
+DataManagerColumn* HDF5StMan::makeDirArrColumn (const String& name,
+                                                int dataType, const String&)
+{
+    return makeColumn (name, dataType, True);
+}
+
+DataManagerColumn* HDF5StMan::makeIndArrColumn (const String& name,
+                                                int dataType, const String&)
+{
+    return makeColumn (name, dataType, True);
+}
+
+DataManagerColumn* HDF5StMan::makeColumn (const String& name, int dataType,
+                                          Bool isArray)
+{
+    //# Strings and other types cannot be stored in an HDF5 data set.
+    if (dataType == TpString  ||  dataType == TpOther) {
+        throw DataManError ("HDF5StMan cannot store column " + name +
+                            "; its data type is not supported");
+    }
+    //# Extend colSet_p block if needed.
+    if (ncolumn() >= colSet_p.nelements()) {
+        colSet_p.resize (colSet_p.nelements() + 32);
+    }
+    HDF5StManColumn* colp = new HDF5StManColumn (this, dataType, isArray);
+    colSet_p[ncolumn()] = colp;
+    return colp;
+}
+
+void HDF5StMan::openFile (ByteIO::OpenOption option)
+{
+    file_p = new HDF5File (fileName() + ".h5", option);
+}
+
+void HDF5StMan::create64 (rownr_t nrrow)
+{
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    openFile (ByteIO::New);
+    nrrow_p = nrrow;
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->create (nrrow_p);
+    }
+    hasPut_p = True;
+}
+
+rownr_t HDF5StMan::open64 (rownr_t tabNrrow, AipsIO& ios)
+{
+    ios.getstart ("HDF5StMan");
+    ios >> dataManName_p;
+    ios >> defaultTileShape_p;
+    ios >> compressLevel_p;
+    ios.getend();
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    openFile (table().isWritable()  ?  ByteIO::Update : ByteIO::Old);
+    nrrow_p = tabNrrow;
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->open();
+    }
+    return nrrow_p;
+}
+
+Bool HDF5StMan::flush (AipsIO& ios, Bool)
+{
+    {
+        std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+        if (! file_p.null()) {
+            file_p->flush();
+        }
+    }
+    ios.putstart ("HDF5StMan", 1);
+    ios << dataManName_p;
+    ios << defaultTileShape_p;
+    ios << compressLevel_p;
+    ios.putend();
+    Bool changed = hasPut_p;
+    hasPut_p = False;
+    return changed;
+}
+
+rownr_t HDF5StMan::resync64 (rownr_t nrrow)
+{
+    //# Reopen the file, otherwise HDF5 does not see the changes.
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->close();
+    }
+    file_p->close();
+    file_p->reopen();
+    nrrow_p = nrrow;
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->open();
+    }
+    return nrrow_p;
+}
+
+void HDF5StMan::reopenRW()
+{
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->close();
+    }
+    file_p->reopenRW();
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->open();
+    }
+}
+
+void HDF5StMan::deleteManager()
+{
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->close();
+    }
+    file_p = 0;
+    RegularFile file(fileName() + ".h5");
+    if (file.exists()) {
+        file.remove();
+    }
+}
+
+void HDF5StMan::addRow64 (rownr_t nrrow)
+{
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    nrrow_p += nrrow;
+    for (uInt i=0; i<ncolumn(); i++) {
+        colSet_p[i]->addRow (nrrow_p);
+    }
+    hasPut_p = True;
+}
+
+void HDF5StMan::addColumn (DataManagerColumn* colp)
+{
+    HDF5StManColumn* col = dynamic_cast<HDF5StManColumn*>(colp);
+    AlwaysAssert (col != 0, AipsError);
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    col->create (nrrow_p);
+    hasPut_p = True;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,248 @@
+//# HDF5StMan.h: Storage manager for tiled columns using HDF5 data sets
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_HDF5STMAN_H
+#define TABLES_HDF5STMAN_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <functional>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class HDF5File;
+class HDF5StManColumn;
+
+
+// <summary>
+// Storage manager for tiled columns using HDF5 data sets.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=DataManager>DataManager</linkto>
+//   <li> <linkto class=TiledColumnStMan>TiledColumnStMan</linkto>
+//   <li> <linkto class=HDF5DataSet>HDF5DataSet</linkto>
+// </prerequisite>
+
+// <synopsis>
+// HDF5StMan stores each of its columns as a chunked data set in an HDF5
+// file (named <src>table.f<i>n</i>.h5</src> in the table directory).
+// Similar to TiledColumnStMan, the data set of a column is a hypercube
+// formed by the cell shape and the row axis (which is the last axis in
+// Casacore order, thus the first axis in the HDF5 file). The HDF5 chunks
+// are the tiles of the hypercube. It makes it possible to use the data
+// with HDF5 tools directly.
+// <br>
+// Scalar columns and fixed shaped array columns of all numeric data types
+// (but not strings) can be stored. Rows can be added, but not be removed.
+// <p>
+// The tile shape is given by the default tile shape. As in
+// TiledColumnStMan it can contain the cell axes and the row axis. It can
+// also contain the cell axes only, in which case the number of rows in a
+// tile is chosen such that a tile holds about 1 MB. If no tile shape is
+// given, the tile contains full cells.
+// <br>
+// The tiles can be compressed using the HDF5 shuffle and deflate filters
+// by giving a compression level (1-9).
+// <p>
+// A get or getSlice of a single cell is done using the HDF5 library,
+// which uses its chunk cache. If a request (e.g. getColumn, getColumnRange
+// or getColumnSlice) spans multiple tiles, the raw tiles are read one by
+// one and decompressed in parallel by multiple threads, each copying
+// the requested part of its tiles into the result.
+// The maximum number of threads can be given (default is the number of
+// CPUs). Note that all calls to the HDF5 library are serialized.
+// <p>
+// Note that HDF5 support has to be enabled in the build (by defining
+// HAVE_HDF5); otherwise an exception is thrown when the storage manager
+// is used.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//    SetupNewTable newtab("name.data", tableDesc, Table::New);
+//    // Tiles of 4x64 pixels for 128 rows, compressed with deflate level 4.
+//    HDF5StMan stman("HDF5SM", IPosition(3,4,64,128), 4);
+//    newtab.bindColumn ("DATA", stman);
+//    Table tab(newtab);
+// </srcblock>
+// </example>
+
+// <motivation>
+// Sharing visibility cubes with HDF5 tools without a conversion pass.
+// </motivation>
+
+class HDF5StMan : public DataManager
+{
+public:
+    // Create the storage manager with the given name.
+    // The number of threads used to decompress tiles is given by
+    // <src>nthreads</src> (0 means the number of CPUs).
+    explicit HDF5StMan (const String& dataManagerName = "HDF5StMan",
+                        const IPosition& defaultTileShape = IPosition(),
+                        uInt compressLevel = 0,
+                        uInt nthreads = 0);
+
+    // Create the storage manager with the given name and specification
+    // (as returned by dataManagerSpec).
+    HDF5StMan (const String& dataManagerName, const Record& spec);
+
+    ~HDF5StMan();
+
+    // Clone this object.
+    virtual DataManager* clone() const;
+
+    // Get the type name of the data manager (i.e. HDF5StMan).
+    virtual String dataManagerType() const;
+
+    // Get the name given to the storage manager.
+    virtual String dataManagerName() const;
+
+    // Get the specification of the storage manager. Besides the properties
+    // it contains DEFAULTTILESHAPE and COMPRESSLEVEL.
+    virtual Record dataManagerSpec() const;
+
+    // Get or set the non-persistent properties (NThreads).
+    // <group>
+    virtual Record getProperties() const;
+    virtual void setProperties (const Record& spec);
+    // </group>
+
+    // Make the object from the type name and specification.
+    static DataManager* makeObject (const String& dataManagerType,
+                                    const Record& spec);
+
+    // Get the number of rows.
+    rownr_t nrow() const
+      { return nrrow_p; }
+
+    // Tell that data have been written.
+    void setHasPut()
+      { hasPut_p = True; }
+
+    // Get the default tile shape.
+    const IPosition& defaultTileShape() const
+      { return defaultTileShape_p; }
+
+    // Get the compression level (0 = no compression).
+    uInt compressLevel() const
+      { return compressLevel_p; }
+
+    // Get the number of threads to use (resolving 0 to the number of CPUs).
+    uInt nthreads() const;
+
+    // Get the HDF5 file (for the column objects).
+    HDF5File& file();
+
+    // Run the given function for the jobs 0..njob-1 using at most
+    // nthreads() threads. An exception thrown by a job is rethrown.
+    void runParallel (uInt njob, const std::function<void(uInt)>& job) const;
+
+private:
+    // Copy constructor cannot be used.
+    HDF5StMan (const HDF5StMan&);
+
+    // Assignment cannot be used.
+    HDF5StMan& operator= (const HDF5StMan&);
+
+    // Rows and columns can be added.
+    // <group>
+    virtual Bool canAddRow() const;
+    virtual Bool canAddColumn() const;
+    // </group>
+
+    // Flush the HDF5 file and write the header.
+    virtual Bool flush (AipsIO&, Bool fsync);
+
+    // Create the HDF5 file and the data sets of the columns.
+    virtual void create64 (rownr_t nrrow);
+
+    // Open the HDF5 file and the data sets of the columns.
+    virtual rownr_t open64 (rownr_t nrrow, AipsIO&);
+
+    // Reopen the HDF5 file to get the data written by another process.
+    virtual rownr_t resync64 (rownr_t nrrow);
+
+    // Reopen the HDF5 file for read/write access.
+    virtual void reopenRW();
+
+    // Delete the HDF5 file.
+    virtual void deleteManager();
+
+    // Add rows to all columns.
+    virtual void addRow64 (rownr_t nrrow);
+
+    // Create the data set of a column added to an existing table.
+    virtual void addColumn (DataManagerColumn*);
+
+    // Create a column object.
+    // <group>
+    virtual DataManagerColumn* makeScalarColumn (const String& name,
+                                                 int dataType,
+                                                 const String& dataTypeID);
+    virtual DataManagerColumn* makeDirArrColumn (const String& name,
+                                                 int dataType,
+                                                 const String& dataTypeID);
+    virtual DataManagerColumn* makeIndArrColumn (const String& name,
+                                                 int dataType,
+                                                 const String& dataTypeID);
+    DataManagerColumn* makeColumn (const String& name, int dataType,
+                                   Bool isArray);
+    // </group>
+
+    // Open the HDF5 file.
+    void openFile (ByteIO::OpenOption option);
+
+
+    //# Data members
+    String          dataManName_p;
+    IPosition       defaultTileShape_p;
+    uInt            compressLevel_p;
+    uInt            nthreads_p;
+    rownr_t         nrrow_p;
+    Bool            hasPut_p;
+    CountedPtr<HDF5File>     file_p;
+    PtrBlock<HDF5StManColumn*> colSet_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
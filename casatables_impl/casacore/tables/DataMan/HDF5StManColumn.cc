@@ -0,0 +1,633 @@
+//# HDF5StManColumn.cc: A column in the HDF5 storage manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/DataMan/HDF5StManColumn.h>
+#include <casacore/tables/DataMan/HDF5StMan.h>
+#include <casacore/tables/DataMan/TiledStMan.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/casa/HDF5/HDF5DataSet.h>
+#include <casacore/casa/HDF5/HDF5File.h>
+#include <casacore/casa/Arrays/ArrayBase.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <vector>
+#include <string.h>
+#ifdef HAVE_HDF5
+# include <zlib.h>
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+HDF5StManColumn::HDF5StManColumn (HDF5StMan* parent, int dataType,
+                                  Bool isArray)
+: StManColumnBase (dataType),
+  parent_p        (parent),
+  isArray_p       (isArray),
+  dataSet_p       (0)
+{}
+
+HDF5StManColumn::~HDF5StManColumn()
+{
+    delete dataSet_p;
+}
+
+void HDF5StManColumn::setShapeColumn (const IPosition& shape)
+{
+    shape_p = shape;
+}
+
+void HDF5StManColumn::setShape (rownr_t, const IPosition& shape)
+{
+    if (! shape.isEqual (shape_p)) {
+        throw DataManError ("HDF5StMan: shape " + String(shape.toString()) +
+                            " of an array in column " + columnName() +
+                            " mismatches the fixed shape " +
+                            String(shape_p.toString()));
+    }
+}
+
+Bool HDF5StManColumn::isShapeDefined (rownr_t)
+{
+    return True;
+}
+
+uInt HDF5StManColumn::ndim (rownr_t)
+{
+    return shape_p.nelements();
+}
+
+IPosition HDF5StManColumn::shape (rownr_t)
+{
+    return shape_p;
+}
+
+IPosition HDF5StManColumn::tileShape (rownr_t)
+{
+    return dataSet_p->tileShape();
+}
+
+
+HDF5DataType HDF5StManColumn::makeDataType() const
+{
+    switch (dtype()) {
+    case TpBool:
+        return HDF5DataType ((const Bool*)0);
+    case TpUChar:
+        return HDF5DataType ((const uChar*)0);
+    case TpShort:
+        return HDF5DataType ((const Short*)0);
+    case TpUShort:
+        return HDF5DataType ((const uShort*)0);
+    case TpInt:
+        return HDF5DataType ((const Int*)0);
+    case TpUInt:
+        return HDF5DataType ((const uInt*)0);
+    case TpInt64:
+        return HDF5DataType ((const Int64*)0);
+    case TpFloat:
+        return HDF5DataType ((const Float*)0);
+    case TpDouble:
+        return HDF5DataType ((const Double*)0);
+    case TpComplex:
+        return HDF5DataType ((const Complex*)0);
+    case TpDComplex:
+        return HDF5DataType ((const DComplex*)0);
+    default:
+        throw DataManInvDT (columnName());
+    }
+}
+
+IPosition HDF5StManColumn::makeTileShape() const
+{
+    const uInt nd = shape_p.nelements();
+    const IPosition& defShape = parent_p->defaultTileShape();
+    IPosition tileShape(nd+1, 1);
+    if (defShape.nelements() > 0  &&  defShape.nelements() >= nd
+    &&  defShape.nelements() <= nd+1) {
+        for (uInt i=0; i<defShape.nelements(); ++i) {
+            tileShape[i] = defShape[i];
+        }
+    } else if (shape_p.product() * elemSize() <= 1024*1024) {
+        // Use full cells.
+        for (uInt i=0; i<nd; ++i) {
+            tileShape[i] = shape_p[i];
+        }
+    } else {
+        // Large cells are split in tiles of about 1 MB.
+        IPosition cellTile = TiledStMan::makeTileShape
+          (shape_p, 0.5, std::max (1024*1024 / elemSize(), 1));
+        for (uInt i=0; i<nd; ++i) {
+            tileShape[i] = cellTile[i];
+        }
+    }
+    for (uInt i=0; i<nd; ++i) {
+        tileShape[i] = std::max (ssize_t(1), std::min (tileShape[i],
+                                                       shape_p[i]));
+    }
+    // Take as many rows as fit in about 1 MB if not given.
+    if (defShape.nelements() != nd+1) {
+        Int64 cellSize = tileShape.product() * elemSize();
+        tileShape[nd] = std::max (Int64(1), 1024*1024 / cellSize);
+    }
+    return tileShape;
+}
+
+void HDF5StManColumn::setCacheSize()
+{
+    const IPosition& shape = dataSet_p->shape();
+    const IPosition& tileShape = dataSet_p->tileShape();
+    uInt nchunk = 1;
+    for (uInt i=0; i<shape.nelements()-1; ++i) {
+        nchunk *= (shape[i] + tileShape[i] - 1) / tileShape[i];
+    }
+    dataSet_p->setCacheSize (nchunk);
+}
+
+void HDF5StManColumn::create (rownr_t nrrow)
+{
+    if (isArray_p  &&  shape_p.empty()) {
+        throw DataManError ("HDF5StMan: column " + columnName() +
+                            " must have a fixed shape");
+    }
+    // The row axis is extendible (length 0).
+    IPosition cubeShape(shape_p);
+    cubeShape.append (IPosition(1, 0));
+    dataSet_p = new HDF5DataSet (parent_p->file(), columnName(), cubeShape,
+                                 makeTileShape(), makeDataType(),
+                                 parent_p->compressLevel());
+    setCacheSize();
+    addRow (nrrow);
+}
+
+void HDF5StManColumn::open()
+{
+    dataSet_p = new HDF5DataSet (parent_p->file(), columnName(),
+                                 makeDataType());
+    IPosition cellShape = dataSet_p->shape().getFirst
+                                   (dataSet_p->shape().nelements() - 1);
+    if (shape_p.empty()) {
+        shape_p = cellShape;
+    } else if (! shape_p.isEqual (cellShape)) {
+        throw DataManError ("HDF5StMan: shape " + String(cellShape.toString()) +
+                            " of data set " + columnName() +
+                            " mismatches the column shape " +
+                            String(shape_p.toString()));
+    }
+    setCacheSize();
+}
+
+void HDF5StManColumn::close()
+{
+    delete dataSet_p;
+    dataSet_p = 0;
+}
+
+void HDF5StManColumn::addRow (rownr_t nrrow)
+{
+    IPosition cubeShape(dataSet_p->shape());
+    cubeShape[cubeShape.nelements() - 1] = nrrow;
+    dataSet_p->extend (cubeShape);
+}
+
+
+void HDF5StManColumn::getBool (rownr_t rownr, Bool* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getuChar (rownr_t rownr, uChar* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getShort (rownr_t rownr, Short* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getuShort (rownr_t rownr, uShort* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getInt (rownr_t rownr, Int* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getuInt (rownr_t rownr, uInt* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getInt64 (rownr_t rownr, Int64* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getfloat (rownr_t rownr, float* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getdouble (rownr_t rownr, double* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getComplex (rownr_t rownr, Complex* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+void HDF5StManColumn::getDComplex (rownr_t rownr, DComplex* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, False); }
+
+void HDF5StManColumn::putBool (rownr_t rownr, const Bool* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putuChar (rownr_t rownr, const uChar* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putShort (rownr_t rownr, const Short* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putuShort (rownr_t rownr, const uShort* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putInt (rownr_t rownr, const Int* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putuInt (rownr_t rownr, const uInt* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putInt64 (rownr_t rownr, const Int64* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putfloat (rownr_t rownr, const float* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putdouble (rownr_t rownr, const double* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putComplex (rownr_t rownr, const Complex* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+void HDF5StManColumn::putDComplex (rownr_t rownr, const DComplex* dataPtr)
+  { accessRows (0, rownr, 1, 1, (char*)dataPtr, True); }
+
+
+void HDF5StManColumn::getScalarColumnV (ArrayBase& data)
+{
+    getColumnSliceV (Slicer(), data);
+}
+
+void HDF5StManColumn::putScalarColumnV (const ArrayBase& data)
+{
+    putColumnSliceV (Slicer(), data);
+}
+
+void HDF5StManColumn::getScalarColumnCellsV (const RefRows& rownrs,
+                                             ArrayBase& data)
+{
+    getCells (rownrs, 0, data);
+}
+
+void HDF5StManColumn::putScalarColumnCellsV (const RefRows& rownrs,
+                                             const ArrayBase& data)
+{
+    putCells (rownrs, 0, data);
+}
+
+void HDF5StManColumn::getArrayV (rownr_t rownr, ArrayBase& data)
+{
+    Bool deleteIt;
+    void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (0, rownr, 1, 1, static_cast<char*>(dataPtr), False);
+    data.putVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::putArrayV (rownr_t rownr, const ArrayBase& data)
+{
+    Bool deleteIt;
+    const void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (0, rownr, 1, 1, (char*)dataPtr, True);
+    data.freeVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::getSliceV (rownr_t rownr, const Slicer& slicer,
+                                 ArrayBase& data)
+{
+    Bool deleteIt;
+    void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (&slicer, rownr, 1, 1, static_cast<char*>(dataPtr), False);
+    data.putVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::putSliceV (rownr_t rownr, const Slicer& slicer,
+                                 const ArrayBase& data)
+{
+    Bool deleteIt;
+    const void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (&slicer, rownr, 1, 1, (char*)dataPtr, True);
+    data.freeVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::getArrayColumnV (ArrayBase& data)
+{
+    Bool deleteIt;
+    void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (0, 0, parent_p->nrow(), 1, static_cast<char*>(dataPtr),
+                False);
+    data.putVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::putArrayColumnV (const ArrayBase& data)
+{
+    Bool deleteIt;
+    const void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (0, 0, parent_p->nrow(), 1, (char*)dataPtr, True);
+    data.freeVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::getArrayColumnCellsV (const RefRows& rownrs,
+                                            ArrayBase& data)
+{
+    getCells (rownrs, 0, data);
+}
+
+void HDF5StManColumn::putArrayColumnCellsV (const RefRows& rownrs,
+                                            const ArrayBase& data)
+{
+    putCells (rownrs, 0, data);
+}
+
+void HDF5StManColumn::getColumnSliceV (const Slicer& slicer, ArrayBase& data)
+{
+    Bool deleteIt;
+    void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (isArray_p ? &slicer : 0, 0, parent_p->nrow(), 1,
+                static_cast<char*>(dataPtr), False);
+    data.putVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::putColumnSliceV (const Slicer& slicer,
+                                       const ArrayBase& data)
+{
+    Bool deleteIt;
+    const void* dataPtr = data.getVStorage (deleteIt);
+    accessRows (isArray_p ? &slicer : 0, 0, parent_p->nrow(), 1,
+                (char*)dataPtr, True);
+    data.freeVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::getColumnSliceCellsV (const RefRows& rownrs,
+                                            const Slicer& slicer,
+                                            ArrayBase& data)
+{
+    getCells (rownrs, &slicer, data);
+}
+
+void HDF5StManColumn::putColumnSliceCellsV (const RefRows& rownrs,
+                                            const Slicer& slicer,
+                                            const ArrayBase& data)
+{
+    putCells (rownrs, &slicer, data);
+}
+
+
+void HDF5StManColumn::cellSection (const Slicer* slicer, IPosition& start,
+                                   IPosition& length, IPosition& stride) const
+{
+    if (slicer == 0) {
+        start  = IPosition (shape_p.nelements(), 0);
+        length = shape_p;
+        stride = IPosition (shape_p.nelements(), 1);
+    } else {
+        IPosition end;
+        length = slicer->inferShapeFromSource (shape_p, start, end, stride);
+    }
+}
+
+void HDF5StManColumn::accessRows (const Slicer* slicer, rownr_t start,
+                                  rownr_t nrow, rownr_t incr, char* buf,
+                                  Bool writeFlag)
+{
+    IPosition st, len, str;
+    cellSection (slicer, st, len, str);
+    st.append  (IPosition(1, start));
+    len.append (IPosition(1, nrow));
+    str.append (IPosition(1, incr));
+    if (len.product() == 0) {
+        return;
+    }
+    if (writeFlag) {
+        writeSection (st, len, str, buf);
+    } else {
+        readSection (st, len, str, buf);
+    }
+}
+
+void HDF5StManColumn::getCells (const RefRows& rownrs, const Slicer* slicer,
+                                ArrayBase& data)
+{
+    IPosition st, len, str;
+    cellSection (slicer, st, len, str);
+    // Note that a scalar has an empty cell shape.
+    size_t cellSize = (len.empty()  ?  1 : len.product()) * elemSize();
+    Bool deleteIt;
+    void* dataPtr = data.getVStorage (deleteIt);
+    char* buf = static_cast<char*>(dataPtr);
+    // Each slice of rows is read as a single hyperslab.
+    RefRowsSliceIter iter(rownrs);
+    while (! iter.pastEnd()) {
+        rownr_t nrow = (iter.sliceEnd() - iter.sliceStart()) /
+                       iter.sliceIncr() + 1;
+        accessRows (slicer, iter.sliceStart(), nrow, iter.sliceIncr(),
+                    buf, False);
+        buf += nrow * cellSize;
+        iter++;
+    }
+    data.putVStorage (dataPtr, deleteIt);
+}
+
+void HDF5StManColumn::putCells (const RefRows& rownrs, const Slicer* slicer,
+                                const ArrayBase& data)
+{
+    IPosition st, len, str;
+    cellSection (slicer, st, len, str);
+    size_t cellSize = (len.empty()  ?  1 : len.product()) * elemSize();
+    Bool deleteIt;
+    const void* dataPtr = data.getVStorage (deleteIt);
+    const char* buf = static_cast<const char*>(dataPtr);
+    RefRowsSliceIter iter(rownrs);
+    while (! iter.pastEnd()) {
+        rownr_t nrow = (iter.sliceEnd() - iter.sliceStart()) /
+                       iter.sliceIncr() + 1;
+        accessRows (slicer, iter.sliceStart(), nrow, iter.sliceIncr(),
+                    (char*)buf, True);
+        buf += nrow * cellSize;
+        iter++;
+    }
+    data.freeVStorage (dataPtr, deleteIt);
+}
+
+
+void HDF5StManColumn::writeSection (const IPosition& start,
+                                    const IPosition& length,
+                                    const IPosition& stride,
+                                    const char* buf)
+{
+    parent_p->countMetrics (TableTrace::BYTESWRITTEN,
+                            length.product() * elemSize());
+    std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+    dataSet_p->put (Slicer(start, length, stride, Slicer::endIsLength), buf);
+    parent_p->setHasPut();
+}
+
+void HDF5StManColumn::readSection (const IPosition& start,
+                                   const IPosition& length,
+                                   const IPosition& stride,
+                                   char* buf)
+{
+    parent_p->countMetrics (TableTrace::BYTESREAD,
+                            length.product() * elemSize());
+    // Find per axis the tiles (chunks) containing the requested pixels.
+    const IPosition& tileShape = dataSet_p->tileShape();
+    const uInt nd = start.nelements();
+    std::vector<std::vector<Int64> > chunks(nd);
+    uInt64 nchunk = 1;
+    for (uInt i=0; i<nd; ++i) {
+        Int64 last = start[i] + (length[i] - 1) * stride[i];
+        if (stride[i] <= tileShape[i]) {
+            for (Int64 c=start[i]/tileShape[i]; c<=last/tileShape[i]; ++c) {
+                chunks[i].push_back (c * tileShape[i]);
+            }
+        } else {
+            for (Int64 p=start[i]; p<=last; p+=stride[i]) {
+                chunks[i].push_back (p / tileShape[i] * tileShape[i]);
+            }
+        }
+        nchunk *= chunks[i].size();
+    }
+    // Decompress the chunks in parallel if they can be read raw.
+    // HDF5 stores them in little endian order.
+    if (nchunk > 1  &&  dataSet_p->canReadRawChunks()
+    &&  !HostInfo::bigEndian()  &&  parent_p->nthreads() > 1) {
+        parent_p->runParallel (nchunk, [&](uInt job) {
+            IPosition chunkStart(nd);
+            for (uInt i=0; i<nd; ++i) {
+                chunkStart[i] = chunks[i][job % chunks[i].size()];
+                job /= chunks[i].size();
+            }
+            readChunk (chunkStart, start, length, stride, buf);
+        });
+    } else {
+        std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+        dataSet_p->get (Slicer(start, length, stride, Slicer::endIsLength),
+                        buf);
+    }
+}
+
+void HDF5StManColumn::readChunk (const IPosition& chunkStart,
+                                 const IPosition& start,
+                                 const IPosition& length,
+                                 const IPosition& stride,
+                                 char* buf)
+{
+    const IPosition& tileShape = dataSet_p->tileShape();
+    const uInt nd = tileShape.nelements();
+    const size_t esize = elemSize();
+    const size_t chunkSize = tileShape.product() * esize;
+    std::vector<char> raw;
+    uInt filterMask = 0;
+    Bool found;
+    {
+        std::lock_guard<std::recursive_mutex> lock(HDF5Object::libraryMutex());
+        found = dataSet_p->readRawChunk (chunkStart, raw, filterMask);
+    }
+    // Undo the deflate and shuffle filters (unless skipped for the chunk).
+    // A chunk not written yet contains the fill value 0.
+    std::vector<char> inflated;
+    std::vector<char> data;
+    const char* chunk = raw.data();
+    if (! found) {
+        data.assign (chunkSize, 0);
+        chunk = data.data();
+    } else {
+        size_t nbytes = raw.size();
+        uInt deflateBit = (dataSet_p->isShuffled()  ?  2 : 1);
+        if (dataSet_p->compressLevel() > 0  &&  (filterMask & deflateBit) == 0) {
+#ifdef HAVE_HDF5
+            inflated.resize (chunkSize);
+            uLongf len = chunkSize;
+            if (uncompress ((Bytef*)inflated.data(), &len,
+                            (const Bytef*)raw.data(), raw.size()) != Z_OK) {
+                throw DataManError ("HDF5StMan: a tile of column " +
+                                    columnName() +
+                                    " could not be decompressed");
+            }
+            chunk  = inflated.data();
+            nbytes = len;
+#else
+            HDF5Object::throwNoHDF5();
+#endif
+        }
+        if (nbytes != chunkSize) {
+            throw DataManError ("HDF5StMan: a tile of column " + columnName() +
+                                " has an incorrect size");
+        }
+        if (dataSet_p->isShuffled()  &&  (filterMask & 1) == 0  &&  esize > 1) {
+            size_t nelem = chunkSize / esize;
+            data.resize (chunkSize);
+            for (size_t b=0; b<esize; ++b) {
+                const char* from = chunk + b*nelem;
+                char* to = data.data() + b;
+                for (size_t i=0; i<nelem; ++i) {
+                    to[i*esize] = from[i];
+                }
+            }
+            chunk = data.data();
+        }
+    }
+    // Determine per axis the first and number of requested pixels in the
+    // chunk and the step sizes in the buffer and chunk.
+    IPosition first(nd), count(nd), outStep(nd), inStep(nd);
+    size_t outSize = esize;
+    size_t inSize  = esize;
+    char* out = buf;
+    const char* in = chunk;
+    for (uInt i=0; i<nd; ++i) {
+        Int64 k0 = 0;
+        if (chunkStart[i] > start[i]) {
+            k0 = (chunkStart[i] - start[i] + stride[i] - 1) / stride[i];
+        }
+        Int64 k1 = std::min (length[i] - 1,
+                             (chunkStart[i] + tileShape[i] - 1 - start[i]) /
+                             stride[i]);
+        first[i]   = k0;
+        count[i]   = k1 - k0 + 1;
+        outStep[i] = outSize;
+        inStep[i]  = inSize * stride[i];
+        out += k0 * outSize;
+        in  += (start[i] + k0*stride[i] - chunkStart[i]) * inSize;
+        outSize *= length[i];
+        inSize  *= tileShape[i];
+    }
+    // Copy the first axis in one go if contiguous.
+    IPosition pos(nd, 0);
+    while (True) {
+        char* outp = out;
+        const char* inp = in;
+        for (uInt i=1; i<nd; ++i) {
+            outp += pos[i] * outStep[i];
+            inp  += pos[i] * inStep[i];
+        }
+        if (stride[0] == 1) {
+            memcpy (outp, inp, count[0] * esize);
+        } else {
+            for (Int64 j=0; j<count[0]; ++j) {
+                memcpy (outp + j*esize, inp + j*inStep[0], esize);
+            }
+        }
+        uInt i = 1;
+        for (; i<nd; ++i) {
+            if (++pos[i] < count[i]) {
+                break;
+            }
+            pos[i] = 0;
+        }
+        if (i >= nd) {
+            break;
+        }
+    }
+}
+
+} //# NAMESPACE CASACORE - END
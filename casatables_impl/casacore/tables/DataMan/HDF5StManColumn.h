@@ -0,0 +1,233 @@
+//# HDF5StManColumn.h: A column in the HDF5 storage manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_HDF5STMANCOLUMN_H
+#define TABLES_HDF5STMANCOLUMN_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/DataMan/StManColumnBase.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/BasicSL/Complex.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class HDF5StMan;
+class HDF5DataSet;
+class HDF5DataType;
+class RefRows;
+class Slicer;
+
+
+// <summary>
+// A column in the HDF5 storage manager.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=HDF5StMan>HDF5StMan</linkto>
+//   <li> <linkto class=HDF5DataSet>HDF5DataSet</linkto>
+// </prerequisite>
+
+// <synopsis>
+// HDF5StManColumn holds the HDF5 data set of a scalar or fixed shaped
+// array column in an HDF5StMan. The data set has the cell axes followed
+// by the row axis (in Casacore order). A request is turned into a
+// hyperslab of the data set. If the hyperslab spans multiple tiles
+// (chunks) and the raw chunks can be read, the chunks are decompressed
+// in parallel. Otherwise the HDF5 library is used to read the hyperslab.
+// </synopsis>
+
+class HDF5StManColumn : public StManColumnBase
+{
+public:
+    // Create a column of the given data type.
+    HDF5StManColumn (HDF5StMan* parent, int dataType, Bool isArray);
+
+    ~HDF5StManColumn();
+
+    // Set the shape of the arrays in the column.
+    virtual void setShapeColumn (const IPosition& shape);
+
+    // Set the shape of an array in the given row.
+    // It has to match the fixed shape.
+    virtual void setShape (rownr_t rownr, const IPosition& shape);
+
+    // The shape is always defined.
+    virtual Bool isShapeDefined (rownr_t rownr);
+
+    // Get the dimensionality of the array in the given row.
+    virtual uInt ndim (rownr_t rownr);
+
+    // Get the shape of the array in the given row.
+    virtual IPosition shape (rownr_t rownr);
+
+    // Get the tile shape of the array in the given row.
+    virtual IPosition tileShape (rownr_t rownr);
+
+    // Create the data set with the given number of rows, open, close
+    // or extend it.
+    // The caller must hold the lock on HDF5Object::libraryMutex.
+    // <group>
+    void create (rownr_t nrrow);
+    void open();
+    void close();
+    void addRow (rownr_t nrrow);
+    // </group>
+
+    // Get or put a scalar value in the given row.
+    // <group>
+    virtual void getBool     (rownr_t rownr, Bool* dataPtr);
+    virtual void getuChar    (rownr_t rownr, uChar* dataPtr);
+    virtual void getShort    (rownr_t rownr, Short* dataPtr);
+    virtual void getuShort   (rownr_t rownr, uShort* dataPtr);
+    virtual void getInt      (rownr_t rownr, Int* dataPtr);
+    virtual void getuInt     (rownr_t rownr, uInt* dataPtr);
+    virtual void getInt64    (rownr_t rownr, Int64* dataPtr);
+    virtual void getfloat    (rownr_t rownr, float* dataPtr);
+    virtual void getdouble   (rownr_t rownr, double* dataPtr);
+    virtual void getComplex  (rownr_t rownr, Complex* dataPtr);
+    virtual void getDComplex (rownr_t rownr, DComplex* dataPtr);
+    virtual void putBool     (rownr_t rownr, const Bool* dataPtr);
+    virtual void putuChar    (rownr_t rownr, const uChar* dataPtr);
+    virtual void putShort    (rownr_t rownr, const Short* dataPtr);
+    virtual void putuShort   (rownr_t rownr, const uShort* dataPtr);
+    virtual void putInt      (rownr_t rownr, const Int* dataPtr);
+    virtual void putuInt     (rownr_t rownr, const uInt* dataPtr);
+    virtual void putInt64    (rownr_t rownr, const Int64* dataPtr);
+    virtual void putfloat    (rownr_t rownr, const float* dataPtr);
+    virtual void putdouble   (rownr_t rownr, const double* dataPtr);
+    virtual void putComplex  (rownr_t rownr, const Complex* dataPtr);
+    virtual void putDComplex (rownr_t rownr, const DComplex* dataPtr);
+    // </group>
+
+    // Get or put the scalar values in all or some rows.
+    // <group>
+    virtual void getScalarColumnV (ArrayBase& data);
+    virtual void putScalarColumnV (const ArrayBase& data);
+    virtual void getScalarColumnCellsV (const RefRows& rownrs,
+                                        ArrayBase& data);
+    virtual void putScalarColumnCellsV (const RefRows& rownrs,
+                                        const ArrayBase& data);
+    // </group>
+
+    // Get or put the array (slice) in the given row.
+    // <group>
+    virtual void getArrayV (rownr_t rownr, ArrayBase& data);
+    virtual void putArrayV (rownr_t rownr, const ArrayBase& data);
+    virtual void getSliceV (rownr_t rownr, const Slicer& slicer,
+                            ArrayBase& data);
+    virtual void putSliceV (rownr_t rownr, const Slicer& slicer,
+                            const ArrayBase& data);
+    // </group>
+
+    // Get or put the arrays (slices) in all or some rows.
+    // <group>
+    virtual void getArrayColumnV (ArrayBase& data);
+    virtual void putArrayColumnV (const ArrayBase& data);
+    virtual void getArrayColumnCellsV (const RefRows& rownrs,
+                                       ArrayBase& data);
+    virtual void putArrayColumnCellsV (const RefRows& rownrs,
+                                       const ArrayBase& data);
+    virtual void getColumnSliceV (const Slicer& slicer, ArrayBase& data);
+    virtual void putColumnSliceV (const Slicer& slicer,
+                                  const ArrayBase& data);
+    virtual void getColumnSliceCellsV (const RefRows& rownrs,
+                                       const Slicer& slicer,
+                                       ArrayBase& data);
+    virtual void putColumnSliceCellsV (const RefRows& rownrs,
+                                       const Slicer& slicer,
+                                       const ArrayBase& data);
+    // </group>
+
+private:
+    // Forbid copy constructor.
+    HDF5StManColumn (const HDF5StManColumn&);
+
+    // Forbid assignment.
+    HDF5StManColumn& operator= (const HDF5StManColumn&);
+
+    // Make the HDF5 data type for the column's data type.
+    HDF5DataType makeDataType() const;
+
+    // Determine the tile shape of the data set from the default tile shape.
+    IPosition makeTileShape() const;
+
+    // Set the HDF5 chunk cache size to hold the tiles of a row of tiles.
+    void setCacheSize();
+
+    // Get the start, length and stride of a cell section
+    // (the full cell if no slicer is given).
+    void cellSection (const Slicer* slicer, IPosition& start,
+                      IPosition& length, IPosition& stride) const;
+
+    // Read or write the cell (section) of rows start, start+incr, ...
+    // in the data set from or into the buffer.
+    void accessRows (const Slicer* slicer, rownr_t start, rownr_t nrow,
+                     rownr_t incr, char* buf, Bool writeFlag);
+
+    // Read or write the rows given by rownrs from or into the array.
+    // <group>
+    void getCells (const RefRows& rownrs, const Slicer* slicer,
+                   ArrayBase& data);
+    void putCells (const RefRows& rownrs, const Slicer* slicer,
+                   const ArrayBase& data);
+    // </group>
+
+    // Read the hyperslab of the data set into the buffer.
+    // It is done by decompressing the chunks in parallel if possible.
+    void readSection (const IPosition& start, const IPosition& length,
+                      const IPosition& stride, char* buf);
+
+    // Write the buffer into the hyperslab of the data set.
+    void writeSection (const IPosition& start, const IPosition& length,
+                       const IPosition& stride, const char* buf);
+
+    // Read, decompress and copy the given chunk into the buffer.
+    void readChunk (const IPosition& chunkStart, const IPosition& start,
+                    const IPosition& length, const IPosition& stride,
+                    char* buf);
+
+
+    //# Data members
+    HDF5StMan*   parent_p;
+    Bool         isArray_p;
+    IPosition    shape_p;
+    HDF5DataSet* dataSet_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -60,6 +60,8 @@ ISMBase::ISMBase (uInt bucketSize, Bool checkBucketSize, uInt cacheSize)
   index_p           (0),
   persCacheSize_p   (cacheSize),
   cacheSize_p       (0),
+  origCacheSize_p   (0),
+  hasOrigCacheSize_p (False),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -81,6 +83,8 @@ ISMBase::ISMBase (const String& dataManagerName,
   index_p           (0),
   persCacheSize_p   (cacheSize),
   cacheSize_p       (0),
+  origCacheSize_p   (0),
+  hasOrigCacheSize_p (False),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -101,6 +105,8 @@ ISMBase::ISMBase (const String& dataManagerName, const Record& spec)
   index_p           (0),
   persCacheSize_p   (1),
   cacheSize_p       (0),
+  origCacheSize_p   (0),
+  hasOrigCacheSize_p (False),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -131,6 +137,8 @@ ISMBase::ISMBase (const ISMBase& that)
   index_p           (0),
   persCacheSize_p   (that.persCacheSize_p),
   cacheSize_p       (that.cacheSize_p),
+  origCacheSize_p   (0),
+  hasOrigCacheSize_p (False),
   nbucketInit_p     (1),
   nFreeBucket_p     (0),
   firstFree_p       (-1),
@@ -206,6 +214,73 @@ void ISMBase::showCacheStatistics (ostream& os) const
     }
 }
 
+Record ISMBase::cacheStatistics() const
+{
+    Record rec;
+    addCacheStatistics (rec, cache_p);
+    return rec;
+}
+
+uInt64 ISMBase::cacheDemand() const
+{
+    uInt nbucket = (cache_p == 0  ?  nbucketInit_p : cache_p->nBucket());
+    return uInt64(nbucket) * bucketSize_p;
+}
+
+void ISMBase::setCacheMemory (uInt64 nbytes)
+{
+    if (!hasOrigCacheSize_p) {
+        origCacheSize_p    = cacheSize_p;
+        hasOrigCacheSize_p = True;
+    }
+    setCacheSize (uInt(std::max (uInt64(1), nbytes / bucketSize_p)), True);
+}
+
+void ISMBase::resetCacheMemory()
+{
+    if (hasOrigCacheSize_p) {
+        //# A size of 0 means that the cache did not exist yet.
+        setCacheSize (origCacheSize_p == 0 ? persCacheSize_p : origCacheSize_p,
+                      True);
+        hasOrigCacheSize_p = False;
+    }
+}
+
+Int64 ISMBase::vacuum()
+{
+    if (iosfile_p == 0) {
+        return 0;
+    }
+    std::vector<ISMIndColumn*> columns;
+    for (uInt i=0; i<ncolumn(); i++) {
+        ISMIndColumn* column = dynamic_cast<ISMIndColumn*>(colSet_p[i]);
+        if (column != 0) {
+            columns.push_back (column);
+        }
+    }
+    std::map<Int64,int> arrays;
+    for (ISMIndColumn* column : columns) {
+        column->collectArrays (arrays);
+    }
+    //# The buckets with the new offsets are written before the file
+    //# can overwrite the old arrays.
+    Int64 nregained = iosfile_p->compact
+        (arrays,
+         [&] (const std::map<Int64,Int64>& offsets) {
+             for (ISMIndColumn* column : columns) {
+                 column->updateArrays (offsets);
+             }
+             if (cache_p != 0) {
+                 cache_p->flush();
+             }
+             file_p->fsync();
+         });
+    if (nregained > 0) {
+        dataChanged_p = True;
+    }
+    return nregained;
+}
+
 void ISMBase::showIndexStatistics (ostream& os)
 {
     if (index_p != 0) {
@@ -297,6 +372,7 @@ void ISMBase::makeCache()
 	    tempBuffer_p = new char [bucketSize_p];
 	    AlwaysAssert (tempBuffer_p != 0, AipsError);
 	}
+	publishCacheDemand();
     }
 }
 
@@ -355,9 +431,28 @@ void ISMBase::readIndex()
 	os >> firstFree_p;
     }
     os.getend();
-    Int64 off = nbucketInit_p;
-    os.setpos (512 + off * bucketSize_p);
-    index_p->get (os);
+    Int64 off = 512 + Int64(nbucketInit_p) * bucketSize_p;
+    // Map the index part of the file if possible, so the index can be
+    // converted without copying.
+    CountedPtr<ByteIO> mio;
+    if (canMapFiles()) {
+        mio = file_p->makeMappedIO (off);
+    }
+    if (mio.null()) {
+        os.setpos (off);
+        index_p->get (os);
+    } else {
+        TypeIO* mtio;
+        if (asBigEndian()) {
+            mtio = new CanonicalIO (mio.get());
+        }else{
+            mtio = new LECanonicalIO (mio.get());
+        }
+        AipsIO mos (mtio);
+        index_p->get (mos);
+        mos.close();
+        delete mtio;
+    }
     os.close();
     delete tio;
 }
@@ -409,6 +504,7 @@ ISMBucket* ISMBase::getBucket (rownr_t rownr, rownr_t& bucketStartRow,
 {
     uInt bucketNr = getIndex().getBucketNr (rownr, bucketStartRow,
                                             bucketNrrow);
+    countMetrics (TableTrace::ACCESSES);
     return (ISMBucket*) (getCache().getBucket (bucketNr));
 }
 
@@ -418,6 +514,7 @@ ISMBucket* ISMBase::nextBucket (uInt& cursor, rownr_t& bucketStartRow,
     uInt bucketNr;
     if (getIndex().nextBucketNr (cursor, bucketStartRow,
 				  bucketNrrow, bucketNr)) {
+	countMetrics (TableTrace::ACCESSES);
 	return (ISMBucket*) (getCache().getBucket (bucketNr));
     }
     return 0;
@@ -548,7 +645,8 @@ void ISMBase::recreate()
     nbucketInit_p = 1;
     nFreeBucket_p = 0;
     firstFree_p   = -1;
-    file_p = new BucketFile (fileName(), 0, False, multiFile());
+    file_p = new BucketFile (fileName(), 0, False, multiFile(),
+                             tsmOption().useODirect());
     AlwaysAssert (file_p != 0, AipsError);
     index_p = new ISMIndex (this);
     AlwaysAssert (index_p != 0, AipsError);
@@ -591,6 +689,22 @@ Bool ISMBase::flush (AipsIO& ios, Bool fsync)
     return changed;
 }
 
+Bool ISMBase::canFsyncFiles() const
+{
+    return True;
+}
+
+void ISMBase::fsyncFiles()
+{
+    if (file_p != 0) {
+	file_p->fdatasync();
+    }
+    //# Indirect arrays are kept in a file per column.
+    for (uInt i=0; i<ncolumn(); i++) {
+	colSet_p[i]->fsyncFiles();
+    }
+}
+
 rownr_t ISMBase::resync64 (rownr_t nrrow)
 {
     nrrow_p = nrrow;
@@ -628,7 +742,7 @@ rownr_t ISMBase::open64 (rownr_t tabNrrow, AipsIO& ios)
     ios.getend();
     init();
     file_p = new BucketFile (fileName(), table().isWritable(),
-                             0, False, multiFile());
+                             0, False, multiFile(), tsmOption().useODirect());
     AlwaysAssert (file_p != 0, AipsError);
     //# Westerbork MSs have a problem, because TMS used for a while
     //# the erroneous version of ISMBase.cc.
@@ -153,6 +153,23 @@ public:
     // Show the statistics of all caches used.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Get the statistics of the cache.
+    virtual Record cacheStatistics() const;
+
+    // Get the size of the file in bytes.
+    virtual uInt64 cacheDemand() const;
+
+    // Set the cache size to the given number of bytes (at least 1 bucket).
+    virtual void setCacheMemory (uInt64 nbytes);
+
+    // Restore the cache size used before <src>setCacheMemory</src>.
+    virtual void resetCacheMemory();
+
+    // Compact the file holding the indirect arrays.
+    // Nothing is done for files older than version 3, which use a
+    // file per column.
+    virtual Int64 vacuum();
+
     // Show the index statistics.
     void showIndexStatistics (ostream& os);
 
@@ -256,6 +273,12 @@ private:
     // It returns a True status if it had to flush (i.e. if data have changed).
     virtual Bool flush (AipsIO&, Bool fsync);
 
+    // The files can be fsync-ed separately from flush.
+    // <group>
+    virtual Bool canFsyncFiles() const;
+    virtual void fsyncFiles();
+    // </group>
+
     // Let the storage manager create files as needed for a new table.
     // This allows a column with an indirect array to create its file.
     virtual void create64 (rownr_t nrrow);
@@ -363,6 +386,9 @@ private:
     uInt persCacheSize_p;
     // The actual cache size.
     uInt cacheSize_p;
+    // The cache size before a cache budget was applied.
+    uInt origCacheSize_p;
+    Bool hasOrigCacheSize_p;
     // The initial number of buckets in the cache.
     uInt nbucketInit_p;
     // The nr of free buckets.
@@ -426,6 +452,7 @@ inline char* ISMBase::tempBuffer() const
 
 inline BucketCache& ISMBase::getCache()
 {
+    applyCacheBudget();
     if (cache_p == 0) {
 	makeCache();
     }
@@ -285,12 +285,18 @@ uInt ISMBucket::insertData (const char* data, uInt leng)
 
 char* ISMBucket::readCallBack (void* owner, const char* bucketStorage)
 {
-    ISMBucket* bucket = new ISMBucket ((ISMBase*)owner, bucketStorage);
+    ISMBase* ism = (ISMBase*)owner;
+    ism->countMetrics (TableTrace::MISSES);
+    ism->countMetrics (TableTrace::BYTESREAD, ism->bucketSize());
+    ISMBucket* bucket = new ISMBucket (ism, bucketStorage);
     AlwaysAssert (bucket != 0, AipsError);
     return (char*)bucket;
 }
-void ISMBucket::writeCallBack (void*, char* bucketStorage, const char* local)
+void ISMBucket::writeCallBack (void* owner, char* bucketStorage,
+                               const char* local)
 {
+    ISMBase* ism = (ISMBase*)owner;
+    ism->countMetrics (TableTrace::BYTESWRITTEN, ism->bucketSize());
     ((ISMBucket*)local)->write (bucketStorage);
 }
 void ISMBucket::deleteCallBack (void*, char* bucket)
@@ -1185,6 +1185,8 @@ Bool ISMColumn::flush (rownr_t, Bool)
 {
     return False;
 }
+void ISMColumn::fsyncFiles()
+{}
 void ISMColumn::resync (rownr_t nrrow)
 {
     // Invalidate the last value read.
@@ -144,6 +144,10 @@ public:
     // This is meant for a derived class.
     virtual Bool flush (rownr_t nrrow, Bool fsync);
 
+    // Fsync the files written by the last flush.
+    // This is meant for a derived class.
+    virtual void fsyncFiles();
+
     // Resync the storage manager with the new file contents.
     // It resets the last rownr put.
     void resync (rownr_t nrrow);
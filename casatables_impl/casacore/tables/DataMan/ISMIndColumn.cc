@@ -28,6 +28,7 @@
 //# Includes
 #include <casacore/tables/DataMan/ISMIndColumn.h>
 #include <casacore/tables/DataMan/ISMBucket.h>
+#include <casacore/tables/DataMan/ISMBase.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Slicer.h>
@@ -39,6 +40,7 @@
 #include <casacore/tables/DataMan/DataManError.h>
 
 #include <casacore/casa/stdio.h>                     // for sprintf
+#include <set>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -90,6 +92,10 @@ Bool ISMIndColumn::flush (rownr_t, Bool fsync)
 {
     return iosfile_p->flush (fsync);
 }
+void ISMIndColumn::fsyncFiles()
+{
+    iosfile_p->fsync();
+}
 void ISMIndColumn::resync (rownr_t nrrow)
 {
     ISMColumn::resync (nrrow);
@@ -197,6 +203,24 @@ uInt ISMIndColumn::ndim (rownr_t rownr)
 IPosition ISMIndColumn::shape (rownr_t rownr)
     { return getShape(rownr)->shape(); }
 
+void ISMIndColumn::getShapes (rownr_t startRow, rownr_t nrow,
+                              std::vector<IPosition>& shapes)
+{
+    std::vector<Int64> offsets (nrow);
+    rownr_t endRow = startRow + nrow;
+    rownr_t rownr = startRow;
+    while (rownr < endRow) {
+        //# The value found is valid for the rows till endRow_p.
+        StIndArray* ptr = getArrayPtr (rownr);
+        Int64 offset = (ptr == 0  ?  0 : ptr->fileOffset());
+        rownr_t last = std::min (endRow_p + 1, endRow);
+        for (; rownr < last; ++rownr) {
+            offsets[rownr - startRow] = offset;
+        }
+    }
+    iosfile_p->getShapes (offsets, shapes);
+}
+
 Bool ISMIndColumn::canChangeShape() const
     { return (shapeIsFixed_p  ?  False : True); }
 
@@ -292,6 +316,59 @@ void ISMIndColumn::init (ByteIO::OpenOption fileOption)
 }
 
 
+void ISMIndColumn::collectArrays (std::map<Int64,int>& arrays)
+{
+    uInt cursor = 0;
+    rownr_t bucketStartRow = 0;
+    rownr_t bucketNrrow;
+    ISMBucket* bucket;
+    while ((bucket = stmanPtr_p->nextBucket (cursor, bucketStartRow,
+                                             bucketNrrow)) != 0) {
+        const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+        uInt nused = bucket->indexUsed (colnr_p);
+        for (uInt i=0; i<nused; i++) {
+            Int64 offset;
+            readFunc_p (&offset, bucket->get (offIndex[i]), nrcopy_p);
+            if (offset != 0) {
+                arrays[offset] = dataType();
+            }
+        }
+    }
+}
+
+void ISMIndColumn::updateArrays (const std::map<Int64,Int64>& offsets)
+{
+    uInt cursor = 0;
+    rownr_t bucketStartRow = 0;
+    rownr_t bucketNrrow;
+    ISMBucket* bucket;
+    while ((bucket = stmanPtr_p->nextBucket (cursor, bucketStartRow,
+                                             bucketNrrow)) != 0) {
+        const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+        uInt nused = bucket->indexUsed (colnr_p);
+        //# Rows can share a value, which must be updated only once.
+        std::set<uInt> done;
+        for (uInt i=0; i<nused; i++) {
+            if (done.insert (offIndex[i]).second) {
+                char* value = const_cast<char*>(bucket->get (offIndex[i]));
+                Int64 offset;
+                readFunc_p (&offset, value, nrcopy_p);
+                if (offset != 0) {
+                    Int64 newOffset = offsets.at (offset);
+                    if (newOffset != offset) {
+                        writeFunc_p (value, &newOffset, nrcopy_p);
+                        stmanPtr_p->setBucketDirty();
+                    }
+                }
+            }
+        }
+    }
+    //# Invalidate the last value read.
+    startRow_p   = 1;
+    endRow_p     = 0;
+    foundArray_p = False;
+}
+
 void ISMIndColumn::handleCopy (rownr_t, const char* value)
 {
     Int64 offset;
@@ -34,6 +34,7 @@
 #include <casacore/tables/DataMan/ISMColumn.h>
 #include <casacore/tables/DataMan/StIndArray.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -126,6 +127,10 @@ public:
     // Get the shape of the array in the given row.
     virtual IPosition shape (rownr_t rownr);
 
+    // Get the shapes of the arrays in a range of rows.
+    virtual void getShapes (rownr_t startRow, rownr_t nrow,
+                            std::vector<IPosition>& shapes);
+
     // This storage manager can handle changing array shapes.
     virtual Bool canChangeShape() const;
 
@@ -158,6 +163,9 @@ public:
     // Flush and optionally fsync the data.
     virtual Bool flush (rownr_t nrrow, Bool fsync);
 
+    // Fsync the file holding the arrays.
+    virtual void fsyncFiles();
+
     // Resync the storage manager with the new file contents.
     virtual void resync (rownr_t nrrow);
 
@@ -170,6 +178,14 @@ public:
     // Handle the removal of a value; i.e. decrement its reference count.
     virtual void handleRemove (rownr_t rownr, const char* value);
 
+    // Add the file offset and data type of the arrays in the column
+    // to the map (used to compact the file).
+    void collectArrays (std::map<Int64,int>& arrays);
+
+    // Replace the file offsets of the arrays by their new offsets after
+    // the file has been compacted.
+    void updateArrays (const std::map<Int64,Int64>& offsets);
+
 private:
     // Forbid copy constructor.
     ISMIndColumn (const ISMIndColumn&);
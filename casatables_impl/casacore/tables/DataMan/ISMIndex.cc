@@ -56,11 +56,15 @@ void ISMIndex::get (AipsIO& os)
       // stored as 64-bit
       getBlock (os, rows_p);
     } else {
-      // stored as 32-bit
-      Block<uInt> rows;
-      getBlock (os, rows);
-      rows_p.resize (rows.size());
-      std::copy (rows.begin(), rows.end(), rows_p.begin());
+      // stored as 32-bit (as a Block object); avoid an extra copy
+      uInt nrow;
+      const uInt* rows;
+      Block<uInt> buffer;
+      os.getstart ("Block");
+      os.getview (nrow, rows, buffer);
+      rows_p.resize (nrow);
+      std::copy (rows, rows + nrow, rows_p.begin());
+      os.getend();
     }
     getBlock (os, bucketNr_p);
     os.getend();
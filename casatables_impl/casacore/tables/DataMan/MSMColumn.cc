@@ -28,6 +28,7 @@
 #include <casacore/tables/DataMan/MSMColumn.h>
 #include <casacore/tables/DataMan/MSMBase.h>
 #include <casacore/tables/Tables/RefRows.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/BasicMath/Math.h>
@@ -36,6 +37,8 @@
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/string.h>                           // for memcpy
+#include <stdlib.h>                                         // for realloc
+#include <new>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -49,7 +52,8 @@ MSMColumn::MSMColumn (MSMBase* smptr, int dataType, Bool byPtr)
   nralloc_p  (0),
   nrext_p    (0),
   data_p     (EXTBLSZ,static_cast<void*>(0)),
-  ncum_p     (EXTBLSZ,(rownr_t)0)
+  ncum_p     (EXTBLSZ,(rownr_t)0),
+  nrvalRow_p (1)
 {}
 
 MSMColumn::~MSMColumn()
@@ -61,14 +65,16 @@ MSMColumn::~MSMColumn()
 void MSMColumn::doCreate (rownr_t nrrow)
 {
   addRow (nrrow, 0);
-  initData (data_p[1], nrrow);
+  initData (data_p[1], nrrow * nrvalRow_p);
 }
 
 void MSMColumn::addRow (rownr_t nrnew, rownr_t)
 {
   //# Extend the column sizes if needed.
+  //# Grow by 50% (and at least 4096 rows) to make appending rows
+  //# one by one take amortized constant time.
   if (nrnew > nralloc_p) {
-    rownr_t n = nralloc_p + 4096;
+    rownr_t n = nralloc_p + max(nralloc_p/2, rownr_t(4096));
     if (n < nrnew) {
       n = nrnew;
     }
@@ -78,19 +84,111 @@ void MSMColumn::addRow (rownr_t nrnew, rownr_t)
 
 void MSMColumn::resize (rownr_t nr)
 {
-  //# Extend internal blocks if needed.
-  if (nrext_p+1 >= data_p.nelements()) {
-    //#cout << "resize internal blocks " << nrext_p << endl;
-    data_p.resize(nrext_p + 1+EXTBLSZ);
-    ncum_p.resize(nrext_p + 1+EXTBLSZ);
-  }
-  //# Allocate another block of the correct data type.
-  data_p[nrext_p+1] = allocData (nr-nralloc_p, byPtr_p);
-  //#cout << "allocated new block " << nr-nralloc_p << endl;
-  nrext_p++;
-  ncum_p[nrext_p] = nr;
+  if (nrext_p == 0) {
+    data_p[1] = allocData (nr * nrvalRow_p, byPtr_p);
+    nrext_p = 1;
+  } else {
+    //# Reallocate the only extension, so all rows remain contiguous.
+    DebugAssert (nrext_p == 1, AipsError);
+    if (!byPtr_p  &&  dtype() == TpString) {
+      data_p[1] = reallocStrings (static_cast<String*>(data_p[1]),
+                                  nralloc_p * nrvalRow_p, nr * nrvalRow_p);
+    } else {
+      data_p[1] = reallocData (data_p[1], nralloc_p * nrvalRow_p,
+                               nr * nrvalRow_p, byPtr_p);
+    }
+    //# The cache may refer to the old data block.
+    columnCache().invalidate();
+  }
+  ncum_p[1] = nr;
   nralloc_p = nr;
-  return;
+}
+
+void MSMColumn::setNrvalRow (rownr_t nrval)
+{
+  if (nrval != nrvalRow_p) {
+    if (nralloc_p > 0) {
+      throw DataManInternalError ("MSMColumn::setNrvalRow: column " +
+                                  columnName() + " already has rows");
+    }
+    nrvalRow_p = nrval;
+  }
+}
+
+void* MSMColumn::getDataPtr (rownr_t rownr)
+{
+  uInt extnr = findExt(rownr, False);
+  rownr_t inx = (rownr - ncum_p[extnr-1]) * nrvalRow_p;
+  if (dtype() == TpString) {
+    return static_cast<String*>(data_p[extnr]) + inx;
+  }
+  return static_cast<char*>(data_p[extnr]) + inx * elemSize();
+}
+
+void MSMColumn::getValues (const RefRows& rownrs, void* to)
+{
+  char* top = static_cast<char*>(to);
+  RefRowsSliceIter iter(rownrs);
+  while (! iter.pastEnd()) {
+    rownr_t rownr = iter.sliceStart();
+    rownr_t end   = iter.sliceEnd();
+    rownr_t incr  = iter.sliceIncr();
+    //# All rows are in one extension, so a range of rows is contiguous.
+    if (incr == 1) {
+      copyValues (top, rownr, end - rownr + 1);
+    } else {
+      for (; rownr <= end; rownr += incr) {
+        copyValues (top, rownr, 1);
+      }
+    }
+    iter++;
+  }
+}
+
+void MSMColumn::copyValues (char*& to, rownr_t rownr, rownr_t nrow)
+{
+  rownr_t nrval = nrow * nrvalRow_p;
+  if (dtype() == TpString) {
+    objcopy (reinterpret_cast<String*>(to),
+             static_cast<const String*>(getDataPtr (rownr)), nrval);
+    to += nrval * sizeof(String);
+  } else {
+    memcpy (to, getDataPtr (rownr), nrval * elemSize());
+    to += nrval * elemSize();
+  }
+}
+
+void MSMColumn::putValues (const RefRows& rownrs, const void* from)
+{
+  const char* fromp = static_cast<const char*>(from);
+  RefRowsSliceIter iter(rownrs);
+  while (! iter.pastEnd()) {
+    rownr_t rownr = iter.sliceStart();
+    rownr_t end   = iter.sliceEnd();
+    rownr_t incr  = iter.sliceIncr();
+    if (incr == 1) {
+      storeValues (fromp, rownr, end - rownr + 1);
+    } else {
+      for (; rownr <= end; rownr += incr) {
+        storeValues (fromp, rownr, 1);
+      }
+    }
+    iter++;
+  }
+  stmanPtr_p->setHasPut();
+}
+
+void MSMColumn::storeValues (const char*& from, rownr_t rownr, rownr_t nrow)
+{
+  rownr_t nrval = nrow * nrvalRow_p;
+  if (dtype() == TpString) {
+    objcopy (static_cast<String*>(getDataPtr (rownr)),
+             reinterpret_cast<const String*>(from), nrval);
+    from += nrval * sizeof(String);
+  } else {
+    memcpy (getDataPtr (rownr), from, nrval * elemSize());
+    from += nrval * elemSize();
+  }
 }
 
 
@@ -158,6 +256,19 @@ void MSMColumn::getScalarColumnV (ArrayBase& vec)
   vec.putVStorage (ptr, deleteIt);
 }
 
+void MSMColumn::getScalarColumnCellsV (const RefRows& rownrs,
+                                       ArrayBase& vec)
+{
+  if (byPtr_p) {
+    StManColumnBase::getScalarColumnCellsV (rownrs, vec);
+    return;
+  }
+  Bool deleteIt;
+  void* ptr = vec.getVStorage (deleteIt);
+  getValues (rownrs, ptr);
+  vec.putVStorage (ptr, deleteIt);
+}
+
 void MSMColumn::putScalarColumnV (const ArrayBase& vec)
 {
   rownr_t nrow = stmanPtr_p->nrow();
@@ -189,6 +300,19 @@ void MSMColumn::putScalarColumnV (const ArrayBase& vec)
   vec.freeVStorage (ptr, deleteIt);
 }
 
+void MSMColumn::putScalarColumnCellsV (const RefRows& rownrs,
+                                       const ArrayBase& vec)
+{
+  if (byPtr_p) {
+    StManColumnBase::putScalarColumnCellsV (rownrs, vec);
+    return;
+  }
+  Bool deleteIt;
+  const void* ptr = vec.getVStorage (deleteIt);
+  putValues (rownrs, ptr);
+  vec.freeVStorage (ptr, deleteIt);
+}
+
 void MSMColumn::getBool (rownr_t rownr, Bool* value)
 {
   // Note that the ColumnCache references the appropriate data array in data_p.
@@ -525,11 +649,11 @@ void MSMColumn::deleteAll()
 void MSMColumn::deleteData (void* datap, Bool byPtr)
 {
   if (byPtr) {
-    delete [] static_cast<void**>(datap);
+    free (datap);
   } else if (dtype() == TpString) {
     delete [] static_cast<String*>(datap);
   } else {
-    delete [] static_cast<char*>(datap);
+    free (datap);
   }
   datap = 0;
 }
@@ -537,17 +661,46 @@ void MSMColumn::deleteData (void* datap, Bool byPtr)
 
 void* MSMColumn::allocData (rownr_t nrval, Bool byPtr)
 {
+  //# Numeric values and pointers use malloc, so they can be reallocated.
   void* datap = 0;
   if (byPtr) {
-    datap = new void*[nrval];
-    memset (datap, 0, nrval*sizeof(void*));
+    datap = calloc (nrval, sizeof(void*));
   } else if (dtype() == TpString) {
     datap = new String[nrval];
   } else {
-    datap = new char[nrval * elemSize()];
+    datap = malloc (nrval * elemSize());
+  }
+  if (datap == 0  &&  nrval > 0) {
+    throw std::bad_alloc();
   }
   return datap;
 }
+
+void* MSMColumn::reallocData (void* datap, rownr_t nrold, rownr_t nrnew,
+                              Bool byPtr)
+{
+  size_t size = (byPtr  ?  sizeof(void*) : elemSize());
+  void* newp = realloc (datap, nrnew * size);
+  if (newp == 0  &&  nrnew > 0) {
+    throw std::bad_alloc();
+  }
+  if (byPtr  &&  nrnew > nrold) {
+    memset (static_cast<void**>(newp) + nrold, 0,
+            (nrnew-nrold) * sizeof(void*));
+  }
+  return newp;
+}
+
+String* MSMColumn::reallocStrings (String* oldp, rownr_t nrold,
+                                   rownr_t nrnew)
+{
+  String* newp = new String[nrnew];
+  for (rownr_t i=0; i<min(nrold,nrnew); ++i) {
+    newp[i].swap (oldp[i]);
+  }
+  delete [] oldp;
+  return newp;
+}
 	
 
 void MSMColumn::removeData (void* dp, rownr_t inx, rownr_t nrvalAfter)
@@ -555,16 +708,18 @@ void MSMColumn::removeData (void* dp, rownr_t inx, rownr_t nrvalAfter)
   if (inx >= nrvalAfter) {
     return;
   }
+  //# Convert rows to values.
+  rownr_t n = nrvalRow_p;
   if (byPtr_p) {
-    objmove (static_cast<void**>(dp) + inx,
-             static_cast<void**>(dp) + inx+1, nrvalAfter-inx);
+    objmove (static_cast<void**>(dp) + inx*n,
+             static_cast<void**>(dp) + (inx+1)*n, (nrvalAfter-inx)*n);
   } else if (dtype() == TpString) {
-    objmove (static_cast<String*>(dp) + inx,
-             static_cast<String*>(dp) + inx+1, nrvalAfter-inx);
+    objmove (static_cast<String*>(dp) + inx*n,
+             static_cast<String*>(dp) + (inx+1)*n, (nrvalAfter-inx)*n);
   } else {
-    memmove (static_cast<char*>(dp) + inx*elemSize(),
-             static_cast<char*>(dp) + (inx+1)*elemSize(),
-             (nrvalAfter-inx)*elemSize());
+    memmove (static_cast<char*>(dp) + inx*n*elemSize(),
+             static_cast<char*>(dp) + (inx+1)*n*elemSize(),
+             (nrvalAfter-inx)*n*elemSize());
   }
 }
 
@@ -41,6 +41,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward declarations
 class MSMBase;
+class RefRows;
 
 
 // <summary>
@@ -78,14 +79,18 @@ class MSMBase;
 //        to the array in each row.
 // </ol>
 //
-// MSMColumn does not hold a column as a consecutive array,
-// because extending the column (i.e. adding rows) proved be too
-// expensive due to the repeated copying involved when creating a table
-// (this method was used by the first version of the table system).
-// Instead it has a number of data blocks (extensions) indexed to by a
-// super block. Accessing a row means finding the appropriate extension
-// via a binary search. Because there is only 1 extension when a table is
-// read back, the overhead in finding a row is small.
+// MSMColumn holds a column as a single consecutive array.
+// When rows are added, the array grows geometrically (by 50%) so that
+// appending rows one by one takes amortized constant time. Numeric data
+// are reallocated with realloc, which for large arrays can remap the
+// pages instead of copying them. Because all rows are in one array,
+// accessing a row does not require a search and getting a range of
+// rows is a single copy.
+// The data are still described as a super block of data blocks
+// (extensions) as used by StManAipsIO, but there is at most 1 extension.
+//
+// The derived class MSMDirColumn stores its fixed-shape arrays
+// directly in the column array, so each row holds several values.
 // </synopsis> 
 
 // <motivation>
@@ -151,16 +156,27 @@ public:
   // (which is guaranteed by the ScalarColumn getColumn function).
   virtual void getScalarColumnV (ArrayBase& data);
 
+  // Get some scalar values in the column.
+  // Ranges of rows are copied in one go.
+  virtual void getScalarColumnCellsV (const RefRows& rownrs,
+                                      ArrayBase& data);
+
   // Put all scalar values in the column.
   // The vector given in <src>data</src> has to have the correct length
   // (which is guaranteed by the ScalarColumn putColumn function).
   virtual void putScalarColumnV (const ArrayBase& data);
 
+  // Put some scalar values in the column.
+  // Ranges of rows are copied in one go.
+  virtual void putScalarColumnCellsV (const RefRows& rownrs,
+                                      const ArrayBase& data);
+
   // Add (newNrrow-oldNrrow) rows to the column.
   virtual void addRow (rownr_t newNrrow, rownr_t oldNrrow);
 
-  // Resize the data blocks.
-  // This adds an extension when needed.
+  // Resize the data block to hold the given number of rows.
+  // The first call allocates the (only) extension; subsequent calls
+  // reallocate it, keeping the existing values.
   void resize (rownr_t nrval);
 
   // Remove the given row.
@@ -197,6 +213,23 @@ protected:
   Block<void*> data_p;
   // The cumulative nr of rows in all extensions.
   Block<rownr_t> ncum_p;
+  // The nr of values stored in each row (1 unless set by a derived class).
+  rownr_t  nrvalRow_p;
+
+  // Set the nr of values stored in each row.
+  // It can only be changed as long as no rows have been allocated.
+  void setNrvalRow (rownr_t nrval);
+
+  // Get a pointer to the values in the given row.
+  void* getDataPtr (rownr_t rownr);
+
+  // Copy the values in the given rows to contiguous storage.
+  // Ranges of rows are copied in one go.
+  void getValues (const RefRows& rownrs, void* to);
+
+  // Copy contiguous values to the given rows.
+  // Ranges of rows are copied in one go.
+  void putValues (const RefRows& rownrs, const void* from);
 
   // Find the extension in which the row number is.
   // If the flag is true, it also sets the columnCache object.
@@ -205,6 +238,23 @@ protected:
   // Allocate an extension with the data type of the column.
   void* allocData (rownr_t nrval, Bool byPtr);
 
+  // Copy the values of nrow rows starting at the given row and
+  // advance the destination pointer.
+  void copyValues (char*& to, rownr_t rownr, rownr_t nrow);
+
+  // Copy the values of nrow rows to the given row and
+  // advance the source pointer.
+  void storeValues (const char*& from, rownr_t rownr, rownr_t nrow);
+
+  // Reallocate an extension of nrold values to nrnew values.
+  // Pointers in the new part are set to zero.
+  // It cannot be used for String values.
+  void* reallocData (void* datap, rownr_t nrold, rownr_t nrnew, Bool byPtr);
+
+  // Reallocate an extension of nrold String values to nrnew values.
+  // The existing values are moved into the new extension.
+  String* reallocStrings (String* oldp, rownr_t nrold, rownr_t nrnew);
+
   // Delete all extensions.
   // Possible underlying data (as used by StManArrayColumnMemory)
   // will not be deleted and should have been deleted beforehand.
@@ -215,7 +265,7 @@ protected:
 
   // Remove an entry (i.e. a row) from an extension at the given index.
   // It will do this by shifting the rest (nrvalAfter elements)
-  // one position to the left.
+  // one position to the left. Index and counts are in rows.
   void removeData (void* datap, rownr_t inx, rownr_t nrvalAfter);
 
   // Initialize the data (after an open).
@@ -28,6 +28,7 @@
 
 #include <casacore/tables/DataMan/MSMDirColumn.h>
 #include <casacore/tables/DataMan/MSMBase.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Slicer.h>
@@ -41,44 +42,20 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 MSMDirColumn::MSMDirColumn (MSMBase* smptr, int dataType)
-: MSMColumn (smptr, dataType, True),
+: MSMColumn (smptr, dataType, False),
   nrelem_p  (0)
 {}
 
 MSMDirColumn::~MSMDirColumn()
-{
-  rownr_t nr = stmanPtr_p->nrow();
-  for (rownr_t i=0; i<nr; i++) {
-    deleteArray (i);
-  }
-}
+{}
 
 
 void MSMDirColumn::setShapeColumn (const IPosition& shape)
 {
   shape_p  = shape;
   nrelem_p = shape.product();
-}
-
-
-void MSMDirColumn::addRow (rownr_t nrnew, rownr_t nrold)
-{
-  //# Extend data blocks if needed.
-  MSMColumn::addRow (nrnew, nrold);
-  //# Allocate the fixed shape data arrays.
-  void* ptr;
-  for (; nrold<nrnew; nrold++) {
-    ptr = allocData (nrelem_p, False);
-    putArrayPtr (nrold, ptr);
-  }
-}
-
-void MSMDirColumn::doCreate (rownr_t nrrow)
-{
-  addRow (nrrow, 0);
-  for (rownr_t i=0; i<nrrow; i++) {
-    initData (getArrayPtr(i), nrelem_p);
-  } 
+  //# The arrays are stored directly in the column data.
+  setNrvalRow (nrelem_p);
 }
 
 uInt MSMDirColumn::ndim (rownr_t)
@@ -95,11 +72,11 @@ void MSMDirColumn::getArrayV (rownr_t rownr, ArrayBase& arr)
     void* data = arr.getVStorage (deleteIt);
     if (dtype() == TpString) {
       objcopy (static_cast<String*>(data),
-               static_cast<const String*>(getArrayPtr (rownr)),
+               static_cast<const String*>(getDataPtr (rownr)),
                nrelem_p);
     } else {
       memcpy (static_cast<char*>(data),
-              static_cast<const char*>(getArrayPtr (rownr)),
+              static_cast<const char*>(getDataPtr (rownr)),
               elemSize() * nrelem_p);
     }
     arr.putVStorage (data, deleteIt);
@@ -110,11 +87,11 @@ void MSMDirColumn::putArrayV (rownr_t rownr, const ArrayBase& arr)
     Bool deleteIt;
     const void* data = arr.getVStorage (deleteIt);
     if (dtype() == TpString) {
-      objcopy (static_cast<String*>(getArrayPtr (rownr)),
+      objcopy (static_cast<String*>(getDataPtr (rownr)),
                static_cast<const String*>(data),
                nrelem_p);
     } else {
-      memcpy (static_cast<char*>(getArrayPtr (rownr)),
+      memcpy (static_cast<char*>(getDataPtr (rownr)),
               static_cast<const char*>(data),
               elemSize() * nrelem_p);
     }
@@ -122,6 +99,42 @@ void MSMDirColumn::putArrayV (rownr_t rownr, const ArrayBase& arr)
     stmanPtr_p->setHasPut();
 }
 
+void MSMDirColumn::getArrayColumnV (ArrayBase& arr)
+{
+  rownr_t nrow = stmanPtr_p->nrow();
+  if (nrow > 0) {
+    getArrayColumnCellsV (RefRows (0, nrow - 1), arr);
+  }
+}
+
+void MSMDirColumn::getArrayColumnCellsV (const RefRows& rownrs,
+                                         ArrayBase& arr)
+{
+  // The arrays of consecutive rows are adjacent in the column data,
+  // so a range of rows is copied in one go.
+  Bool deleteIt;
+  void* data = arr.getVStorage (deleteIt);
+  getValues (rownrs, data);
+  arr.putVStorage (data, deleteIt);
+}
+
+void MSMDirColumn::putArrayColumnV (const ArrayBase& arr)
+{
+  rownr_t nrow = stmanPtr_p->nrow();
+  if (nrow > 0) {
+    putArrayColumnCellsV (RefRows (0, nrow - 1), arr);
+  }
+}
+
+void MSMDirColumn::putArrayColumnCellsV (const RefRows& rownrs,
+                                         const ArrayBase& arr)
+{
+  Bool deleteIt;
+  const void* data = arr.getVStorage (deleteIt);
+  putValues (rownrs, data);
+  arr.freeVStorage (data, deleteIt);
+}
+
 void MSMDirColumn::getSliceV (rownr_t rownr, const Slicer& slicer, ArrayBase& arr)
 {
   switch (dtype()) {
@@ -212,18 +225,5 @@ void MSMDirColumn::putSliceV (rownr_t rownr, const Slicer& slicer, const ArrayBa
 }
 
 
-void MSMDirColumn::remove (rownr_t rownr)
-{
-  deleteArray (rownr);
-  MSMColumn::remove (rownr);
-}
-
-
-void MSMDirColumn::deleteArray (rownr_t rownr)
-{
-  void* datap = getArrayPtr (rownr);
-  deleteData (datap, False);
-}
-
 } //# NAMESPACE CASACORE - END
 
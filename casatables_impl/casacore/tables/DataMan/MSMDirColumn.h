@@ -55,6 +55,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // <synopsis> 
 // MSMDirColumn handles arrays in a table column.
 // It only keeps them in memory, so they are not persistent.
+// Because the arrays have a fixed shape, they are stored one after the
+// other in the contiguous column data of MSMColumn. Getting the arrays
+// of a range of rows is therefore a single copy.
 // </synopsis> 
 
 //# <todo asof="$DATE:$">
@@ -74,10 +77,6 @@ public:
   // Set the (fixed) shape of the arrays in the entire column.
   virtual void setShapeColumn (const IPosition& shape);
 
-  // Add (newNrrow-oldNrrow) rows to the column.
-  // Allocate the data arrays in these rows if the shape is fixed.
-  virtual void addRow (rownr_t newNrrow, rownr_t oldNrrow);
-
   // Get the dimensionality of the item in the given row.
   // 0 is returned if there is no array.
   virtual uInt ndim (rownr_t rownr);
@@ -96,6 +95,27 @@ public:
   // (which is guaranteed by the ArrayColumn put function).
   virtual void putArrayV (rownr_t rownr, const ArrayBase& arr);
 
+  // Get all arrays in the column.
+  // The buffer given by <src>arr</src> has to have the correct length
+  // (which is guaranteed by the ArrayColumn getColumn function).
+  virtual void getArrayColumnV (ArrayBase& arr);
+
+  // Get the arrays in some rows of the column.
+  // The buffer given by <src>arr</src> has to have the correct length
+  // (which is guaranteed by the ArrayColumn getColumnCells function).
+  virtual void getArrayColumnCellsV (const RefRows& rownrs, ArrayBase& arr);
+
+  // Put all arrays in the column.
+  // The buffer given by <src>arr</src> has to have the correct length
+  // (which is guaranteed by the ArrayColumn putColumn function).
+  virtual void putArrayColumnV (const ArrayBase& arr);
+
+  // Put the arrays in some rows of the column.
+  // The buffer given by <src>arr</src> has to have the correct length
+  // (which is guaranteed by the ArrayColumn putColumnCells function).
+  virtual void putArrayColumnCellsV (const RefRows& rownrs,
+                                     const ArrayBase& arr);
+
   // Get a section of the array in the given row.
   // The buffer given by <src>arr</src> has to have the correct length
   // (which is guaranteed by the ArrayColumn getSlice function).
@@ -106,30 +126,21 @@ public:
   // (which is guaranteed by the ArrayColumn putSlice function).
   virtual void putSliceV (rownr_t rownr, const Slicer&, const ArrayBase& arr);
 
-  // Remove the value in the given row.
-  void remove (rownr_t rownr);
-
-  // Let the column create its arrays.
-  void doCreate (rownr_t nrrow);
-
 private:
   template<typename T>
   inline void doGetSlice (rownr_t rownr, const Slicer& slicer, Array<T>& data)
   {
-    Array<T> arr(shape_p, static_cast<T*>(getArrayPtr (rownr)), SHARE);
+    Array<T> arr(shape_p, static_cast<T*>(getDataPtr (rownr)), SHARE);
     data = arr(slicer);
   }
 
   template<typename T>
   inline void doPutSlice (rownr_t rownr, const Slicer& slicer, const Array<T>& data)
   {
-    Array<T> arr(shape_p, static_cast<T*>(getArrayPtr (rownr)), SHARE);
+    Array<T> arr(shape_p, static_cast<T*>(getDataPtr (rownr)), SHARE);
     arr(slicer) = data;
   }
 
-  // Delete the array in the given row.
-  void deleteArray (rownr_t rownr);
-
   // Forbid copy constructor.
   MSMDirColumn (const MSMDirColumn&);
 
@@ -38,6 +38,7 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/IO/AipsIO.h>
@@ -64,6 +65,8 @@ SSMBase::SSMBase (Int aBucketSize, uInt aCacheSize)
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
   itsCacheSize         (0),
+  itsOrigCacheSize     (0),
+  itsHasOrigCacheSize  (False),
   itsNrBuckets         (0), 
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -96,6 +99,8 @@ SSMBase::SSMBase (const String& aDataManName,
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
   itsCacheSize         (0),
+  itsOrigCacheSize     (0),
+  itsHasOrigCacheSize  (False),
   itsNrBuckets         (0), 
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -128,6 +133,8 @@ SSMBase::SSMBase (const String& aDataManName,
   itsStringHandler     (0),
   itsPersCacheSize     (2),
   itsCacheSize         (0),
+  itsOrigCacheSize     (0),
+  itsHasOrigCacheSize  (False),
   itsNrBuckets         (0), 
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -169,6 +176,8 @@ SSMBase::SSMBase (const SSMBase& that)
   itsStringHandler     (0),
   itsPersCacheSize     (that.itsPersCacheSize),
   itsCacheSize         (0),
+  itsOrigCacheSize     (0),
+  itsHasOrigCacheSize  (False),
   itsNrBuckets         (0),
   itsNrIdxBuckets      (0),
   itsFirstIdxBucket    (-1),
@@ -275,6 +284,73 @@ void SSMBase::showCacheStatistics (ostream& anOs) const
   }
 }
 
+Record SSMBase::cacheStatistics() const
+{
+  Record rec;
+  addCacheStatistics (rec, itsCache);
+  return rec;
+}
+
+uInt64 SSMBase::cacheDemand() const
+{
+  return uInt64(itsNrBuckets) * itsBucketSize;
+}
+
+void SSMBase::setCacheMemory (uInt64 nbytes)
+{
+  if (!itsHasOrigCacheSize) {
+    itsOrigCacheSize    = itsCacheSize;
+    itsHasOrigCacheSize = True;
+  }
+  setCacheSize (uInt(std::min (nbytes / itsBucketSize,
+                               uInt64(itsNrBuckets))));
+}
+
+void SSMBase::resetCacheMemory()
+{
+  if (itsHasOrigCacheSize) {
+    //# A size of 0 means that the cache did not exist yet.
+    setCacheSize (itsOrigCacheSize == 0 ? itsPersCacheSize : itsOrigCacheSize,
+                  True);
+    itsHasOrigCacheSize = False;
+  }
+}
+
+Int64 SSMBase::vacuum()
+{
+  if (itsIosFile == 0) {
+    return 0;
+  }
+  std::vector<SSMIndColumn*> aColumns;
+  for (uInt i=0; i<ncolumn(); i++) {
+    SSMIndColumn* aColumn = dynamic_cast<SSMIndColumn*>(itsPtrColumn[i]);
+    if (aColumn != 0) {
+      aColumns.push_back (aColumn);
+    }
+  }
+  std::map<Int64,int> anArrays;
+  for (SSMIndColumn* aColumn : aColumns) {
+    aColumn->collectArrays (anArrays);
+  }
+  //# The buckets with the new offsets are written before the file
+  //# can overwrite the old arrays.
+  Int64 aNrRegained = itsIosFile->compact
+    (anArrays,
+     [&] (const std::map<Int64,Int64>& anOffsets) {
+       for (SSMIndColumn* aColumn : aColumns) {
+         aColumn->updateArrays (anOffsets);
+       }
+       if (itsCache != 0) {
+         itsCache->flush();
+       }
+       itsFile->fsync();
+     });
+  if (aNrRegained > 0) {
+    isDataChanged = True;
+  }
+  return aNrRegained;
+}
+
 void SSMBase::showIndexStatistics (ostream & anOs) const
 {
   uInt aNrIdx=itsPtrIndex.nelements();
@@ -377,6 +453,8 @@ void SSMBase::makeCache()
     if (forceFill) {
       readIndexBuckets();
     }
+    //# The number of buckets is only known after reading the header.
+    publishCacheDemand();
   }
 }
 
@@ -387,7 +465,7 @@ uInt SSMBase::getRowsPerBucket(uInt aColumn) const
 
 uInt SSMBase::getNewBucket()
 {
-  char* aBucketPtr = new char[itsBucketSize];
+  char* aBucketPtr = AlignedBufferPool::allocate (itsBucketSize);
   memset (aBucketPtr,0,itsBucketSize);
   // Get a new bucket number from bucketcache
   return getCache().addBucket(aBucketPtr);
@@ -816,7 +894,8 @@ void SSMBase::removeBucket (uInt aBucketNr)
 
 char*  SSMBase::getBucket (uInt aBucketNr)
 {
-  return itsCache->getBucket(aBucketNr);
+  countMetrics (TableTrace::ACCESSES);
+  return getCache().getBucket(aBucketNr);
 }
   
 
@@ -877,8 +956,11 @@ void SSMBase::removeColumn (DataManagerColumn* aColumn)
 
 char* SSMBase::readCallBack (void* anOwner, const char* aBucketStorage)
 {
-  uInt aSize = static_cast<SSMBase*>(anOwner)->getBucketSize();
-  char* aBucket = new char [aSize];
+  SSMBase* ssm = static_cast<SSMBase*>(anOwner);
+  uInt aSize = ssm->getBucketSize();
+  ssm->countMetrics (TableTrace::MISSES);
+  ssm->countMetrics (TableTrace::BYTESREAD, aSize);
+  char* aBucket = AlignedBufferPool::allocate (aSize);
   memcpy (aBucket, aBucketStorage, aSize);
   return aBucket;
 }
@@ -886,19 +968,22 @@ char* SSMBase::readCallBack (void* anOwner, const char* aBucketStorage)
 void SSMBase::writeCallBack (void* anOwner, char* aBucketStorage,
                              const char* aBucket)
 {
-  uInt aSize = static_cast<SSMBase*>(anOwner)->getBucketSize();
+  SSMBase* ssm = static_cast<SSMBase*>(anOwner);
+  uInt aSize = ssm->getBucketSize();
+  ssm->countMetrics (TableTrace::BYTESWRITTEN, aSize);
   memcpy (aBucketStorage, aBucket, aSize);
 }
 
-void SSMBase::deleteCallBack (void*, char* aBucket)
+void SSMBase::deleteCallBack (void* anOwner, char* aBucket)
 {
-  delete [] aBucket;
+  AlignedBufferPool::release (aBucket,
+                              static_cast<SSMBase*>(anOwner)->getBucketSize());
 }
 
 char* SSMBase::initCallBack (void* anOwner)
 {
   uInt aSize = static_cast<SSMBase*>(anOwner)->getBucketSize();
-  char* aBucket = new char [aSize];
+  char* aBucket = AlignedBufferPool::allocate (aSize);
   memset (aBucket,0,aSize);
   return aBucket;
 }
@@ -933,7 +1018,8 @@ void SSMBase::recreate()
   itsFirstIdxBucket = -1;
   itsFreeBucketsNr = 0;
   itsFirstFreeBucket   = -1;
-  itsFile = new BucketFile (fileName(), 0, False, multiFile());
+  itsFile = new BucketFile (fileName(), 0, False, multiFile(),
+                            tsmOption().useODirect());
   makeCache();
   // Let the Index recreate itself when needed
   uInt aNrIdx=itsPtrIndex.nelements();
@@ -989,6 +1075,21 @@ Bool SSMBase::flush (AipsIO& ios, Bool doFsync)
   return changed;
 }
 
+Bool SSMBase::canFsyncFiles() const
+{
+  return True;
+}
+
+void SSMBase::fsyncFiles()
+{
+  if (itsFile != 0) {
+    itsFile->fdatasync();
+  }
+  if (itsIosFile != 0) {
+    itsIosFile->fsync();
+  }
+}
+
 rownr_t SSMBase::resync64 (rownr_t aNrRows)
 {
   itsNrRows = aNrRows;
@@ -1034,7 +1135,7 @@ rownr_t SSMBase::open64 (rownr_t aRowNr, AipsIO& ios)
   ios.getend();
   
   itsFile = new BucketFile (fileName(), table().isWritable(),
-                            0, False, multiFile());
+                            0, False, multiFile(), tsmOption().useODirect());
   AlwaysAssert (itsFile != 0, AipsError);
 
   // Let the column object initialize themselves (if needed)
@@ -219,6 +219,21 @@ public:
   // Show the statistics of all caches used.
   virtual void showCacheStatistics (ostream& anOs) const;
 
+  // Get the statistics of the cache.
+  virtual Record cacheStatistics() const;
+
+  // Get the size of the file in bytes.
+  virtual uInt64 cacheDemand() const;
+
+  // Set the cache size to the given number of bytes (at least 2 buckets).
+  virtual void setCacheMemory (uInt64 nbytes);
+
+  // Restore the cache size used before <src>setCacheMemory</src>.
+  virtual void resetCacheMemory();
+
+  // Compact the file holding the indirect arrays.
+  virtual Int64 vacuum();
+
   // Show statistics of all indices used.
   void showIndexStatistics (ostream & anOs) const;
 
@@ -312,6 +327,12 @@ private:
   // Flush and optionally fsync the data.
   // It returns a True status if it had to flush (i.e. if data have changed).
   virtual Bool flush (AipsIO&, Bool doFsync);
+
+  // The files can be fsync-ed separately from flush.
+  // <group>
+  virtual Bool canFsyncFiles() const;
+  virtual void fsyncFiles();
+  // </group>
   
   // Let the storage manager create files as needed for a new table.
   // This allows a column with an indirect array to create its file.
@@ -425,6 +446,10 @@ private:
   
   // The actual cache size.
   uInt itsCacheSize;
+
+  // The cache size before a cache budget was applied.
+  uInt itsOrigCacheSize;
+  Bool itsHasOrigCacheSize;
   
   // The initial number of buckets in the cache.
   uInt itsNrBuckets;
@@ -485,6 +510,7 @@ inline uInt SSMBase::getBucketSize() const
 
 inline BucketCache& SSMBase::getCache()
 {
+  applyCacheBudget();
   if (itsCache == 0) {
     makeCache();
   }
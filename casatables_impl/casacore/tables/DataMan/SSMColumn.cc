@@ -250,19 +250,23 @@ void SSMColumn::getDComplex (rownr_t aRowNr,DComplex* aValue)
 }
 
 void SSMColumn::getString (rownr_t aRowNr, String* aValue)
+{
+  rownr_t aStartRow;
+  rownr_t anEndRow;
+  char* buf = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                               columnName());
+  getStringValue (*aValue, buf+(aRowNr-aStartRow)*itsExternalSizeBytes);
+}
+
+Bool SSMColumn::getStringValue (String& aValue, const char* aRowPtr)
 {
   if (itsMaxLen > 0) {
     // Allocate the maximum number of characters needed
     // The +1 is to correct for the incorrect use of the chars() function
     // Should be changed to use real Char*
-    aValue->alloc(itsMaxLen+1);
-    char* sp = const_cast<char*>(aValue->chars());
-    rownr_t aStartRow;
-    rownr_t anEndRow;
-    char* buf = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
-                                 columnName());
-    itsReadFunc (sp, buf+(aRowNr-aStartRow)*itsExternalSizeBytes,
-		 itsNrCopy);
+    aValue.alloc(itsMaxLen+1);
+    char* sp = const_cast<char*>(aValue.chars());
+    itsReadFunc (sp, aRowPtr, itsNrCopy);
     // Append a trailing zero (in case needed).
     // Note that if shorter, the string already contains a trailing zero.
     // Set the string to its actual length.
@@ -271,28 +275,29 @@ void SSMColumn::getString (rownr_t aRowNr, String* aValue)
     while (*sp++ != '\0') {
       len++;
     }
-    aValue->alloc(len);
-  } else {
+    aValue.alloc(len);
+    return False;
+  }
 
-    // The string is probably stored indirectly in a string bucket.
-    // Get bucketnr, offset, and length.
-    Int buf[3];
-    char* strbuf = getRowValue(buf, aRowNr);
+  // The string is probably stored indirectly in a string bucket.
+  // Get bucketnr, offset, and length.
+  Int buf[3];
+  itsReadFunc (buf, aRowPtr, itsNrCopy);
 
-    // if length <= 8 chars the string can be found in de data bucket
-    // instead of the string bucket.
+  // if length <= 8 chars the string can be found in de data bucket
+  // instead of the string bucket.
 
-    if (buf[2] <= 8) {
-      aValue->resize (buf[2]);       // resize storage which adds trailing 0
-      char* sp = &((*aValue)[0]);    // get actual string
-      memcpy (sp, strbuf, buf[2]);
+  if (buf[2] <= 8) {
+    aValue.resize (buf[2]);       // resize storage which adds trailing 0
+    char* sp = &(aValue[0]);      // get actual string
+    memcpy (sp, aRowPtr, buf[2]);
 #ifdef USE_OLD_STRING
-      sp[buf[2]] = '\0';
+    sp[buf[2]] = '\0';
 #endif
-    } else {
-      itsSSMPtr->getStringHandler()->get(*aValue, buf[0], buf[1], buf[2]);
-    }
+    return False;
   }
+  itsSSMPtr->getStringHandler()->get(aValue, buf[0], buf[1], buf[2]);
+  return True;
 }
 
 Char* SSMColumn::getRowValue(Int* data, rownr_t aRowNr)
@@ -526,6 +531,91 @@ void SSMColumn::getColumnValue(void* anArray,rownr_t aNrRows)
   }
 }
 
+void SSMColumn::getScalarColumnCellsV (const RefRows& aRowNrs,
+                                       ArrayBase& aDataPtr)
+{
+  if (!aRowNrs.isSliced()) {
+    StManColumnBase::getScalarColumnCellsV (aRowNrs, aDataPtr);
+    return;
+  }
+  if (dtype() == TpString) {
+    getStringCells (aRowNrs, static_cast<Vector<String>&>(aDataPtr));
+    return;
+  }
+  Bool isBool = (dtype() == TpBool);
+  Bool deleteIt;
+  void* anArray = aDataPtr.getVStorage(deleteIt);
+  char* aDataOut = static_cast<char*>(anArray);
+  RefRowsSliceIter anIter(aRowNrs);
+  while (! anIter.pastEnd()) {
+    rownr_t aRowNr = anIter.sliceStart();
+    rownr_t anEnd  = anIter.sliceEnd();
+    rownr_t anIncr = anIter.sliceIncr();
+    while (aRowNr <= anEnd) {
+      rownr_t aStartRow;
+      rownr_t anEndRow;
+      char*   aValue;
+      aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                columnName());
+      rownr_t aLast = std::min (anEnd, anEndRow);
+      if (anIncr == 1) {
+        rownr_t aNr = aLast-aRowNr+1;
+        if (isBool) {
+          // Bools are stored as bits, so start at the row's bit.
+          Conversion::bitToBool (aDataOut, aValue, aRowNr-aStartRow, aNr);
+        } else {
+          itsReadFunc (aDataOut,
+                       aValue+(aRowNr-aStartRow)*itsExternalSizeBytes,
+                       aNr * itsNrCopy);
+        }
+        aDataOut += aNr * itsLocalSize;
+        aRowNr = aLast+1;
+      } else {
+        while (aRowNr <= aLast) {
+          if (isBool) {
+            Conversion::bitToBool (aDataOut, aValue, aRowNr-aStartRow, 1);
+          } else {
+            itsReadFunc (aDataOut,
+                         aValue+(aRowNr-aStartRow)*itsExternalSizeBytes,
+                         itsNrCopy);
+          }
+          aDataOut += itsLocalSize;
+          aRowNr += anIncr;
+        }
+      }
+    }
+    anIter++;
+  }
+  aDataPtr.putVStorage(anArray, deleteIt);
+}
+
+void SSMColumn::getStringCells (const RefRows& aRowNrs, Vector<String>& aVec)
+{
+  rownr_t i = 0;
+  RefRowsSliceIter anIter(aRowNrs);
+  while (! anIter.pastEnd()) {
+    rownr_t aRowNr = anIter.sliceStart();
+    rownr_t anEnd  = anIter.sliceEnd();
+    rownr_t anIncr = anIter.sliceIncr();
+    while (aRowNr <= anEnd) {
+      rownr_t aStartRow;
+      rownr_t anEndRow;
+      char*   aValue;
+      aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                columnName());
+      rownr_t aLast = std::min (anEnd, anEndRow);
+      // Look up the data bucket again after reading a string bucket.
+      Bool refind = False;
+      while (aRowNr <= aLast  &&  !refind) {
+        refind = getStringValue (aVec[i++],
+                          aValue+(aRowNr-aStartRow)*itsExternalSizeBytes);
+        aRowNr += anIncr;
+      }
+    }
+    anIter++;
+  }
+}
+
 void SSMColumn::putScalarColumnV (const ArrayBase& aDataPtr)
 {
   if (dtype() == TpString) {
@@ -131,7 +131,7 @@ public:
 
   // Resync the storage manager with the new file contents.
   // It resets the last rownr put.
-  void resync (rownr_t aNrRow);
+  virtual void resync (rownr_t aNrRow);
   
   // Get the scalar value in the given row.
   // <group>
@@ -168,6 +168,15 @@ public:
   
   // Get the scalar values of the entire column.
   virtual void getScalarColumnV (ArrayBase& aDataPtr);
+
+  // Get the scalar values of some cells of the column.
+  // Sliced row numbers are read per bucket, so a contiguous run is copied
+  // with a single conversion call for each bucket it spans. Bools are
+  // unpacked directly from the bits in the bucket and strings are decoded
+  // without looking up the bucket for each row.
+  // Unsliced row numbers use the per-cell default.
+  virtual void getScalarColumnCellsV (const RefRows& aRowNrs,
+                                      ArrayBase& aDataPtr);
   
   // Put the scalar values of the entire column.
   // It invalidates the cache.
@@ -209,6 +218,14 @@ protected:
   // It returns a pointer to the data in the bucket, which can be used
   // for the case that the data bucket contains the (short) string.
   Char* getRowValue (Int* data, rownr_t aRowNr);
+
+  // Get the string stored at the given position in a data bucket.
+  // It returns True if the string was read from a string bucket, in which
+  // case the data bucket may have been removed from the cache.
+  Bool getStringValue (String& aValue, const char* aRowPtr);
+
+  // Get the strings in the given sliced rows, one data bucket at a time.
+  void getStringCells (const RefRows& aRowNrs, Vector<String>& aVec);
     
   // Put the given value for the row into the correct data bucket.
   void putValue (rownr_t aRowNr, const void* aValue);
@@ -138,7 +138,10 @@ StIndArray* SSMIndColumn::getArrayPtr (rownr_t aRowNr)
 
 
   if (anOffset != 0) {
-    itsIndArray = StIndArray (anOffset);
+    //# Keep the shape if the same array is accessed again.
+    if (anOffset != itsIndArray.fileOffset()) {
+      itsIndArray = StIndArray (anOffset);
+    }
     return &itsIndArray;
   }else{
     return 0;
@@ -169,6 +172,33 @@ uInt SSMIndColumn::ndim (rownr_t aRowNr)
 IPosition SSMIndColumn::shape (rownr_t aRowNr)
     { return getShape(aRowNr)->shape(); }
 
+void SSMIndColumn::getShapes (rownr_t aStartRow, rownr_t aNrRows,
+                              std::vector<IPosition>& aShapes)
+{
+  std::vector<Int64> anOffsets (aNrRows);
+  rownr_t anEnd = aStartRow + aNrRows;
+  rownr_t aRowNr = aStartRow;
+  while (aRowNr < anEnd) {
+    rownr_t aBucketStartRow;
+    rownr_t aBucketEndRow;
+    char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aBucketStartRow,
+                                    aBucketEndRow, columnName());
+    aBucketEndRow = std::min (aBucketEndRow, anEnd-1);
+    for (; aRowNr <= aBucketEndRow; ++aRowNr) {
+      itsReadFunc (&anOffsets[aRowNr-aStartRow],
+                   aValue+(aRowNr-aBucketStartRow)*itsExternalSizeBytes,
+                   itsNrCopy);
+    }
+  }
+  itsIosFile->getShapes (anOffsets, aShapes);
+}
+
+void SSMIndColumn::resync (rownr_t aNrRow)
+{
+  SSMColumn::resync (aNrRow);
+  itsIndArray = StIndArray(0);
+}
+
 Bool SSMIndColumn::canChangeShape() const
     { return (isShapeFixed  ?  False : True); }
 
@@ -187,6 +217,57 @@ void SSMIndColumn::deleteRow(rownr_t aRowNr)
   }
 }
 
+void SSMIndColumn::collectArrays (std::map<Int64,int>& arrays)
+{
+  rownr_t aNrRows = itsSSMPtr->getNRow();
+  rownr_t aRowNr = 0;
+  while (aRowNr < aNrRows) {
+    rownr_t aStartRow;
+    rownr_t anEndRow;
+    char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                    columnName());
+    anEndRow = std::min (anEndRow, aNrRows-1);
+    for (; aRowNr <= anEndRow; ++aRowNr) {
+      Int64 anOffset;
+      itsReadFunc (&anOffset,
+                   aValue+(aRowNr-aStartRow)*itsExternalSizeBytes, itsNrCopy);
+      if (anOffset != 0) {
+        arrays[anOffset] = dataType();
+      }
+    }
+  }
+}
+
+void SSMIndColumn::updateArrays (const std::map<Int64,Int64>& offsets)
+{
+  rownr_t aNrRows = itsSSMPtr->getNRow();
+  rownr_t aRowNr = 0;
+  while (aRowNr < aNrRows) {
+    rownr_t aStartRow;
+    rownr_t anEndRow;
+    char* aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
+                                    columnName());
+    anEndRow = std::min (anEndRow, aNrRows-1);
+    Bool changed = False;
+    for (; aRowNr <= anEndRow; ++aRowNr) {
+      char* aPtr = aValue + (aRowNr-aStartRow)*itsExternalSizeBytes;
+      Int64 anOffset;
+      itsReadFunc (&anOffset, aPtr, itsNrCopy);
+      if (anOffset != 0) {
+        Int64 aNewOffset = offsets.at (anOffset);
+        if (aNewOffset != anOffset) {
+          itsWriteFunc (aPtr, &aNewOffset, itsNrCopy);
+          changed = True;
+        }
+      }
+    }
+    if (changed) {
+      itsSSMPtr->setBucketDirty();
+    }
+  }
+  itsIndArray = StIndArray(0);
+}
+
 void SSMIndColumn::getArrayV (rownr_t aRowNr, ArrayBase& arr)
 {
   getShape(aRowNr)->getArrayV (*itsIosFile, arr, dtype());
@@ -34,6 +34,7 @@
 #include <casacore/tables/DataMan/SSMColumn.h>
 #include <casacore/tables/DataMan/StIndArray.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -123,6 +124,10 @@ public:
   
   // Get the shape of the array in the given row.
   virtual IPosition shape (rownr_t aRowNr);
+
+  // Get the shapes of the arrays in a range of rows.
+  virtual void getShapes (rownr_t aStartRow, rownr_t aNrRows,
+                          std::vector<IPosition>& aShapes);
   
   // This storage manager can handle changing array shapes.
   Bool canChangeShape() const;
@@ -158,6 +163,18 @@ public:
   // Remove the given row from the data bucket and possibly string bucket.
   virtual void deleteRow(rownr_t aRowNr);
 
+  // Resync the storage manager with the new file contents.
+  // It forgets the array last accessed.
+  virtual void resync (rownr_t aNrRow);
+
+  // Add the file offset and data type of the arrays in the column
+  // to the map (used to compact the file).
+  void collectArrays (std::map<Int64,int>& arrays);
+
+  // Replace the file offsets of the arrays by their new offsets after
+  // the file has been compacted.
+  void updateArrays (const std::map<Int64,Int64>& offsets);
+
 
 private:
   // Forbid copy constructor.
@@ -60,12 +60,16 @@ void SSMIndex::get (AipsIO& anOs)
   anOs >> itsNrColumns;
   anOs >> itsFreeSpace;
   if (version == 1) {
-    Block<uInt> tmp;
-    getBlock (anOs, tmp);
-    itsLastRow.resize (tmp.size());
-    for (size_t i=0; i<tmp.size(); ++i) {
-      itsLastRow[i] = tmp[i];
+    uInt nrow;
+    const uInt* rows;
+    Block<uInt> buffer;
+    anOs.getstart ("Block");
+    anOs.getview (nrow, rows, buffer);
+    itsLastRow.resize (nrow);
+    for (uInt i=0; i<nrow; ++i) {
+      itsLastRow[i] = rows[i];
     }
+    anOs.getend();
   } else {
     getBlock (anOs, itsLastRow);
   }
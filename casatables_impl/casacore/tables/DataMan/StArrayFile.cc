@@ -27,6 +27,7 @@
 
 #include <casacore/tables/DataMan/StArrayFile.h>
 #include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/IO/BlockCacheIO.h>
 #include <casacore/casa/IO/MFFileIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
 #include <casacore/casa/IO/LECanonicalIO.h>
@@ -40,16 +41,40 @@
 #include <casacore/casa/OS/Path.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <unistd.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# The size of the blocks in the block cache.
+#define STMANARRAYFILE_BLOCKSIZE 8192
+
+//# The default cache size is read from aipsrc when first needed.
+static std::atomic<uInt64>& theDefaultCacheSize()
+{
+    static std::atomic<uInt64> size ([] () {
+        Int64 value;
+        AipsrcValue<Int64>::find (value, "table.arrayfile.cachesize", 0);
+        return uInt64 (std::max (value, Int64(0)));
+    } ());
+    return size;
+}
+
+
 StManArrayFile::StManArrayFile (const String& fname, ByteIO::OpenOption fop,
 				uInt version, Bool bigEndian,
 				uInt bufferSize, MultiFileBase* mfile)
-: leng_p    (16),
-  version_p (version),
-  hasPut_p  (False)
+: cache_p     (0),
+  iofil_p     (0),
+  leng_p      (16),
+  version_p   (version),
+  bigEndian_p (bigEndian),
+  hasPut_p    (False)
 {
     // The maximum version is 1.
     if (version_p > 1) {
@@ -64,12 +89,12 @@ StManArrayFile::StManArrayFile (const String& fname, ByteIO::OpenOption fop,
     } else {
       file_p = new RegularFileIO (RegularFile(fname), fop, bufferSize);
     }
-    if (bigEndian) {
-	iofil_p = new CanonicalIO (file_p);
-    }else{
-	iofil_p = new LECanonicalIO (file_p);
+    uInt64 cacheSize = defaultCacheSize();
+    if (cacheSize > 0) {
+        cache_p = new BlockCacheIO (file_p, STMANARRAYFILE_BLOCKSIZE,
+                                    cacheSize);
     }
-    AlwaysAssert (iofil_p != 0, AipsError);
+    makeTypeIO();
     swput_p = iofil_p->isWritable();
     //# Get the version and length for an existing file.
     //# Otherwise set put-flag.
@@ -93,28 +118,61 @@ StManArrayFile::~StManArrayFile ()
     //# Write the version and file length at the beginning.
     flush (False);
     delete iofil_p;
+    delete cache_p;
     delete file_p;
 }
 
+void StManArrayFile::makeTypeIO()
+{
+    ByteIO* io = file_p;
+    if (cache_p) {
+        io = cache_p;
+    }
+    if (bigEndian_p) {
+	iofil_p = new CanonicalIO (io);
+    }else{
+	iofil_p = new LECanonicalIO (io);
+    }
+}
 
-Bool StManArrayFile::flush (Bool)
+uInt64 StManArrayFile::defaultCacheSize()
 {
+    return theDefaultCacheSize().load();
+}
+
+void StManArrayFile::setDefaultCacheSize (uInt64 nbytes)
+{
+    theDefaultCacheSize().store (nbytes);
+}
+
+
+Bool StManArrayFile::flush (Bool fsync)
+{
+    Bool written = False;
     if (hasPut_p) {
 	setpos (0);
 	put (version_p);
 	iofil_p->write (1, &leng_p);
 	hasPut_p = False;
-	file_p->flush();
+	iofil_p->byteIO().flush();
 	setpos (leng_p);
-	return True;
+	written = True;
     }
-    return False;
+    if (fsync) {
+	this->fsync();
+    }
+    return written;
+}
+
+void StManArrayFile::fsync()
+{
+    iofil_p->byteIO().fsync();
 }
 
 // Resync the file (i.e. clear possible cache information).
 void StManArrayFile::resync()
 {
-    file_p->resync();
+    iofil_p->byteIO().resync();
     if (iofil_p->seek (0, ByteIO::End) > 0) {
         setpos (0);
 	get (version_p);
@@ -444,6 +502,31 @@ uInt StManArrayFile::getShape (Int64 fileOff, IPosition& shape)
     return n;
 }
 
+void StManArrayFile::getShapes (const std::vector<Int64>& fileOffsets,
+                                std::vector<IPosition>& shapes)
+{
+    shapes.resize (fileOffsets.size());
+    std::vector<size_t> index (fileOffsets.size());
+    for (size_t i=0; i<index.size(); ++i) {
+        index[i] = i;
+    }
+    std::stable_sort (index.begin(), index.end(),
+                      [&fileOffsets] (size_t left, size_t right)
+                      { return fileOffsets[left] < fileOffsets[right]; });
+    for (size_t i=0; i<index.size(); ++i) {
+        Int64 offset = fileOffsets[index[i]];
+        IPosition& shape = shapes[index[i]];
+        if (offset == 0) {
+            shape.resize (0);
+        } else if (i > 0  &&  offset == fileOffsets[index[i-1]]) {
+            //# Rows sharing an array (in the ISM) are read once.
+            shape = shapes[index[i-1]];
+        } else {
+            getShape (offset, shape);
+        }
+    }
+}
+
 //# Update the reference count.
 uInt StManArrayFile::getRefCount (Int64 offset)
 {
@@ -465,7 +548,196 @@ void StManArrayFile::putRefCount (uInt refCount, Int64 offset)
     }else{
 	setpos (offset);
 	put (refCount);
+	hasPut_p = True;
+    }
+}
+
+//# Get the length of the data of an array in the file.
+Int64 StManArrayFile::dataLength (int dataType, uInt64 nelem) const
+{
+    switch (dataType) {
+    case TpBool:
+        return (nelem + 7) / 8;
+    case TpChar:
+        return nelem * sizeChar_p;
+    case TpUChar:
+        return nelem * sizeuChar_p;
+    case TpShort:
+        return nelem * sizeShort_p;
+    case TpUShort:
+        return nelem * sizeuShort_p;
+    case TpInt:
+        return nelem * sizeInt_p;
+    case TpUInt:
+    case TpString:
+        return nelem * sizeuInt_p;
+    case TpInt64:
+        return nelem * sizeInt64_p;
+    case TpFloat:
+        return nelem * sizeFloat_p;
+    case TpDouble:
+        return nelem * sizeDouble_p;
+    case TpComplex:
+        return nelem * 2 * sizeFloat_p;
+    case TpDComplex:
+        return nelem * 2 * sizeDouble_p;
+    default:
+        throw DataManError ("StManArrayFile: unknown data type " +
+                            String::toString (dataType) + " in file " +
+                            file_p->fileName());
+    }
+}
+
+//# The arrays and strings in use are compacted in two steps, so the file
+//# is valid at any time if the process is interrupted:
+//# 1. They are copied contiguously to the end of the file, thus without
+//#    overwriting data in use. After an fsync the caller stores the new
+//#    offsets.
+//# 2. The copy is copied to the front of the file, which is not in use
+//#    anymore. After an fsync the caller stores the new offsets again.
+//# Only thereafter the file length in the header is reduced and the file
+//# is truncated. Until the caller has stored the offsets of a step, it
+//# refers to the data of the previous step, which are still intact.
+//# In each step the string offsets in the copied string arrays are updated.
+Int64 StManArrayFile::compact
+      (const std::map<Int64,int>& arrays,
+       const std::function<void (const std::map<Int64,Int64>&)>& storeOffsets)
+{
+    struct Piece {
+        Int64  length;
+        int    dataType;        //# -1 for a string
+        uInt   shapeLength;
+        uInt64 nelem;
+    };
+    std::map<Int64,Piece> pieces;
+    IPosition shape;
+    std::vector<uInt> strOffsets;
+    Bool hasStrings = False;
+    for (const auto& array : arrays) {
+        Piece piece;
+        piece.dataType    = array.second;
+        piece.shapeLength = getShape (array.first, shape);
+        piece.nelem       = shape.product();
+        piece.length      = piece.shapeLength + dataLength (array.second,
+                                                            piece.nelem);
+        pieces[array.first] = piece;
+        if (array.second == TpString) {
+            strOffsets.resize (piece.nelem);
+            setpos (array.first + piece.shapeLength);
+            iofil_p->read (piece.nelem, strOffsets.data());
+            for (uInt strOffset : strOffsets) {
+                if (strOffset != 0) {
+                    uInt leng;
+                    setpos (strOffset);
+                    Piece str;
+                    str.length      = get (leng) + Int64(leng);
+                    str.dataType    = -1;
+                    str.shapeLength = 0;
+                    str.nelem       = 0;
+                    pieces[strOffset] = str;
+                    hasStrings = True;
+                }
+            }
+        }
+    }
+    //# Check that the pieces are inside the file and do not overlap.
+    Int64 end = 16;
+    for (const auto& piece : pieces) {
+        if (piece.first < end  ||  piece.first + piece.second.length > leng_p) {
+            throw DataManError ("StManArrayFile::compact: invalid offset " +
+                                String::toString (piece.first) + " in file " +
+                                file_p->fileName());
+        }
+        end = piece.first + piece.second.length;
+    }
+    //# Determine the offsets of the pieces in the compacted data, where
+    //# an array starts at an 8 byte boundary.
+    std::map<Int64,Int64> relOffsets;
+    Int64 size = 0;
+    for (const auto& piece : pieces) {
+        if (piece.second.dataType >= 0) {
+            size = 8 * ((size + 7) / 8);
+        }
+        relOffsets[piece.first] = size;
+        size += piece.second.length;
+    }
+    //# The first array is stored after the header (version and length).
+    Int64 front = 16;
+    Int64 tail  = 8 * ((leng_p + 7) / 8);
+    if (front + size >= leng_p) {
+        return 0;
+    }
+    //# A string offset is stored as an uInt.
+    if (hasStrings  &&  tail + size > Int64(65536)*65536) {
+        throw DataManError ("StManArrayFile::compact: file " +
+                            file_p->fileName() +
+                            " is too large to compact its string arrays");
+    }
+    std::map<Int64,Int64> oldOffsets, tailOffsets, frontOffsets;
+    for (const auto& rel : relOffsets) {
+        oldOffsets[rel.first]   = rel.first;
+        tailOffsets[rel.first]  = tail + rel.second;
+        frontOffsets[rel.first] = front + rel.second;
+    }
+    //# Copy the pieces and update the string offsets in the string arrays.
+    auto movePieces = [&] (const std::map<Int64,Int64>& from,
+                           const std::map<Int64,Int64>& to)
+    {
+        std::map<Int64,Int64> moved;
+        for (const auto& piece : pieces) {
+            copyData (to.at (piece.first), from.at (piece.first),
+                      piece.second.length);
+            moved[from.at (piece.first)] = to.at (piece.first);
+        }
+        for (const auto& piece : pieces) {
+            if (piece.second.dataType == TpString) {
+                Int64 offset = to.at (piece.first) + piece.second.shapeLength;
+                strOffsets.resize (piece.second.nelem);
+                setpos (offset);
+                iofil_p->read (piece.second.nelem, strOffsets.data());
+                for (uInt& strOffset : strOffsets) {
+                    if (strOffset != 0) {
+                        strOffset = moved.at (strOffset);
+                    }
+                }
+                setpos (offset);
+                iofil_p->write (piece.second.nelem, strOffsets.data());
+            }
+        }
+    };
+    //# Give the caller the offsets of the arrays.
+    auto storeArrayOffsets = [&] (const std::map<Int64,Int64>& from,
+                                  const std::map<Int64,Int64>& to)
+    {
+        std::map<Int64,Int64> offsets;
+        for (const auto& array : arrays) {
+            offsets[from.at (array.first)] = to.at (array.first);
+        }
+        storeOffsets (offsets);
+    };
+    Int64 nregained = leng_p - (front + size);
+    //# Step 1. The header gets the new length before the caller refers
+    //# to the copy.
+    movePieces (oldOffsets, tailOffsets);
+    leng_p   = tail + size;
+    hasPut_p = True;
+    flush (True);
+    storeArrayOffsets (oldOffsets, tailOffsets);
+    //# Step 2.
+    movePieces (tailOffsets, frontOffsets);
+    hasPut_p = True;
+    flush (True);
+    storeArrayOffsets (tailOffsets, frontOffsets);
+    leng_p   = front + size;
+    hasPut_p = True;
+    flush (True);
+    //# A file in a MultiFile cannot be truncated; its space is reused.
+    if (dynamic_cast<RegularFileIO*>(file_p)) {
+        if (::truncate (file_p->fileName().chars(), leng_p) == 0) {
+            iofil_p->byteIO().resync();
+        }
     }
+    return nregained;
 }
 
 } //# NAMESPACE CASACORE - END
@@ -34,11 +34,15 @@
 #include <casacore/casa/IO/TypeIO.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/BasicSL/Complex.h>
+#include <functional>
+#include <map>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
 class MultiFileBase;
+class BlockCacheIO;
 class IPosition;
 
 
@@ -68,8 +72,13 @@ class IPosition;
 // Instead of holding the data in memory, they are written directly
 // into a file. It also allows to access a part of an array, which
 // is needed for the table system to access an array section.
-// It does not use a cache of its own, but it is relying on the
+// By default it does not use a cache of its own, but it is relying on the
 // underlying system routines to cache and buffer adequately.
+// Optionally the blocks of the file can be kept in a
+// <linkto class=BlockCacheIO>BlockCacheIO</linkto> cache, which speeds up
+// random access to many small arrays. Its size is given by the
+// aipsrc variable <src>table.arrayfile.cachesize</src> (in bytes,
+// default 0 meaning no cache) or by <src>setDefaultCacheSize</src>.
 //
 // This class could in principle also be used for other array purposes,
 // for example, to implement a paged array class for really huge arrays.
@@ -81,6 +90,8 @@ class IPosition;
 // an array of offsets pointing to the actual strings.
 // When a string gets a new value, the new value is written at the
 // end of the file and the file space with the old value is lost.
+// The same is true for an array that gets another shape. Function
+// <src>compact</src> can be used to regain that space.
 //
 // Currently only the basic types are supported, but arbitrary types
 // could also be supported by writing/reading an element in the normal
@@ -148,6 +159,11 @@ public:
     // It returns True when any data was written since the last flush.
     Bool flush (Bool fsync);
 
+    // Fsync the data written by the last flush. The file is fsync-ed even
+    // if nothing was written since then, because that flush may not have
+    // fsync-ed it. A file in a MultiFileBase is fsync-ed as a whole.
+    void fsync();
+
     // Reopen the file for read/write access.
     void reopenRW();
 
@@ -158,6 +174,31 @@ public:
     Int64 length()
 	{ return leng_p; }
 
+    // Get or set the size (in bytes) of the block cache of files opened
+    // hereafter; 0 means no cache. Initially it is the value of the aipsrc
+    // variable <src>table.arrayfile.cachesize</src>.
+    // <group>
+    static uInt64 defaultCacheSize();
+    static void setDefaultCacheSize (uInt64 nbytes);
+    // </group>
+
+    // Compact the file by moving the arrays still in use and the strings
+    // they refer to to the front of the file, so the space of arrays
+    // and strings that were replaced is regained. If possible, the
+    // file is truncated.
+    // <src>arrays</src> has to contain the file offset and data type of
+    // every array in use. An array whose offset is not given is lost.
+    // <br>The arrays are first copied to the end of the file and
+    // thereafter to the front, each time without overwriting data still
+    // in use. After each copy <src>storeOffsets</src> is called with a map
+    // of the current offsets of the arrays to their new offsets. It has
+    // to store the new offsets instead and make that durable (fsync) before
+    // returning, so the file is valid if the process is interrupted.
+    // It returns the number of bytes regained.
+    Int64 compact (const std::map<Int64,int>& arrays,
+                   const std::function<void (const std::map<Int64,Int64>&)>&
+                   storeOffsets);
+
     // Put the array shape and store its file offset into the offset argument.
     // Reserve file space for the associated array.
     // The length of the shape part in the file is returned.
@@ -230,6 +271,12 @@ public:
     // It returns the length of the shape in the file.
     uInt getShape (Int64 fileOffset, IPosition& shape);
 
+    // Get the shapes at the given file offsets (an empty shape for offset 0).
+    // The shapes are read in order of their offsets, so a range of rows
+    // needs far fewer seeks than reading the shapes one by one.
+    void getShapes (const std::vector<Int64>& fileOffsets,
+                    std::vector<IPosition>& shapes);
+
     // Get nr elements at the given file offset and array offset.
     // The file offset of the first array element is the file offset
     // of the shape plus the length of the shape in the file.
@@ -275,9 +322,11 @@ public:
 
 private:
     ByteIO* file_p;                //# File object
+    BlockCacheIO* cache_p;         //# Block cache (or 0) on the file
     TypeIO* iofil_p;               //# IO object
     Int64   leng_p;                //# File length
     uInt    version_p;             //# Version of StArrayFile file
+    Bool    bigEndian_p;
     Bool    swput_p;               //# True = put is possible
     Bool    hasPut_p;              //# True = put since last flush
     uInt    sizeChar_p;
@@ -314,6 +363,13 @@ private:
     // Copy data with the given length from one file offset to another.
     void copyData (Int64 to, Int64 from, uInt64 length);
 
+    // Create the IO object on the cache or file.
+    void makeTypeIO();
+
+    // Get the length in the file of the data of an array with the given
+    // data type and number of elements.
+    Int64 dataLength (int dataType, uInt64 nelem) const;
+
     // Position the file on the given offset.
     void setpos (Int64 offset);
 };
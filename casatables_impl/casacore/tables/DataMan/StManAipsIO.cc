@@ -332,7 +332,8 @@ rownr_t StManAipsIO::resync64 (rownr_t nrrow)
     if (iosfile_p != 0) {
         iosfile_p->resync();
     }
-    AipsIO ios(fileName());
+    // Map the file if possible, so the data can be converted without copying.
+    AipsIO ios(fileName(), ByteIO::Old, 65536, 0, canMapFiles());
     uInt version = ios.getstart ("StManAipsIO");
     //# Get and check the number of rows and columns and the column types.
     uInt i, nrr, nrc, snr;
@@ -83,14 +83,8 @@ class StManArrayFile;
 //        use StManColumnAipsIO to hold a pointer to the array in each row.
 // </ol>
 //
-// StManColumnAipsIO does not hold a column as a consecutive array,
-// because extending the column (i.e. adding rows) proofed be too
-// expensive due to the repeated copying involved when creating a table
-// (this method was used by the old table system).
-// Instead it has a number of data blocks (extensions) indexed to by a
-// super block. Accessing a row means finding the appropriate extension
-// via a binary search. Because there is only 1 extension when a table is
-// read back, the overhead in finding a row is small.
+// Like its base class MSMColumn, StManColumnAipsIO holds a column as a
+// consecutive array that grows geometrically when rows are added.
 // </synopsis> 
 
 // <motivation>
@@ -38,6 +38,7 @@
 #include <casacore/casa/Containers/RecordField.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/IO/AlignedBufferPool.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/ArrayIO.h>
@@ -134,7 +135,7 @@ TSMCube::TSMCube (TiledStMan* stman, AipsIO& ios,
 TSMCube::~TSMCube()
 {
     delete cache_p;
-    delete [] cachedTile_p;
+    AlignedBufferPool::release (cachedTile_p, localTileLength_p);
 }
 
 
@@ -168,6 +169,16 @@ void TSMCube::showCacheStatistics (ostream& os) const
     }
 }
 
+void TSMCube::addCacheStatistics (Record& rec) const
+{
+    DataManager::addCacheStatistics (rec, cache_p);
+}
+
+uInt64 TSMCube::dataSize() const
+{
+    return uInt64(nrTiles_p) * bucketSize_p;
+}
+
 uInt TSMCube::coordinateSize (const String& coordinateName) const
 {
     if (! values_p.isDefined (coordinateName)) {
@@ -371,6 +382,15 @@ void TSMCube::setupNrTiles()
     }
 }
 
+BucketCache* TSMCube::getCache()
+{
+    stmanPtr_p->applyCacheBudget();
+    if (cache_p == 0) {
+	makeCache();
+    }
+    return cache_p;
+}
+
 void TSMCube::makeCache()
 {
     // If there is no cache, make one with initially 1 slot.
@@ -674,9 +694,12 @@ char* TSMCube::readTile (const char* external)
         local = cachedTile_p;
         cachedTile_p = 0;
     } else {
-        local = new char[localTileLength_p];
+        local = AlignedBufferPool::allocate (localTileLength_p);
     }
 
+    stmanPtr_p->countMetrics (TableTrace::MISSES);
+    stmanPtr_p->countMetrics (TableTrace::BYTESREAD, bucketSize_p);
+    stmanPtr_p->countMetrics (TableTrace::TILESCONVERTED);
     stmanPtr_p->readTile (local, localOffset_p, external, externalOffset_p,
 			  tileSize_p);
     return local;
@@ -687,6 +710,7 @@ void TSMCube::writeCallBack (void* owner, char* external, const char* local)
 }
 void TSMCube::writeTile (char* external, const char* local)
 {
+    stmanPtr_p->countMetrics (TableTrace::BYTESWRITTEN, bucketSize_p);
     stmanPtr_p->writeTile (external, externalOffset_p, local, localOffset_p,
 			   tileSize_p);
 }
@@ -696,13 +720,13 @@ void TSMCube::deleteCallBack (void* owner, char* buffer)
     if (tsmCube->cachedTile_p == 0){
         tsmCube->cachedTile_p = buffer;
     } else {
-        delete [] buffer;
+        AlignedBufferPool::release (buffer, tsmCube->localTileLength_p);
     }
 }
 char* TSMCube::initCallBack (void* owner)
 {
     uInt64 size = ((TSMCube*)owner)->localTileLength();
-    char* buffer = new char[size];
+    char* buffer = AlignedBufferPool::allocate (size);
     memset(buffer, 0, size);
     return buffer;
 }
@@ -965,6 +989,7 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     if (oneEntireTile) {
         // Get the tile from the cache.
         uInt tileNr = expandedTilesPerDim_p.offset (startTile_p);
+        stmanPtr_p->countMetrics (TableTrace::ACCESSES);
         char* dataArray = cachePtr->getBucket (tileNr);
         // If writing, set cache slot to dirty.
         if (writeFlag) {
@@ -1015,6 +1040,7 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
 //      cout << "end=" << endPixel << endl;
         // Get the tile from the cache.
         // Set it to dirty if we are writing.
+        stmanPtr_p->countMetrics (TableTrace::ACCESSES);
         char* dataArray = cachePtr->getBucket (tileNr);
         if (writeFlag) {
             cachePtr->setDirty();
@@ -1134,6 +1160,7 @@ void TSMCube::accessLine (char* section, uInt pixelOffset,
 //      cout << "nrpixel=" << nrPixel << endl;
         // Get the tile from the cache.
         // Set it to dirty if we are writing.
+        stmanPtr_p->countMetrics (TableTrace::ACCESSES);
         char* dataArray = cachePtr->getBucket (tileNr) + offset;
         if (writeFlag) {
             cachePtr->setDirty();
@@ -1382,6 +1409,7 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
 //      cout << "start=" << startPixel << endl;
         // Get the tile from the cache.
         // Set it to dirty if we are writing.
+        stmanPtr_p->countMetrics (TableTrace::ACCESSES);
         char* dataArray = cachePtr->getBucket (tileNr);
         if (writeFlag) {
             cachePtr->setDirty();
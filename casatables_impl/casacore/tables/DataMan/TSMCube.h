@@ -150,6 +150,13 @@ public:
     // Show the cache statistics.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Add the cache statistics to the record
+    // (see <src>DataManager::cacheStatistics</src>).
+    void addCacheStatistics (Record& rec) const;
+
+    // Get the size of the data of the hypercube in bytes.
+    uInt64 dataSize() const;
+
     // Put the data of the object into the AipsIO stream.
     void putObject (AipsIO& ios);
 
@@ -420,13 +427,6 @@ protected:
 
 
 
-inline BucketCache* TSMCube::getCache()
-{
-    if (cache_p == 0) {
-	makeCache();
-    }
-    return cache_p;
-}
 inline uInt TSMCube::bucketSize() const
 { 
     return bucketSize_p;
@@ -52,7 +52,8 @@ TSMFile::TSMFile (const TiledStMan* stman, uInt fileSequenceNr,
     if (tsmOpt.option() == TSMOption::Buffer) {
       bufSize = tsmOpt.bufferSize();
     }
-    file_p = new BucketFile (fileName, bufSize, mapOpt, mfile);
+    file_p = new BucketFile (fileName, bufSize, mapOpt, mfile,
+                             tsmOpt.useODirect());
 }
 
 TSMFile::TSMFile (const String& fileName, Bool writable,
@@ -67,7 +68,8 @@ TSMFile::TSMFile (const String& fileName, Bool writable,
     if (tsmOpt.option() == TSMOption::Buffer) {
       bufSize = tsmOpt.bufferSize();
     }
-    file_p = new BucketFile (fileName, writable, bufSize, mapOpt, mfile);
+    file_p = new BucketFile (fileName, writable, bufSize, mapOpt, mfile,
+                             tsmOpt.useODirect());
 }
 
 TSMFile::TSMFile (const TiledStMan* stman, AipsIO& ios, uInt seqnr,
@@ -88,7 +90,7 @@ TSMFile::TSMFile (const TiledStMan* stman, AipsIO& ios, uInt seqnr,
       bufSize = tsmOpt.bufferSize();
     }
     file_p = new BucketFile (fileName, stman->table().isWritable(),
-                             bufSize, mapOpt, mfile);
+                             bufSize, mapOpt, mfile, tsmOpt.useODirect());
 }
 
 TSMFile::~TSMFile()
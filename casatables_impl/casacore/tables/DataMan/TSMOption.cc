@@ -31,10 +31,12 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TSMOption::TSMOption (TSMOption::Option option, Int bufferSize,
-                        Int maxCacheSizeMB)
+                        Int maxCacheSizeMB, Int useODirect)
     : itsOption       (option),
       itsBufferSize   (bufferSize),
-      itsMaxCacheSize (maxCacheSizeMB)
+      itsMaxCacheSize (maxCacheSizeMB),
+      itsUseODirect   (useODirect),
+      itsDeferOpen    (False)
   {}
 
   void TSMOption::fillOption (Bool newTable)
@@ -67,6 +69,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsMaxCacheSize <= -2) {
       AipsrcValue<Int>::find (itsMaxCacheSize, "table.tsm.maxcachesizemb", -1);
     }
+    // Default is not to use O_DIRECT.
+    if (itsUseODirect <= -2) {
+      Bool useODirect;
+      AipsrcValue<Bool>::find (useODirect, "table.tsm.odirect", False);
+      itsUseODirect = useODirect;
+    }
     // Default is to use the old caching behaviour
     // Abandoned default to use mmap for existing files on 64 bit systems.
     if (itsOption == TSMOption::Default) {
@@ -109,7 +109,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>table.tsm.buffersize</src> gives the buffer size for option
 //       <src>TSMOption::Buffer</src>. A value <=0 means use the default 4096.
 //       It defaults to 0.
+//  <li> <src>table.tsm.odirect</src> tells if the files of the storage
+//       managers are opened with O_DIRECT (if supported by the OS and file
+//       system) for options <src>TSMOption::Cache</src> and
+//       <src>TSMOption::Buffer</src>, so the kernel's file cache is bypassed.
+//       It is ignored for <src>TSMOption::MMap</src>.
+//       It defaults to False.
 // </ul>
+//
+// Because the options are passed to all storage managers of a table when
+// it is opened, the class also tells if opening the data managers of an
+// existing table should be deferred (see <src>setDeferOpen</src>).
 // </synopsis>
 
 
@@ -135,8 +145,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // A size value -2 means reading that size from the aipsrc file.
     // The buffer size has to be given in bytes.
     // The maximum cache size has to be given in MibiBytes (1024*1024 bytes).
+    // useODirect 0 means False, 1 means True, and -2 means reading it from
+    // the aipsrc file.
     TSMOption (Option option=Aipsrc, Int bufferSize=-2,
-               Int maxCacheSizeMB=-2);
+               Int maxCacheSizeMB=-2, Int useODirect=-2);
 
     // Fill the option in case Aipsrc or Default was given.
     // It is done as explained in the synopsis.
@@ -154,10 +166,32 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int maxCacheSizeMB() const
       { return itsMaxCacheSize; }
 
+    // Set or get if the files are opened with O_DIRECT.
+    // <group>
+    void setUseODirect (Bool useODirect)
+      { itsUseODirect = useODirect; }
+    Bool useODirect() const
+      { return itsUseODirect > 0; }
+    // </group>
+
+    // Set or get if opening the data managers is deferred.
+    // If set when a table is opened for read only, its data managers are
+    // not opened (thus their headers and indices are not read) until one
+    // of their columns is accessed. This makes opening a table to read
+    // only some keywords much cheaper. It is off by default.
+    // <group>
+    void setDeferOpen (Bool deferOpen)
+      { itsDeferOpen = deferOpen; }
+    Bool deferOpen() const
+      { return itsDeferOpen; }
+    // </group>
+
   private:
     Option itsOption;
     Int    itsBufferSize;
     Int    itsMaxCacheSize;
+    Int    itsUseODirect;
+    Bool   itsDeferOpen;
   };
 
 } //# NAMESPACE CASACORE - END
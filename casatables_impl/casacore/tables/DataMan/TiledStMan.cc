@@ -60,7 +60,9 @@ TiledStMan::TiledStMan ()
   maxCacheSize_p    (0),
   nrdim_p           (0),
   nrCoordVector_p   (0),
-  dataChanged_p     (False)
+  dataChanged_p     (False),
+  origMaxCacheSize_p(0),
+  hasOrigCacheSize_p(False)
 {}
 
 TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
@@ -72,7 +74,9 @@ TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
   maxCacheSize_p    (maximumCacheSize),
   nrdim_p           (0),
   nrCoordVector_p   (0),
-  dataChanged_p     (False)
+  dataChanged_p     (False),
+  origMaxCacheSize_p(0),
+  hasOrigCacheSize_p(False)
 {}
 
 TiledStMan::~TiledStMan()
@@ -476,6 +480,9 @@ void TiledStMan::setHypercubeCacheSize (uInt hypercube, uInt nbuckets, Bool forc
 
 Bool TiledStMan::userSetCache (rownr_t rownr) const
 {
+    // A cache budget acts as a cache size set by the user, so apply it
+    // before the caller decides to size the cache itself.
+    const_cast<TiledStMan*>(this)->applyCacheBudget();
     return getHypercube(rownr)->userSetCache();
 }
 
@@ -497,6 +504,76 @@ void TiledStMan::showCacheStatistics (ostream& os) const
     }
 }
 
+Record TiledStMan::cacheStatistics() const
+{
+    Record rec;
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	if (cubeSet_p[i] != 0) {
+	    cubeSet_p[i]->addCacheStatistics (rec);
+	}
+    }
+    return rec;
+}
+
+uInt64 TiledStMan::cacheDemand() const
+{
+    uInt64 size = 0;
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	if (cubeSet_p[i] != 0) {
+	    size += cubeSet_p[i]->dataSize();
+	}
+    }
+    return size;
+}
+
+void TiledStMan::setCacheMemory (uInt64 nbytes)
+{
+    if (!hasOrigCacheSize_p) {
+        origMaxCacheSize_p = maxCacheSize_p;
+        origCubeCaches_p.clear();
+        for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+            TSMCube* cube = cubeSet_p[i];
+            origCubeCaches_p.push_back
+              (cube == 0  ?  std::make_pair (0u, False)
+                          :  std::make_pair (cube->cacheSize(),
+                                             cube->userSetCache()));
+        }
+        hasOrigCacheSize_p = True;
+    }
+    maxCacheSize_p = uInt (std::max (uInt64(1), nbytes / (1024*1024)));
+    uInt64 share = nbytes / std::max (1u, nhypercubes());
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	TSMCube* cube = cubeSet_p[i];
+	if (cube != 0  &&  cube->bucketSize() > 0) {
+	    uInt64 nbuckets = std::min (share, cube->dataSize()) /
+	                      cube->bucketSize();
+	    cube->setCacheSize (uInt (std::max (uInt64(1), nbuckets)),
+				True, True);
+	}
+    }
+}
+
+void TiledStMan::resetCacheMemory()
+{
+    if (!hasOrigCacheSize_p) {
+        return;
+    }
+    maxCacheSize_p = origMaxCacheSize_p;
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	TSMCube* cube = cubeSet_p[i];
+	if (cube != 0  &&  cube->bucketSize() > 0) {
+	    //# Hypercubes added later got a size as set by the user.
+	    if (i < origCubeCaches_p.size()) {
+		cube->setCacheSize (std::max (1u, origCubeCaches_p[i].first),
+				    True, origCubeCaches_p[i].second);
+	    } else {
+		cube->setCacheSize (1, True, False);
+	    }
+	}
+    }
+    hasOrigCacheSize_p = False;
+}
+
 TSMCube* TiledStMan::singleHypercube()
 {
     if (cubeSet_p.nelements() != 1  ||  cubeSet_p[0] == 0) {
@@ -1034,6 +1111,21 @@ Bool TiledStMan::flushCaches (Bool fsync)
 }
 
 
+Bool TiledStMan::canFsyncFiles() const
+{
+    return True;
+}
+
+void TiledStMan::fsyncFiles()
+{
+    for (uInt i=0; i<fileSet_p.nelements(); i++) {
+	if (fileSet_p[i] != 0) {
+	    fileSet_p[i]->bucketFile()->fdatasync();
+	}
+    }
+}
+
+
 AipsIO* TiledStMan::headerFileCreate()
 {
     return new AipsIO (fileName(), ByteIO::New, 16384, multiFile());
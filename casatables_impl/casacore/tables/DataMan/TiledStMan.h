@@ -38,6 +38,8 @@
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/BasicSL/String.h>
 
+#include <vector>
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
@@ -258,6 +260,22 @@ public:
     // Show the statistics of all caches used.
     void showCacheStatistics (ostream& os) const;
 
+    // Get the statistics summed over the caches of all hypercubes.
+    virtual Record cacheStatistics() const;
+
+    // Get the size of the data of all hypercubes in bytes.
+    virtual uInt64 cacheDemand() const;
+
+    // Give the caches of the hypercubes an equal part of the given number
+    // of bytes (at most what they need), as if set by the user, so the
+    // size is not changed by the access pattern anymore.
+    // The maximum cache size is set to the number of bytes (at least 1 MiB).
+    virtual void setCacheMemory (uInt64 nbytes);
+
+    // Restore the maximum cache size and the cache sizes of the hypercubes
+    // used before <src>setCacheMemory</src>.
+    virtual void resetCacheMemory();
+
     // Get the length of the data for the given number of pixels.
     // This can be used to calculate the length of a tile.
     uInt64 getLengthOffset (uInt64 nrPixels, Block<uInt>& dataOffset,
@@ -443,6 +461,12 @@ protected:
     // If data have put and fsync is set, fsync all files.
     Bool flushCaches (Bool fsync);
 
+    // The files can be fsync-ed separately from flush.
+    // <group>
+    virtual Bool canFsyncFiles() const;
+    virtual void fsyncFiles();
+    // </group>
+
     // Let a derived class read the header info.
     // This is used by the open and resync function.
     virtual void readHeader (rownr_t nrrow, Bool firstTime) = 0;
@@ -519,6 +543,11 @@ protected:
     IPosition fixedCellShape_p;
     // Has any data changed since the last flush?
     Bool      dataChanged_p;
+    // The maximum cache size and the cache sizes of the hypercubes
+    // (and if set by the user) before a cache budget was applied.
+    uInt      origMaxCacheSize_p;
+    std::vector<std::pair<uInt,Bool> > origCubeCaches_p;
+    Bool      hasOrigCacheSize_p;
 
 private:
     // Forbid copy constructor.
@@ -140,6 +140,13 @@ IPosition ArrayColumnData::tileShape (rownr_t rownr) const
 {
     return dataColPtr_p->tileShape(rownr);
 }
+void ArrayColumnData::shapes (rownr_t startRow, rownr_t nrow,
+                              std::vector<IPosition>& shapes) const
+{
+    checkReadLock (True);
+    dataColPtr_p->getShapes (startRow, nrow, shapes);
+    autoReleaseLock();
+}
 
 
 void ArrayColumnData::setShape (rownr_t rownr, const IPosition& shp)
@@ -166,6 +173,7 @@ Bool ArrayColumnData::canChangeShape() const
 
 void ArrayColumnData::getArray (rownr_t rownr, ArrayBase& array) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GET);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr,
                          array.shape());
@@ -178,6 +186,7 @@ void ArrayColumnData::getArray (rownr_t rownr, ArrayBase& array) const
 void ArrayColumnData::getSlice (rownr_t rownr, const Slicer& ns,
                                 ArrayBase& array) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETSLICE);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr,
                          array.shape(),
@@ -191,6 +200,7 @@ void ArrayColumnData::getSlice (rownr_t rownr, const Slicer& ns,
 
 void ArrayColumnData::putArray (rownr_t rownr, const ArrayBase& array)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUT);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr,
                          array.shape());
@@ -206,6 +216,7 @@ void ArrayColumnData::putArray (rownr_t rownr, const ArrayBase& array)
 void ArrayColumnData::putSlice (rownr_t rownr, const Slicer& ns,
                                 const ArrayBase& array)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTSLICE);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr,
                          array.shape(),
@@ -226,6 +237,7 @@ void ArrayColumnData::putSlice (rownr_t rownr, const Slicer& ns,
 
 void ArrayColumnData::getArrayColumn (ArrayBase& array) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETCOLUMN);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r',
                          array.shape());
@@ -239,6 +251,7 @@ void ArrayColumnData::getArrayColumn (ArrayBase& array) const
 void ArrayColumnData::getArrayColumnCells (const RefRows& rownrs,
                                            ArrayBase& array) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETCOLUMN);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownrs,
                          array.shape());
@@ -251,6 +264,7 @@ void ArrayColumnData::getArrayColumnCells (const RefRows& rownrs,
 void ArrayColumnData::getColumnSlice (const Slicer& ns,
                                       ArrayBase& array) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETCOLUMNSLICE);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r',
                          array.shape(),
@@ -265,6 +279,7 @@ void ArrayColumnData::getColumnSliceCells (const RefRows& rownrs,
                                            const Slicer& ns,
                                            ArrayBase& array) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETCOLUMNSLICE);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownrs,
                          array.shape(),
@@ -277,6 +292,7 @@ void ArrayColumnData::getColumnSliceCells (const RefRows& rownrs,
 
 void ArrayColumnData::putArrayColumn (const ArrayBase& array)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTCOLUMN);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w',
                          array.shape());
@@ -292,6 +308,7 @@ void ArrayColumnData::putArrayColumn (const ArrayBase& array)
 void ArrayColumnData::putArrayColumnCells (const RefRows& rownrs,
                                            const ArrayBase& array)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTCOLUMN);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownrs,
                          array.shape());
@@ -307,6 +324,7 @@ void ArrayColumnData::putArrayColumnCells (const RefRows& rownrs,
 void ArrayColumnData::putColumnSlice (const Slicer& ns,
                                       const ArrayBase& array)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTCOLUMNSLICE);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w',
                          array.shape(),
@@ -324,6 +342,7 @@ void ArrayColumnData::putColumnSliceCells (const RefRows& rownrs,
                                            const Slicer& ns,
                                            const ArrayBase& array)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTCOLUMNSLICE);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownrs,
                          array.shape(),
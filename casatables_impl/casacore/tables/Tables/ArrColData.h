@@ -136,6 +136,10 @@ public:
     // If the cell does not contain an array, an empty IPosition is returned.
     IPosition tileShape(rownr_t rownr) const;
 
+    // Get the shapes of the arrays in a range of rows.
+    void shapes (rownr_t startRow, rownr_t nrow,
+                 std::vector<IPosition>& shapes) const;
+
     // Set dimensions of array in a particular cell.
     // <group>
     void setShape (rownr_t rownr, const IPosition& shape);
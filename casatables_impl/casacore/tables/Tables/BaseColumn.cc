@@ -89,6 +89,19 @@ IPosition BaseColumn::tileShape (rownr_t) const
                        "; only valid for an array"));
 }
 
+void BaseColumn::shapes (rownr_t startRow, rownr_t nrow,
+                         std::vector<IPosition>& shapes) const
+{
+  shapes.resize (nrow);
+  for (rownr_t i=0; i<nrow; ++i) {
+    if (isDefined (startRow + i)) {
+      shapes[i] = shape (startRow + i);
+    } else {
+      shapes[i].resize (0);
+    }
+  }
+}
+
 
 Bool BaseColumn::canChangeShape() const
 {
@@ -36,6 +36,7 @@
 #include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -147,6 +148,13 @@ public:
     // Get the tile shape of an array in a particular cell.
     virtual IPosition tileShape (rownr_t rownr) const;
 
+    // Get the shapes of the arrays in <src>nrow</src> rows starting at
+    // <src>startRow</src> (an empty shape if the cell is undefined).
+    // By default <src>isDefined</src> and <src>shape</src> are used for
+    // each row.
+    virtual void shapes (rownr_t startRow, rownr_t nrow,
+                         std::vector<IPosition>& shapes) const;
+
     // Ask the data manager if the shape of an existing array can be changed.
     // Default is no.
     virtual Bool canChangeShape() const;
@@ -1009,6 +1009,31 @@ BaseTableIterator* BaseTable::makeIterator
 }
 
 
+Record BaseTable::openTiming() const
+{
+    return Record();
+}
+
+Record BaseTable::cacheStatistics() const
+{
+    return Record();
+}
+
+Int64 BaseTable::vacuum()
+{
+    return 0;
+}
+
+Bool BaseTable::writeOpenSnapshot()
+{
+    return False;
+}
+
+Bool BaseTable::removeOpenSnapshot()
+{
+    return False;
+}
+
 const TableDesc& BaseTable::makeEmptyTableDesc() const
 {
     if (tdescPtr_p.null()) {
@@ -278,6 +278,26 @@ public:
     // Get the data manager info.
     virtual Record dataManagerInfo() const = 0;
 
+    // Get the times spent opening the table (implementation of
+    // Table::openTiming). By default an empty record is returned.
+    virtual Record openTiming() const;
+
+    // Get the statistics of the caches of the data managers (implementation
+    // of Table::cacheStatistics). By default an empty record is returned.
+    virtual Record cacheStatistics() const;
+
+    // Regain unused file space (implementation of Table::vacuum).
+    // By default nothing is done and 0 is returned.
+    virtual Int64 vacuum();
+
+    // Write or remove the snapshot of the table metadata (implementation
+    // of Table::writeOpenSnapshot and Table::removeOpenSnapshot).
+    // By default nothing is done and False is returned.
+    // <group>
+    virtual Bool writeOpenSnapshot();
+    virtual Bool removeOpenSnapshot();
+    // </group>
+
     // Show the table structure (implementation of Table::showStructure).
     void showStructure (std::ostream&,
                         Bool showDataMan,
@@ -309,6 +329,12 @@ public:
     rownr_t nrow() const
 	{ return nrrow_p; }
 
+    // Raise the number of rows if the given number is larger.
+    // It is used when a data manager whose opening was deferred
+    // knows of more rows than the table file.
+    void adjustNrow (rownr_t nrrow)
+	{ if (nrrow > nrrow_p) nrrow_p = nrrow; }
+
     // Get a column object using its index.
     virtual BaseColumn* getColumn (uInt columnIndex) const = 0;
 
@@ -38,6 +38,7 @@
 #include <casacore/casa/IO/MultiFile.h>
 #include <casacore/casa/IO/MultiHDF5.h>
 #include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/OS/PrecTimer.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <limits>
 
@@ -55,7 +56,10 @@ ColumnSet::ColumnSet (TableDesc* tdesc, const StorageOption& opt)
   baseTablePtr_p  (0),
   lockPtr_p       (0),
   seqCount_p      (0),
-  blockDataMan_p  (0)
+  blockDataMan_p  (0),
+  nrDeferred_p    (0),
+  readColumnsTime_p (0),
+  openTime_p      (0)
 {
     //# Loop through all columns in the description and create
     //# a column out of them.
@@ -146,6 +150,7 @@ void ColumnSet::initSomeDataManagers (uInt from, Table& tab)
     //# Thereafter to prepare things.
     for (uInt i=from; i<blockDataMan_p.nelements(); i++) {
 	BLOCKDATAMANVAL(i)->create64 (nrrow_p);
+	BLOCKDATAMANVAL(i)->publishCacheDemand();
     }
     prepareSomeDataManagers (from);
 }
@@ -185,7 +190,8 @@ void ColumnSet::openMultiFile (uInt from, const Table& tab,
       if (storageOpt_p.option() == StorageOption::MultiFile) {
         multiFile_p = new MultiFile (tab.tableName() + "/table.mf",
                                      opt, storageOpt_p.blockSize(),
-                                     storageOpt_p.useODirect());
+                                     storageOpt_p.useODirect(),
+                                     storageOpt_p.nShards());
       } else {
         multiFile_p = new MultiHDF5 (tab.tableName() + "/table.mfh5",
                                      opt, storageOpt_p.blockSize());
@@ -201,12 +207,17 @@ void ColumnSet::openMultiFile (uInt from, const Table& tab,
 rownr_t ColumnSet::resync (rownr_t nrrow, Bool forceSync)
 {
     //# There may be no sync data (when new table locked for first time).
+    //# Data managers whose opening is deferred are left alone; they read
+    //# the current state of their files when opened.
     if (dataManChanged_p.nelements() > 0) {
 	AlwaysAssert (dataManChanged_p.nelements() ==
 		                   blockDataMan_p.nelements(), AipsError);
 	for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
-	    if (dataManChanged_p[i]  ||  nrrow != nrrow_p  ||  forceSync) {
+	    if (isOpenDeferred (i)) {
+		dataManChanged_p[i] = False;
+	    } else if (dataManChanged_p[i]  ||  nrrow != nrrow_p  ||  forceSync) {
                 rownr_t nrr = BLOCKDATAMANVAL(i)->resync64 (nrrow);
+                BLOCKDATAMANVAL(i)->publishCacheDemand();
                 if (nrr > nrrow) {
                     nrrow = nrr;
                 }
@@ -219,6 +230,54 @@ rownr_t ColumnSet::resync (rownr_t nrrow, Bool forceSync)
 }
 
 
+Vector<String> ColumnSet::dataManagerColumns
+                                  (const Block<Bool>& dataManagers) const
+{
+    std::vector<String> names;
+    for (const auto& x : colMap_p) {
+	const DataManager* dm = COLMAPCAST(x.second)->dataManager();
+	for (uInt i=0; i<blockDataMan_p.nelements()
+                       &&  i<dataManagers.nelements(); i++) {
+	    if (dataManagers[i]  &&  BLOCKDATAMANVAL(i) == dm) {
+		names.push_back (x.first);
+		break;
+	    }
+	}
+    }
+    return Vector<String> (names);
+}
+
+
+Record ColumnSet::cacheStatistics() const
+{
+    Record rec;
+    for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
+	if (! isOpenDeferred (i)) {
+	    const DataManager* dm = BLOCKDATAMANVAL(i);
+	    Record stats = dm->cacheStatistics();
+	    if (stats.nfields() > 0) {
+		String name = dm->statisticsName();
+		if (rec.isDefined (name)) {
+		    name += '_' + String::toString (dm->sequenceNr());
+		}
+		rec.defineRecord (name, stats);
+	    }
+	}
+    }
+    return rec;
+}
+
+Int64 ColumnSet::vacuum()
+{
+    openDeferred();
+    Int64 nregained = 0;
+    for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
+	nregained += BLOCKDATAMANVAL(i)->vacuum();
+    }
+    return nregained;
+}
+
+
 void ColumnSet::invalidateColumnCaches()
 {
     for (auto& x : colMap_p) {
@@ -607,10 +666,15 @@ DataManager* ColumnSet::findDataManager (const String& name,
                                          Bool byColumn) const
 {
     if (byColumn) {
-        return COLMAPNAME(name)->dataManager();
+        PlainColumn* pc = COLMAPNAME(name);
+        openDeferred (pc);
+        return pc->dataManager();
     }
+    //# A data manager gets its name when opened, so deferred data managers
+    //# are opened one by one until the name is found.
     for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
         DataManager* dmp = BLOCKDATAMANVAL(i);
+        openDeferred (i);
         if (name == dmp->dataManagerName()) {
             return dmp;
         }
@@ -673,6 +737,7 @@ TableDesc ColumnSet::actualTableDesc() const
 	cd.dataManagerGroup() = pc->dataManager()->dataManagerName();
 	if (cd.isArray()  &&  cd.isFixedShape()) {
 	    if (cd.shape().nelements() == 0) {
+	        openDeferred (pc);
 	        cd.setShape (pc->shapeColumn());
 	    }
 	}
@@ -682,6 +747,7 @@ TableDesc ColumnSet::actualTableDesc() const
 
 Record ColumnSet::dataManagerInfo (Bool virtualOnly) const
 {
+    openDeferred();
     Record rec;
     uInt nrec=0;
     // Loop through all data managers.
@@ -726,6 +792,7 @@ void ColumnSet::initialize (rownr_t startRow, rownr_t endRow)
 
 void ColumnSet::reopenRW()
 {
+    openDeferred();
     if (multiFile_p) {
         multiFile_p->reopenRW();
     }
@@ -804,13 +871,27 @@ Bool ColumnSet::putFile (Bool writeTable, AipsIO& ios,
     }
     //# Now write out the data in all data managers.
     //# Keep track if a data manager indeed wrote something.
+    //# If fsync is needed, the files are fsync-ed after all data managers
+    //# have written their data, so the system can write them in one go.
+    //# A MultiFile is fsync-ed once for all data managers using it.
+    //# The other data managers are all fsync-ed, also if they did not
+    //# report a change (e.g. if only indirect arrays were written) or
+    //# wrote their data in an earlier flush without fsync.
     MemoryIO memio;
     AipsIO aio(&memio);
+    std::vector<DataManager*> syncDataMan;
     for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
-        if (BLOCKDATAMANVAL(i)->flush (aio, fsync)) {
+        DataManager* dmp = BLOCKDATAMANVAL(i);
+        Bool inMultiFile = multiFile_p != 0  &&  dmp->hasMultiFileSupport();
+        Bool syncLater   = fsync  &&  (inMultiFile || dmp->canFsyncFiles());
+        if (dmp->flush (aio, fsync && !syncLater)) {
+	    dmp->publishCacheDemand();
 	    dataManChanged_p[i] = True;
 	    written = True;
 	}
+        if (syncLater  &&  !inMultiFile) {
+            syncDataMan.push_back (dmp);
+        }
 	if (writeTable) {
 	    ios.put (uInt(memio.length()), memio.getBuffer());
 	}
@@ -818,6 +899,12 @@ Bool ColumnSet::putFile (Bool writeTable, AipsIO& ios,
     }
     if (multiFile_p) {
       multiFile_p->flush();
+      if (fsync) {
+        multiFile_p->fsync();
+      }
+    }
+    for (size_t i=0; i<syncDataMan.size(); i++) {
+        syncDataMan[i]->fsyncFiles();
     }
     return written;
 }
@@ -857,6 +944,8 @@ rownr_t ColumnSet::getFile (AipsIO& ios, Table& tab, rownr_t nrrow, Bool bigEndi
     }
     ios >> nrman;
     ios >> nr;
+    PrecTimer timer;
+    timer.start();
     //# Construct the various data managers.
     for (i=0; i<nr; i++) {
 	//# Get type name of data manager and its sequence nr.
@@ -892,31 +981,143 @@ rownr_t ColumnSet::getFile (AipsIO& ios, Table& tab, rownr_t nrrow, Bool bigEndi
     for (i=0; i<blockDataMan_p.nelements(); i++) {
 	BLOCKDATAMANVAL(i)->linkToTable (tab);
     }
+    timer.stop();
+    readColumnsTime_p = timer.getReal();
     //# Finally open the data managers and let them prepare themselves.
+    //# For a readonly table that can be deferred until a column is used;
+    //# the state to open them is kept till then.
+    Bool defer = tsmOption.deferOpen()  &&  !tab.isWritable();
+    if (defer) {
+        deferredState_p.resize (nr);
+        isDeferred_p.resize (nr);
+        isDeferred_p.set (True);
+        nrDeferred_p = nr;
+    }
     for (i=0; i<nr; i++) {
 	uChar* data;
 	uInt leng;
 	ios.getnew (leng, data);
-	MemoryIO memio (data, leng);
-	AipsIO aio(&memio);
-	rownr_t nrrow = BLOCKDATAMANVAL(i)->open64 (nrrow_p, aio);
-        if (nrrow > nrrow_p) {
-          nrrow_p = nrrow;
+        if (defer) {
+            deferredState_p[i].assign (data, data + leng);
+        } else {
+            openDataManager (i, data, leng);
         }
 	delete [] data;
     }
-    prepareSomeDataManagers (0);
+    if (! defer) {
+        prepareSomeDataManagers (0);
+    }
     return nrrow_p;
 }
 
+void ColumnSet::openDataManager (uInt index, const uChar* data, uInt leng)
+{
+    PrecTimer timer;
+    timer.start();
+    MemoryIO memio (data, leng);
+    AipsIO aio(&memio);
+    rownr_t nrrow = BLOCKDATAMANVAL(index)->open64 (nrrow_p, aio);
+    BLOCKDATAMANVAL(index)->publishCacheDemand();
+    if (nrrow > nrrow_p) {
+        nrrow_p = nrrow;
+    }
+    timer.stop();
+    openTime_p += timer.getReal();
+}
+
+void ColumnSet::openDeferred() const
+{
+    if (nrDeferred_p > 0) {
+        for (uInt i=0; i<isDeferred_p.nelements(); i++) {
+            const_cast<ColumnSet*>(this)->doOpenDeferred (i);
+        }
+    }
+}
+
+void ColumnSet::openDeferred (const PlainColumn* column) const
+{
+    if (nrDeferred_p > 0) {
+        DataManager* dmPtr = column->dataManager();
+        for (uInt i=0; i<isDeferred_p.nelements(); i++) {
+            if (BLOCKDATAMANVAL(i) == dmPtr) {
+                const_cast<ColumnSet*>(this)->doOpenDeferred (i);
+                break;
+            }
+        }
+    }
+}
+
+void ColumnSet::openDeferred (uInt index) const
+{
+    if (isOpenDeferred (index)) {
+        const_cast<ColumnSet*>(this)->doOpenDeferred (index);
+    }
+}
+
+void ColumnSet::doOpenDeferred (uInt index)
+{
+    if (! isDeferred_p[index]) {
+        return;
+    }
+    //# Hold a read lock while the data manager reads its files, so another
+    //# process cannot change them meanwhile. Acquiring the lock resyncs the
+    //# table, which updates the number of rows and, if the table file has
+    //# changed, the deferred state (see syncDeferred).
+    //# The lock is also released if opening fails.
+    Bool hasLocked = userLock (FileLocker::Read, True);
+    try {
+        checkReadLock (True);
+        const std::vector<uChar>& state = deferredState_p[index];
+        openDataManager (index, state.data(), state.size());
+        isDeferred_p[index] = False;
+        nrDeferred_p--;
+        std::vector<uChar>().swap (deferredState_p[index]);
+        //# The data manager may know of more rows than the table file.
+        baseTablePtr_p->adjustNrow (nrrow_p);
+        // Do what prepareSomeDataManagers does for this data manager only.
+        DataManager* dmPtr = BLOCKDATAMANVAL(index);
+        if (dmPtr->canReallocateColumns()) {
+            for (uInt j=0; j<colMap_p.size(); j++) {
+                DataManagerColumn*& column = getColumn(j)->dataManagerColumn();
+                column = dmPtr->reallocateColumn (column);
+            }
+        }
+        dmPtr->prepare();
+    } catch (...) {
+        userUnlock (hasLocked);
+        autoReleaseLock();
+        throw;
+    }
+    userUnlock (hasLocked);
+    autoReleaseLock();
+}
+
+void ColumnSet::syncDeferred (const ColumnSet& other)
+{
+    if (nrDeferred_p > 0) {
+        if (other.deferredState_p.size() != deferredState_p.size()) {
+            throw (TableError ("ColumnSet::syncDeferred; another process "
+                               "changed the data managers of table " +
+                               baseTablePtr_p->tableName()));
+        }
+        for (uInt i=0; i<isDeferred_p.nelements(); i++) {
+            if (isDeferred_p[i]) {
+                deferredState_p[i] = other.deferredState_p[i];
+            }
+        }
+    }
+}
+
 
 //# Find the data manager with the given sequence number.
+//# Its opening may have been deferred, so it is opened if needed.
 DataManager* ColumnSet::getDataManager (uInt seqnr) const
 {
   DataManager* dmp = 0;
     for (uInt i=0; i<blockDataMan_p.nelements(); i++) {
 	dmp = BLOCKDATAMANVAL(i);
 	if (seqnr == dmp->sequenceNr()) {
+	    openDeferred (i);
 	    return dmp;
 	}
     }
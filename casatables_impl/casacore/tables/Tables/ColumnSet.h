@@ -38,6 +38,7 @@
 #include <casacore/casa/Arrays/ArrayFwd.h>
 
 #include <map>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -119,6 +120,30 @@ public:
     // Get a column by index.
     PlainColumn* getColumn (uInt columnIndex) const;
 
+    // Open the data managers whose opening has been deferred by getFile.
+    // The second version only opens the data manager of the given column,
+    // the third version the data manager with the given index.
+    // They are no-ops if nothing has been deferred.
+    // <group>
+    void openDeferred() const;
+    void openDeferred (const PlainColumn* column) const;
+    void openDeferred (uInt index) const;
+    // </group>
+
+    // Get the number of data managers not opened yet.
+    uInt nrDeferred() const
+      { return nrDeferred_p; }
+
+    // Get the time (in seconds) spent in getFile to create the data managers
+    // and read the columns, and the total time spent to open the data
+    // managers (thus including those opened on demand).
+    // <group>
+    Double readColumnsTime() const
+      { return readColumnsTime_p; }
+    Double openTime() const
+      { return openTime_p; }
+    // </group>
+
     // Add a data manager.
     // It increments seqCount_p and returns that as a unique sequence number.
     // This can, for instance, be used to create a unique file name.
@@ -213,6 +238,10 @@ public:
     int traceId() const
       { return baseTablePtr_p->traceId(); }
 
+    // Get the name of the table.
+    const String& tableName() const
+      { return baseTablePtr_p->tableName(); }
+
     // Initialize rows startRownr till endRownr (inclusive).
     void initialize (rownr_t startRownr, rownr_t endRownr);
 
@@ -243,9 +272,23 @@ public:
     // manager has to sync.
     rownr_t resync (rownr_t nrrow, Bool forceSync);
 
+    // Get the names of the columns bound to the data managers flagged
+    // in <src>dataManagers</src>.
+    Vector<String> dataManagerColumns (const Block<Bool>& dataManagers) const;
+
     // Invalidate the column caches for all columns.
     void invalidateColumnCaches();
 
+    // Get the cache statistics of the opened data managers having a cache.
+    // It contains a subrecord per data manager (see
+    // <src>DataManager::cacheStatistics</src>).
+    Record cacheStatistics() const;
+
+    // Regain unused file space of all data managers
+    // (see <src>DataManager::vacuum</src>).
+    // It returns the number of bytes regained.
+    Int64 vacuum();
+
     // Get the correct data manager.
     // This is used by the column objects to link themselves to the
     // correct datamanagers when they are read back.
@@ -272,6 +315,11 @@ public:
     // The other ColumnSet gives the new data.
     void syncColumns (const ColumnSet& other, const TableAttr& defaultAttr);
 
+    // Replace the saved state of the data managers whose opening is still
+    // deferred by the state in the other ColumnSet, which must have been
+    // opened with deferred data managers after the table file changed.
+    void syncDeferred (const ColumnSet& other);
+
 private:
     // Remove the last data manager (used by addColumn after an exception).
     // It does the opposite of addDataManager.
@@ -283,6 +331,17 @@ private:
     // Let the data managers (from the given index on) prepare themselves.
     void prepareSomeDataManagers (uInt from);
 
+    // Open the given data manager from its saved state.
+    void openDataManager (uInt index, const uChar* data, uInt leng);
+
+    // Open the given data manager if its opening has been deferred
+    // and let it prepare itself.
+    void doOpenDeferred (uInt index);
+
+    // Is the open of the given data manager deferred?
+    Bool isOpenDeferred (uInt index) const
+      { return index < isDeferred_p.nelements()  &&  isDeferred_p[index]; }
+
     // Open or create the MultiFile if needed.
     void openMultiFile (uInt from, const Table& tab,
                         ByteIO::OpenOption);
@@ -324,6 +383,12 @@ private:
     //#                                           (used for unique seqnr)
     Block<void*>            blockDataMan_p;   //# list of data managers
     Block<Bool>             dataManChanged_p; //# data has changed
+    //# The saved state of data managers whose opening is deferred.
+    std::vector<std::vector<uChar>> deferredState_p;
+    Block<Bool>             isDeferred_p;
+    uInt                    nrDeferred_p;
+    Double                  readColumnsTime_p;
+    Double                  openTime_p;
 };
 
 
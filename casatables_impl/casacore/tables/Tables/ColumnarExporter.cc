@@ -0,0 +1,390 @@
+//# ColumnarExporter.cc: Export table columns to a columnar file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/ColumnarExporter.h>
+#include <casacore/tables/Tables/RowGroupReader.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/IO/RegularFileIO.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/OS/ParallelJobs.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <algorithm>
+#include <limits>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+    // The encoded data of a column in a row group.
+    struct ColumnChunk
+    {
+        std::vector<char> data;
+        uInt64 plainSize;
+        uChar  codec;
+        Bool   hasStats;
+        std::vector<char> minMax;
+    };
+
+    // Append little endian values to a byte buffer.
+    template<typename T>
+    void putPlain (std::vector<char>& buf, const T* values, size_t n)
+    {
+        size_t off = buf.size();
+        buf.resize (off + n*sizeof(T));
+        LECanonicalConversion::fromLocal (buf.data() + off, values, n);
+    }
+    void putPlain (std::vector<char>& buf, const Bool* values, size_t n)
+    {
+        size_t off = buf.size();
+        buf.resize (off + n);
+        for (size_t i=0; i<n; ++i) {
+            buf[off+i] = (values[i] ? 1 : 0);
+        }
+    }
+    void putPlain (std::vector<char>& buf, const Complex* values, size_t n)
+    {
+        putPlain (buf, reinterpret_cast<const Float*>(values), 2*n);
+    }
+    void putPlain (std::vector<char>& buf, const DComplex* values, size_t n)
+    {
+        putPlain (buf, reinterpret_cast<const Double*>(values), 2*n);
+    }
+    void putPlain (std::vector<char>& buf, const String* values, size_t n)
+    {
+        for (size_t i=0; i<n; ++i) {
+            uInt len = values[i].size();
+            putPlain (buf, &len, 1);
+            buf.insert (buf.end(), values[i].data(), values[i].data() + len);
+        }
+    }
+
+    // Get the minimum and maximum value. NaNs compare false, so they are
+    // skipped once a first non-NaN value is found.
+    template<typename T>
+    Bool getMinMax (const T* values, size_t n, T& minVal, T& maxVal)
+    {
+        size_t i = 0;
+        while (i < n  &&  !(values[i] == values[i])) {
+            ++i;
+        }
+        if (i == n) {
+            return False;
+        }
+        minVal = maxVal = values[i];
+        for (++i; i<n; ++i) {
+            if (values[i] < minVal) {
+                minVal = values[i];
+            } else if (maxVal < values[i]) {
+                maxVal = values[i];
+            }
+        }
+        return True;
+    }
+    Bool getMinMax (const Complex*, size_t, Complex&, Complex&)
+        { return False; }
+    Bool getMinMax (const DComplex*, size_t, DComplex&, DComplex&)
+        { return False; }
+
+    // Transpose the values of <src>width</src> bytes into byte planes.
+    void shuffle (const char* in, size_t n, size_t width, char* out)
+    {
+        size_t nval = n / width;
+        for (size_t b=0; b<width; ++b) {
+            for (size_t i=0; i<nval; ++i) {
+                out[b*nval + i] = in[i*width + b];
+            }
+        }
+    }
+
+    // Run-length encode the bytes. It stops and returns False as soon as
+    // the output gets larger than maxSize.
+    Bool rleEncode (const char* in, size_t n, std::vector<char>& out,
+                    size_t maxSize)
+    {
+        out.clear();
+        out.reserve (std::min (maxSize, n + n/128 + 1));
+        size_t lit = 0;           // start of the pending literal bytes
+        auto flush = [&] (size_t end) {
+            while (lit < end) {
+                size_t k = std::min (end - lit, size_t(128));
+                out.push_back (char(k - 1));
+                out.insert (out.end(), in + lit, in + lit + k);
+                lit += k;
+            }
+        };
+        size_t i = 0;
+        while (i < n) {
+            size_t run = 1;
+            while (i + run < n  &&  run < 130  &&  in[i + run] == in[i]) {
+                ++run;
+            }
+            if (run >= 3) {
+                flush (i);
+                out.push_back (char(run + 125));
+                out.push_back (in[i]);
+                lit = i + run;
+            }
+            i += run;
+            if (out.size() > maxSize) {
+                return False;
+            }
+        }
+        flush (n);
+        return out.size() <= maxSize;
+    }
+
+    // Get the number of bytes of the units to shuffle.
+    size_t shuffleWidth (DataType dtype)
+    {
+        switch (dtype) {
+        case TpShort:
+        case TpUShort:
+            return 2;
+        case TpInt:
+        case TpUInt:
+        case TpFloat:
+        case TpComplex:
+            return 4;
+        case TpInt64:
+        case TpDouble:
+        case TpDComplex:
+            return 8;
+        default:
+            return 1;
+        }
+    }
+
+    // Get the type code used in the file.
+    uChar typeCode (DataType dtype)
+    {
+        switch (dtype) {
+        case TpBool:     return 1;
+        case TpChar:     return 2;
+        case TpUChar:    return 3;
+        case TpShort:    return 4;
+        case TpUShort:   return 5;
+        case TpInt:      return 6;
+        case TpUInt:     return 7;
+        case TpInt64:    return 8;
+        case TpFloat:    return 9;
+        case TpDouble:   return 10;
+        case TpComplex:  return 11;
+        case TpDComplex: return 12;
+        case TpString:   return 13;
+        default:
+            throw TableError ("ColumnarExporter: unsupported data type");
+        }
+    }
+
+    template<typename T>
+    void encodeValues (const ArrayBase& arr, std::vector<char>& plain,
+                       ColumnChunk& chunk)
+    {
+        const Array<T>& values = dynamic_cast<const Array<T>&>(arr);
+        const T* data = values.data();
+        size_t n = values.nelements();
+        putPlain (plain, data, n);
+        T minVal, maxVal;
+        chunk.hasStats = getMinMax (data, n, minVal, maxVal);
+        if (chunk.hasStats) {
+            putPlain (chunk.minMax, &minVal, 1);
+            putPlain (chunk.minMax, &maxVal, 1);
+        }
+    }
+
+    // Encode the data of a column in a row group.
+    void encodeChunk (const ArrayBase& arr, DataType dtype,
+                      ColumnarExporter::Codec codec, ColumnChunk& chunk)
+    {
+        std::vector<char> plain;
+        chunk.minMax.clear();
+        switch (dtype) {
+#define CE_CASE(DTYPE, CPPTYPE) \
+        case DTYPE: \
+            encodeValues<CPPTYPE> (arr, plain, chunk); \
+            break;
+        CE_CASE(TpBool, Bool)
+        CE_CASE(TpChar, Char)
+        CE_CASE(TpUChar, uChar)
+        CE_CASE(TpShort, Short)
+        CE_CASE(TpUShort, uShort)
+        CE_CASE(TpInt, Int)
+        CE_CASE(TpUInt, uInt)
+        CE_CASE(TpInt64, Int64)
+        CE_CASE(TpFloat, Float)
+        CE_CASE(TpDouble, Double)
+        CE_CASE(TpComplex, Complex)
+        CE_CASE(TpDComplex, DComplex)
+        CE_CASE(TpString, String)
+#undef CE_CASE
+        default:
+            throw TableError ("ColumnarExporter: unsupported data type");
+        }
+        chunk.plainSize = plain.size();
+        if (codec != ColumnarExporter::Plain) {
+            size_t width = shuffleWidth (dtype);
+            const char* bytes = plain.data();
+            std::vector<char> shuffled;
+            if (width > 1) {
+                shuffled.resize (plain.size());
+                shuffle (plain.data(), plain.size(), width, shuffled.data());
+                bytes = shuffled.data();
+            }
+            // With Auto, give up as soon as it does not pay off.
+            size_t maxSize = (codec == ColumnarExporter::Auto ?
+                              plain.size() - 1 :
+                              std::numeric_limits<size_t>::max());
+            if (!plain.empty()  &&
+                rleEncode (bytes, plain.size(), chunk.data, maxSize)) {
+                chunk.codec = ColumnarExporter::ShuffleRLE;
+                return;
+            }
+        }
+        chunk.codec = ColumnarExporter::Plain;
+        chunk.data.swap (plain);
+    }
+
+    // Buffer to build the footer in.
+    class FooterBuffer
+    {
+    public:
+        void putU8 (uChar value)
+            { buf_p.push_back (char(value)); }
+        void putU32 (uInt value)
+            { putPlain (buf_p, &value, 1); }
+        void putU64 (uInt64 value)
+            { putPlain (buf_p, &value, 1); }
+        void putString (const String& value)
+            { putPlain (buf_p, &value, 1); }
+        void putBytes (const std::vector<char>& bytes)
+            { buf_p.insert (buf_p.end(), bytes.begin(), bytes.end()); }
+        const std::vector<char>& data() const
+            { return buf_p; }
+    private:
+        std::vector<char> buf_p;
+    };
+
+} //# end anonymous namespace
+
+
+ColumnarExporter::ColumnarExporter (const Table& table,
+                                    const Vector<String>& columnNames,
+                                    rownr_t rowGroupSize, Codec codec,
+                                    uInt nthreads)
+: table_p        (table),
+  columnNames_p  (columnNames.copy()),
+  rowGroupSize_p (rowGroupSize),
+  codecs_p       (columnNames.size(), codec),
+  nthreads_p     (nthreads)
+{
+    if (rowGroupSize == 0) {
+        throw TableError ("ColumnarExporter: row group size must be positive");
+    }
+    for (uInt i=0; i<columnNames.size(); ++i) {
+        if (! table.tableDesc().isColumn (columnNames(i))) {
+            throw TableError ("ColumnarExporter: column " + columnNames(i) +
+                              " does not exist");
+        }
+    }
+    if (nthreads_p == 0) {
+        nthreads_p = std::max (HostInfo::numCPUs(true), 1);
+    }
+}
+
+void ColumnarExporter::setCodec (uInt column, Codec codec)
+{
+    if (column >= codecs_p.size()) {
+        throw TableError ("ColumnarExporter: column index " +
+                          String::toString (column) + " out of range");
+    }
+    codecs_p[column] = codec;
+}
+
+uInt ColumnarExporter::write (const String& fileName)
+{
+    // Prefetching overlaps reading a row group with encoding the previous.
+    RowGroupReader reader (table_p, columnNames_p, rowGroupSize_p, True);
+    uInt ncol = reader.ncolumn();
+    FooterBuffer footer;
+    footer.putU32 (1);
+    footer.putU64 (table_p.nrow());
+    footer.putU32 (ncol);
+    for (uInt i=0; i<ncol; ++i) {
+        footer.putString (reader.columnName(i));
+        footer.putU8 (typeCode (reader.dataType(i)));
+        footer.putU8 (codecs_p[i]);
+        const IPosition& shape = reader.cellShape(i);
+        footer.putU32 (shape.size());
+        for (uInt j=0; j<shape.size(); ++j) {
+            footer.putU64 (shape[j]);
+        }
+    }
+    FooterBuffer groups;
+    uInt ngroup = 0;
+    RegularFileIO file (RegularFile(fileName), ByteIO::New);
+    static const char magic[] = "CTCF";
+    file.write (4, magic);
+    uInt64 offset = 4;
+    std::vector<ColumnChunk> chunks(ncol);
+    while (reader.next()) {
+        ParallelJobs::run (nthreads_p, ncol,
+                           [&reader, &chunks, this] (uInt i) {
+                               encodeChunk (reader.columnData(i),
+                                            reader.dataType(i),
+                                            codecs_p[i], chunks[i]);
+                           });
+        groups.putU64 (reader.blockStart());
+        groups.putU64 (reader.blockRows());
+        for (uInt i=0; i<ncol; ++i) {
+            const ColumnChunk& chunk = chunks[i];
+            file.write (chunk.data.size(), chunk.data.data());
+            groups.putU64 (offset);
+            groups.putU64 (chunk.data.size());
+            groups.putU64 (chunk.plainSize);
+            groups.putU8 (chunk.codec);
+            groups.putU8 (chunk.hasStats ? 1 : 0);
+            if (chunk.hasStats) {
+                groups.putBytes (chunk.minMax);
+            }
+            offset += chunk.data.size();
+        }
+        ngroup++;
+    }
+    footer.putU32 (ngroup);
+    footer.putBytes (groups.data());
+    footer.putU64 (footer.data().size());
+    const std::vector<char>& data = footer.data();
+    file.write (data.size(), data.data());
+    file.write (4, magic);
+    return ngroup;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,175 @@
+//# ColumnarExporter.h: Export table columns to a columnar file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_COLUMNAREXPORTER_H
+#define TABLES_COLUMNAREXPORTER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/DataType.h>
+#include <casacore/tables/Tables/Table.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Export columns of a table to a file in a simple columnar format.
+// </summary>
+
+// <use visibility=export>
+
+// <prerequisite>
+//  <li> RowGroupReader
+// </prerequisite>
+
+// <synopsis>
+// ColumnarExporter writes some columns of a table to a self-describing
+// columnar file, laid out like a Parquet file, which can be read by tools
+// that do not know about casacore tables. The rows are written in row
+// groups. For each row group, the data of each column form a separate
+// chunk, which is encoded and compressed with the codec chosen for that
+// column. The footer of the file describes the columns and gives for each
+// chunk its location and the minimum and maximum value in it, so a reader
+// can skip row groups.
+//
+// The columns are read one row group at a time by a RowGroupReader, so
+// the next row group is read while the current one is encoded. The chunks
+// of a row group are encoded in parallel. Scalar and array columns of all
+// standard data types can be exported. All cells of an array column must
+// have the same shape (which is always true for a fixed shape column).
+//
+// All numbers in the file are little endian. It is laid out as:
+// <srcblock>
+//   "CTCF"                              magic (4 bytes)
+//   chunks                              row group after row group
+//   footer
+//   uint64 length of footer
+//   "CTCF"
+// </srcblock>
+// and the footer as:
+// <srcblock>
+//   uint32 version (1)
+//   uint64 number of rows
+//   uint32 number of columns
+//   per column:
+//     string name                       (uint32 length and UTF-8 bytes)
+//     uint8  type                       (see below)
+//     uint8  codec                      (as requested)
+//     uint32 number of cell axes, uint64 length per axis
+//   uint32 number of row groups
+//   per row group:
+//     uint64 first row, uint64 number of rows
+//     per column:
+//       uint64 offset, uint64 stored size, uint64 plain size
+//       uint8  codec used
+//       uint8  1 if minimum and maximum follow, else 0
+//       minimum, maximum                (plain encoding of one value)
+// </srcblock>
+// The types are 1=bool, 2=int8, 3=uint8, 4=int16, 5=uint16, 6=int32,
+// 7=uint32, 8=int64, 9=float32, 10=float64, 11=complex64, 12=complex128
+// and 13=string. The cell axes are given in casacore order (the first axis
+// varies fastest).
+//
+// The plain encoding of a chunk holds the values of the cells one after
+// the other (in the order of the cell axes), followed by the next row.
+// A bool is a single byte (0 or 1), a complex value is a real and an
+// imaginary part, and a string is a uint32 length followed by its bytes.
+// The codecs are:
+// <ul>
+//  <li> <src>Plain</src> stores the plain encoding as such.
+//  <li> <src>ShuffleRLE</src> transposes the plain encoding of fixed size
+//       values into byte planes (the first byte of each value, then the
+//       second byte, etc.; a complex value counts as two values) and
+//       run-length encodes the result. A control byte c below 128 is
+//       followed by c+1 literal bytes; a control byte c of 128 or more
+//       by a single byte to be repeated c-125 times.
+//       This works well for the slowly varying or repetitive values
+//       typically found in the metadata columns of a MeasurementSet.
+//  <li> <src>Auto</src> uses ShuffleRLE for a chunk if that makes it
+//       smaller, otherwise Plain. The footer tells which one was used.
+// </ul>
+// Statistics are not given for complex columns and for chunks without
+// values (or with only NaN values).
+// </synopsis>
+
+// <example>
+// <srcblock>
+//  Vector<String> names(2);
+//  names(0) = "TIME"; names(1) = "ANTENNA1";
+//  ColumnarExporter exporter (table, names, 100000);
+//  exporter.write ("main.ctcf");
+// </srcblock>
+// </example>
+
+class ColumnarExporter
+{
+public:
+    // The compression codecs of a column.
+    enum Codec {
+        Plain      = 0,
+        ShuffleRLE = 1,
+        Auto       = 2
+    };
+
+    // Set up the export of the given columns in row groups of (at most)
+    // <src>rowGroupSize</src> rows. All columns use the given codec.
+    // The chunks are encoded by <src>nthreads</src> threads; 0 means the
+    // number of CPUs.
+    ColumnarExporter (const Table& table, const Vector<String>& columnNames,
+                      rownr_t rowGroupSize = 65536, Codec codec = Auto,
+                      uInt nthreads = 0);
+
+    // Set the codec of the given column.
+    void setCodec (uInt column, Codec codec);
+
+    // Write the file, replacing an existing one.
+    // It returns the number of row groups written.
+    // As with a RowGroupReader, the table must not be used otherwise
+    // while the file is written.
+    uInt write (const String& fileName);
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    ColumnarExporter (const ColumnarExporter&);
+    ColumnarExporter& operator= (const ColumnarExporter&);
+    // </group>
+
+    Table               table_p;
+    Vector<String>      columnNames_p;
+    rownr_t             rowGroupSize_p;
+    std::vector<Codec>  codecs_p;
+    uInt                nthreads_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
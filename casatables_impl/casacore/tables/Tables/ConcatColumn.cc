@@ -30,10 +30,15 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/ParallelJobs.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+  std::atomic<uInt> ConcatColumn::maxNThreads_p (0);
+
   ConcatColumn::ConcatColumn (const BaseColumnDesc* bcdp,
 			      ConcatTable* reftab)
   : BaseColumn  (bcdp),
@@ -218,72 +223,132 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void ConcatColumn::getArrayColumn (ArrayBase& arr) const
   {
-    accessColumn (0, arr, &getColumnPart);
+    accessColumn (0, arr, &getColumnPart, True);
   }
 
   void ConcatColumn::getColumnSlice (const Slicer& ns,
 				     ArrayBase& arr) const
   {
-    accessColumn (&ns, arr, &getColumnSlicePart);
+    accessColumn (&ns, arr, &getColumnSlicePart, True);
   }
 
   void ConcatColumn::getArrayColumnCells (const RefRows& rownrs,
 					  ArrayBase& arr) const
   {
-    accessRows (rownrs, 0, arr, &getRowsPart);
+    accessRows (rownrs, 0, arr, &getRowsPart, True);
   }
 
   void ConcatColumn::getColumnSliceCells (const RefRows& rownrs,
 					  const Slicer& ns,
 					  ArrayBase& arr) const
   {
-    accessRows (rownrs, &ns, arr, &getRowsSlicePart);
+    accessRows (rownrs, &ns, arr, &getRowsSlicePart, True);
   }
 
   void ConcatColumn::putArrayColumn (const ArrayBase& arr)
   {
-    accessColumn (0, const_cast<ArrayBase&>(arr), &putColumnPart);
+    accessColumn (0, const_cast<ArrayBase&>(arr), &putColumnPart,
+		  False);
   }
 
   void ConcatColumn::putColumnSlice (const Slicer& ns,
 				     const ArrayBase& arr)
   {
-    accessColumn (&ns, const_cast<ArrayBase&>(arr), &putColumnSlicePart);
+    accessColumn (&ns, const_cast<ArrayBase&>(arr), &putColumnSlicePart,
+		  False);
   }
 
   void ConcatColumn::putArrayColumnCells (const RefRows& rownrs,
 					  const ArrayBase& arr)
   {
-    accessRows (rownrs, 0, const_cast<ArrayBase&>(arr), &putRowsPart);
+    accessRows (rownrs, 0, const_cast<ArrayBase&>(arr), &putRowsPart,
+		False);
   }
 
   void ConcatColumn::putColumnSliceCells (const RefRows& rownrs,
 					  const Slicer& ns,
 					  const ArrayBase& arr)
   {
-    accessRows (rownrs, &ns, const_cast<ArrayBase&>(arr), &putRowsSlicePart);
+    accessRows (rownrs, &ns, const_cast<ArrayBase&>(arr), &putRowsSlicePart,
+		False);
+  }
+
+  void ConcatColumn::setMaxNThreads (uInt nthreads)
+  {
+    maxNThreads_p = nthreads;
+  }
+
+  uInt ConcatColumn::maxNThreads()
+  {
+    return maxNThreads_p;
+  }
+
+  Bool ConcatColumn::useParallel (size_t nvalues)
+  {
+    // Below this size starting threads costs more than it can gain.
+    return nvalues >= 16384;
+  }
+
+  void ConcatColumn::runPerTable (JobList& jobs, Bool parallel) const
+  {
+    // Collect the jobs per group of tables that can be accessed concurrently.
+    std::vector<std::vector<std::function<void()>*> > groups
+      (refTabPtr_p->nrootGroup());
+    for (auto& job : jobs) {
+      groups[refTabPtr_p->rootGroup(job.first)].push_back (&job.second);
+    }
+    groups.erase (std::remove_if (groups.begin(), groups.end(),
+                                  [](const std::vector<std::function<void()>*>& g)
+                                  { return g.empty(); }),
+                  groups.end());
+    uInt ngroup = groups.size();
+    uInt nthread = maxNThreads_p;
+    if (nthread == 0) {
+      nthread = std::max (HostInfo::numCPUs(true), 1);
+    }
+    if (!parallel  ||  std::min (nthread, ngroup) <= 1) {
+      for (auto& job : jobs) {
+        job.second();
+      }
+      return;
+    }
+    ParallelJobs::run (nthread, ngroup, [&groups] (uInt g) {
+      for (auto job : groups[g]) {
+        (*job)();
+      }
+    });
   }
 
   void ConcatColumn::accessColumn (const Slicer* ns,
 				   ArrayBase& arr,
-				   AccessColumnFunc* accessFunc) const
+				   AccessColumnFunc* accessFunc,
+				   Bool parallel) const
   {
     IPosition st(arr.ndim(), 0);
     IPosition sz(arr.shape());
     uInt nlast = arr.ndim() - 1;
+    // Make the sections here, so the jobs only fill disjoint parts.
+    std::vector<std::shared_ptr<ArrayBase> > parts;
+    parts.reserve (refColPtr_p.nelements());
+    JobList jobs;
     for (uInt i=0; i<refColPtr_p.nelements(); ++i) {
       rownr_t nr = refColPtr_p[i]->nrow();
       sz[nlast] = nr;
-      std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-      accessFunc (refColPtr_p[i], ns, *part);
+      parts.push_back (std::shared_ptr<ArrayBase>
+                       (arr.getSection (Slicer(st, sz))));
+      ArrayBase* part = parts.back().get();
+      BaseColumn* col = refColPtr_p[i];
+      jobs.push_back (std::make_pair (i, [=]() { accessFunc (col, ns, *part); }));
       st[nlast] += nr;
     }
+    runPerTable (jobs, parallel  &&  useParallel (arr.nelements()));
   }
 
   void ConcatColumn::accessRows (const RefRows& rownrs,
 				 const Slicer* ns,
 				 ArrayBase& arr,
-				 AccessRowsFunc* accessFunc) const
+				 AccessRowsFunc* accessFunc,
+				 Bool parallel) const
   {
     // The rows to access.
     Vector<rownr_t> rows = rownrs.convert();
@@ -297,13 +362,27 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Vector<rownr_t> tabRowNrs(rows.nelements());
     // The rows are handled by combining them as much as possible in a RefRows
     // slice. This is possible until a different underlying table needs to
-    // be accessed.
+    // be accessed. Each such part becomes a job.
     // First setup the various loop variables.
     uInt rowAxis = arr.ndim() - 1;   // row axis in array
     IPosition st(arr.ndim(), 0);     // start of array part
     IPosition sz(arr.shape());       // size of array part
     Int lastTabNr = -1;
     uInt tableNr;
+    std::vector<std::shared_ptr<ArrayBase> > parts;
+    JobList jobs;
+    auto addJob = [&](rownr_t endRow) {
+      rownr_t nrrow = endRow - st[rowAxis];
+      sz[rowAxis] = nrrow;
+      Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow)));
+      parts.push_back (std::shared_ptr<ArrayBase>
+                       (arr.getSection (Slicer(st, sz))));
+      ArrayBase* part = parts.back().get();
+      BaseColumn* col = refColPtr_p[lastTabNr];
+      jobs.push_back (std::make_pair (uInt(lastTabNr), [=]() {
+        accessFunc (col, RefRows(rowPart), ns, *part);
+      }));
+    };
     // Step through all concat rownrs.
     for (rownr_t i=0; i<rows.nelements(); ++i) {
       // Map to the table and rownr in it.
@@ -312,23 +391,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       if (Int(tableNr) != lastTabNr) {
 	// Access the cells if not the first time.
 	if (lastTabNr >= 0) {
-	  rownr_t nrrow = i - st[rowAxis];
-	  sz[rowAxis] = nrrow;
-	  Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
-	  std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-	  accessFunc (refColPtr_p[lastTabNr], RefRows(rowPart), ns, *part);
+	  addJob (i);
 	}
         st[rowAxis] = i;
         lastTabNr = tableNr;
       }
     }
     if (lastTabNr >= 0) {
-      rownr_t nrrow = rows.nelements() - st[rowAxis];
-      sz[rowAxis] = nrrow;
-      Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
-      CountedPtr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-      accessFunc (refColPtr_p[lastTabNr], RefRows(rowPart), ns, *part);
+      addJob (rows.nelements());
     }
+    runPerTable (jobs, parallel  &&  useParallel (arr.nelements()));
   }
 
   void ConcatColumn::getColumnPart (BaseColumn* col,
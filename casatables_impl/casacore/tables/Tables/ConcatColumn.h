@@ -35,6 +35,10 @@
 #include <casacore/tables/Tables/ColumnCache.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <atomic>
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -223,6 +227,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Free the value buffers allocated by allocIterBuf.
     virtual void freeIterBuf (void*& lastVal, void*& curVal);
 
+    // Set or get the maximum number of threads used to read the parts
+    // of the underlying tables concurrently in the bulk get functions.
+    // The default 0 means the number of cores (see HostInfo::numCPUs);
+    // 1 means that the underlying tables are read one after the other.
+    // <group>
+    static void setMaxNThreads (uInt nthreads);
+    static uInt maxNThreads();
+    // </group>
+
   private:
     // Define the function to handle access to an entire column.
     typedef void AccessColumnFunc (BaseColumn* col,
@@ -233,15 +246,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                  const Slicer*, ArrayBase& array);
 
     // Access the data for an entire column.
+    // The parts in different underlying tables are accessed in parallel
+    // if <src>parallel</src> is True (see runPerTable).
     void accessColumn (const Slicer* ns,
 		       ArrayBase& dataPtr,
-		       AccessColumnFunc*) const;
+		       AccessColumnFunc*, Bool parallel) const;
 
     // Access the data with multiple rows combined.
     void accessRows (const RefRows& rownrs,
 		     const Slicer* ns,
 		     ArrayBase& dataPtr,
-		     AccessRowsFunc*) const;
+		     AccessRowsFunc*, Bool parallel) const;
 
     // Define the access functions.
     static void getColumnPart (BaseColumn* col,
@@ -263,6 +278,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // </group>
 
   protected:
+    // A list of jobs, each tagged with the number of the underlying
+    // table it accesses. The jobs must write to disjoint parts of the result.
+    typedef std::vector<std::pair<uInt, std::function<void()> > > JobList;
+
+    // Run the jobs. If <src>parallel</src> is True, the jobs of tables in
+    // different root groups (see ConcatTable::rootGroup) are run in
+    // separate threads; jobs of the same group are run in order by a single
+    // thread. The first exception thrown by a job is rethrown when all
+    // threads have finished.
+    void runPerTable (JobList& jobs, Bool parallel) const;
+
+    // Tell if accessing the given number of values is worth the cost of
+    // starting threads.
+    static Bool useParallel (size_t nvalues);
+
     // Set the column cache to the cache of the given table.
     // The row numbers will be adjusted as needed.
     void setColumnCache (uInt tableNr, const ColumnCache&) const;
@@ -272,6 +302,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Block<BaseColumn*>  refColPtr_p;
     mutable ColumnCache colCache_p;
     TableRecord         keywordSet_p;
+
+    static std::atomic<uInt> maxNThreads_p;
   };
 
 } //# NAMESPACE CASACORE - END
@@ -30,9 +30,11 @@
 
 #include <casacore/tables/Tables/ConcatScalarColumn.h>
 #include <casacore/tables/Tables/ConcatTable.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Utilities/GenSort.h>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -51,15 +53,20 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::getScalarColumn (ArrayBase& arr) const
   {
     Vector<T>& vec = static_cast<Vector<T>&>(arr);
+    // Each table fills its own part of the vector.
+    std::vector<Vector<T> > parts;
+    parts.reserve (refColPtr_p.nelements());
+    JobList jobs;
     rownr_t st = 0;
     for (uInt i=0; i<refColPtr_p.nelements(); ++i) {
       rownr_t nr = refColPtr_p[i]->nrow();
-      Vector<T> part = vec(Slice(st, nr));
-      refColPtr_p[i]->getScalarColumn (part);
+      parts.push_back (vec(Slice(st, nr)));
+      Vector<T>* part = &(parts.back());
+      BaseColumn* col = refColPtr_p[i];
+      jobs.push_back (std::make_pair (i, [=]() { col->getScalarColumn (*part); }));
       st += nr;
     }
-    // Set the column cache to the first table.
-    ///setColumnCache (0, refColPtr_p[0]->columnCache());
+    runPerTable (jobs, useParallel (vec.nelements()));
   }
 
   template<typename T>
@@ -67,23 +74,42 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 						    ArrayBase& arr) const
   {
     Vector<T>& vec = static_cast<Vector<T>&>(arr);
-    // Get the rownrs as a vector and sort it.
-    // In this way the data will be read in sequential order.
     Vector<rownr_t> rows = rownrs.convert();
     Vector<rownr_t> inx;
     GenSortIndirect<rownr_t,rownr_t>::sort (inx, rows);
+    // Split the rows per table in increasing order, keeping track
+    // of where each value has to be stored.
+    uInt ntab = refColPtr_p.nelements();
+    std::vector<std::vector<rownr_t> > tabRows(ntab);
+    std::vector<std::vector<rownr_t> > vecInx(ntab);
     const ConcatRows& ccRows = refTabPtr_p->rows();
     rownr_t tabRownr;
     uInt    tableNr=0;
-    // Map each row to rownr and tablenr.
-    // Note this is pretty fast because it is done in row order.
     for (rownr_t i=0; i<inx.nelements(); ++i) {
       rownr_t row = inx[i];
       ccRows.mapRownr (tableNr, tabRownr, rows[row]);
-      refColPtr_p[tableNr]->get (tabRownr, &(vec[row]));
+      tabRows[tableNr].push_back (tabRownr);
+      vecInx[tableNr].push_back (row);
     }
-    // Set the column cache to the last table used.
-    ///setColumnCache (tableNr, refColPtr_p[tableNr]->columnCache());
+    // Read the rows of each table in one go and scatter them in the result.
+    JobList jobs;
+    for (uInt i=0; i<ntab; ++i) {
+      if (! tabRows[i].empty()) {
+        const std::vector<rownr_t>* tabRowsPtr = &(tabRows[i]);
+        const std::vector<rownr_t>* vecInxPtr = &(vecInx[i]);
+        BaseColumn* col = refColPtr_p[i];
+        jobs.push_back (std::make_pair (i, [=, &vec]() {
+          Vector<T> values(tabRowsPtr->size());
+          col->getScalarColumnCells (RefRows(Vector<rownr_t>(*tabRowsPtr),
+                                             False, True),
+                                     values);
+          for (size_t j=0; j<vecInxPtr->size(); ++j) {
+            vec[(*vecInxPtr)[j]] = values[j];
+          }
+        }));
+      }
+    }
+    runPerTable (jobs, useParallel (rows.nelements()));
   }
 
   template<typename T>
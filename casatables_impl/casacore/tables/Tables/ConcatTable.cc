@@ -39,6 +39,9 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <map>
+#include <set>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -361,6 +364,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     //# Use the table description.
     tdescPtr_p = new TableDesc (*(actualDesc[0]), TableDesc::Scratch);
     keywordSet_p = tables_p[0].keywordSet();
+    makeRootGroups();
     // Handle the possible concatenated subtables.
     handleSubTables();
     // Create the concatColumns.
@@ -368,6 +372,53 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     makeConcatCol();
   }
 
+  void ConcatTable::makeRootGroups()
+  {
+    // Collect the names of the tables making up each underlying table.
+    // Tables having a name in common get the same group.
+    uInt ntab = tables_p.nelements();
+    std::vector<std::set<String> > partNames(ntab);
+    rootGroups_p.resize (ntab);
+    for (uInt i=0; i<ntab; ++i) {
+      Block<String> names = tables_p[i].getPartNames (True);
+      partNames[i].insert (names.begin(), names.end());
+      rootGroups_p[i] = i;
+      for (uInt j=0; j<i; ++j) {
+        Bool shared = False;
+        for (const String& name : partNames[i]) {
+          if (partNames[j].count (name) > 0) {
+            shared = True;
+            break;
+          }
+        }
+        if (shared) {
+          // Merge the group of table j with the group of table i.
+          uInt groupi = rootGroups_p[i];
+          uInt groupj = rootGroups_p[j];
+          uInt newGroup = std::min (groupi, groupj);
+          for (uInt k=0; k<=i; ++k) {
+            if (rootGroups_p[k] == groupi  ||  rootGroups_p[k] == groupj) {
+              rootGroups_p[k] = newGroup;
+            }
+          }
+        }
+      }
+    }
+    // Renumber the groups to 0..n-1.
+    std::map<uInt,uInt> groupMap;
+    for (uInt i=0; i<ntab; ++i) {
+      std::map<uInt,uInt>::const_iterator iter = groupMap.find (rootGroups_p[i]);
+      if (iter == groupMap.end()) {
+        uInt newGroup = groupMap.size();
+        groupMap[rootGroups_p[i]] = newGroup;
+        rootGroups_p[i] = newGroup;
+      } else {
+        rootGroups_p[i] = iter->second;
+      }
+    }
+    nrootGroup_p = groupMap.size();
+  }
+
   void ConcatTable::handleSubTables()
   {
     // Check for each subtable if it exists in all tables.
@@ -302,6 +302,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the column objects in the referenced tables.
     Block<BaseColumn*> getRefColumns (const String& columnName);
 
+    // Get the group of the i-th underlying table and the number of groups.
+    // Tables are in the same group if they (possibly indirectly) share
+    // a part, for instance if they are selections of the same table.
+    // Tables in different groups can be accessed concurrently.
+    // <group>
+    uInt rootGroup (uInt i) const
+      { return rootGroups_p[i]; }
+    uInt nrootGroup() const
+      { return nrootGroup_p; }
+    // </group>
+
     // Create a (temporary) Table object from it.
     Table asTable()
       { return Table (this, False); }
@@ -342,6 +353,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Add lines containing the concatenated tables to the info.
     void addInfo();
 
+    // Determine which underlying tables share a part (see rootGroup).
+    void makeRootGroups();
+
     // Create the ConcatColumn objects for all columns in the description.
     void makeConcatCol();
 
@@ -367,6 +381,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TableRecord       keywordSet_p;
     Bool              changed_p;           //# True = changed since last write
     ConcatRows        rows_p;
+    Block<uInt>       rootGroups_p;        //# group per table (see rootGroup)
+    uInt              nrootGroup_p;
   };
 
 
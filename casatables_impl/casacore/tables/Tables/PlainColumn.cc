@@ -44,7 +44,8 @@ PlainColumn::PlainColumn (const BaseColumnDesc* cdp, ColumnSet* csp)
   dataManPtr_p  (0),
   dataColPtr_p  (0),
   colSetPtr_p   (csp),
-  originalName_p(cdp->name())
+  originalName_p(cdp->name()),
+  metricsId_p   (-1)
 {
   int trace = TableTrace::traceColumn (columnDesc());
   rtraceColumn_p = (trace&TableTrace::READ)  != 0;
@@ -52,7 +53,25 @@ PlainColumn::PlainColumn (const BaseColumnDesc* cdp, ColumnSet* csp)
 }
 
 PlainColumn::~PlainColumn()
-{}
+{
+  if (metricsId_p >= 0) {
+    TableTrace::releaseMetricsColumn (metricsId_p);
+  }
+}
+
+int PlainColumn::registerMetrics() const
+{
+  // Threads reading the column can register it at the same time.
+  // Only the first id is kept; the others are released.
+  int id = TableTrace::metricsColumn (colSetPtr_p->tableName(),
+                                      columnDesc().name());
+  int expected = -1;
+  if (! metricsId_p.compare_exchange_strong (expected, id)) {
+    TableTrace::releaseMetricsColumn (id);
+    id = expected;
+  }
+  return id;
+}
 
 
 rownr_t PlainColumn:: nrow() const
@@ -35,6 +35,8 @@
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/tables/Tables/ColumnSet.h>
 #include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/TableTrace.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -144,11 +146,28 @@ protected:
     String              originalName_p;  //# Column name before any rename
     Bool                rtraceColumn_p;  //# trace reads of the column?
     Bool                wtraceColumn_p;  //# trace writes of the column?
+    mutable std::atomic<int> metricsId_p; //# -1 = not registered yet
 
     // Get the trace-id of the table.
     int traceId() const
       { return colSetPtr_p->traceId(); }
 
+    // Start timing an operation if metrics mode is on.
+    TableTrace::MetricsTimer metricsTimer (TableTrace::MetricsOper oper) const
+    {
+      if (! TableTrace::metricsEnabled()) {
+        return TableTrace::MetricsTimer();
+      }
+      int id = metricsId_p.load();
+      if (id < 0) {
+        id = registerMetrics();
+      }
+      return TableTrace::MetricsTimer (id, oper);
+    }
+
+    // Register the column for metrics if not done yet and return its id.
+    int registerMetrics() const;
+
     // Write the column.
     // The control information is written into the given AipsIO object,
     // while the data is written by the storage manager.
@@ -36,13 +36,21 @@
 #include <casacore/tables/Tables/TableTrace.h>
 #include <casacore/tables/Tables/PlainColumn.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/TableSnapshot.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Logging/LogIO.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/IO/FiledesIO.h>
 #include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/PrecTimer.h>
 #include <casacore/casa/System/AipsrcValue.h>
 #include <time.h>    //# for nanosleep
+#include <unistd.h>  //# for fsync
+#include <errno.h>   //# for errno
+#include <casacore/casa/string.h>  //# for strerror
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -78,6 +86,11 @@ void PlainTable::PlainTableCommon (SetupNewTable& newtab, rownr_t nrrow,
     addToCache_p   = True;
     lockPtr_p      = 0;
     tsmOption_p    = tsmOption;
+    lockTime_p     = 0;
+    descTime_p     = 0;
+    infoTime_p     = 0;
+    totalTime_p    = 0;
+    fromSnapshot_p = False;
     try {
     // Determine and set the endian option.
     setEndian (endianFormat);
@@ -174,8 +187,18 @@ PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
   tableChanged_p (False),
   addToCache_p   (addToCache),
   lockPtr_p      (0),
-  tsmOption_p    (tsmOption)
-{
+  tsmOption_p    (tsmOption),
+  lockTime_p     (0),
+  descTime_p     (0),
+  infoTime_p     (0),
+  totalTime_p    (0),
+  fromSnapshot_p (False)
+{
+    //# Time the parts of opening the table (see openTiming).
+    PrecTimer totalTimer;
+    PrecTimer timer;
+    totalTimer.start();
+    timer.start();
     // Replace default TSM option for existing table.
     tsmOption_p.fillOption (False);
     //# Set initially to no write in destructor.
@@ -199,14 +222,29 @@ PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
     Bool tableChanged;
     Block<Bool> dmChanged;
     lockSync_p.read (nrrow_p, ncolumn, tableChanged, dmChanged);
+    timer.stop();
+    lockTime_p = timer.getReal();
+    timer.reset();
+    timer.start();
     tdescPtr_p = new TableDesc ("", TableDesc::Scratch);
 
+    //# Use the snapshot of the table if it matches the table files.
+    //# It holds the description without keywords.
+    std::shared_ptr<TableSnapshot> snapshot =
+                         TableSnapshot::open (tabname, snapshotCounter());
+    fromSnapshot_p = (snapshot != 0);
+
     //# Reopen the file to be sure that the internal stdio buffer is not reused.
     //# This is a terrible hack, but it works.
     //# However, One time a better solution is needed.
     //# Probably stdio should not be used, but class RegularFileIO or
     //# FilebufIO should do its own buffering and have a sync function.
-    AipsIO ios (Table::fileName(tabname), ByteIO::Old);
+    //# The file is mapped, so large keyword arrays are not copied twice.
+    //# That is only done if the table is locked, because a file
+    //# truncated by another process would give a bus error.
+    Bool mapped = lockPtr_p->option() != TableLock::NoLocking
+              &&  lockPtr_p->hasLock (FileLocker::Read);
+    AipsIO ios (Table::fileName(tabname), ByteIO::Old, 65536, 0, mapped);
     String tp;
     version = ios.getstart ("Table");
     if (version > 3) {
@@ -238,12 +276,19 @@ PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
 #endif
 
     TableAttr attr (tableName(), isWritable(), lockOptions);
-    tdescPtr_p->getFile (ios, attr);            // read description
+    if (snapshot) {
+        snapshot->getDesc (*tdescPtr_p, attr);
+        ios.skipObject();
+    } else {
+        tdescPtr_p->getFile (ios, attr);        // read description
+    }
     // Check if the given table type matches the type in the file.
     if ((! type.empty())  &&  type != tdescPtr_p->getType()) {
         throw (TableInvType (tableName(), type, tdescPtr_p->getType()));
 	return;
     }
+    timer.stop();
+    descTime_p = timer.getReal();
     // In the older Table files the keyword set was written separately
     // and was not part of the TableDesc.
     // So read it for those and merge it into the TableDesc keywords.
@@ -267,11 +312,21 @@ PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
     nrrow_p = colSetPtr_p->getFile (ios, tab, nrrow_p, bigEndian_p,
                                     tsmOption_p);
     //# Read the TableInfo object.
-    getTableInfo();
+    timer.reset();
+    timer.start();
+    if (snapshot) {
+        info_p = snapshot->tableInfo();
+    } else {
+        getTableInfo();
+    }
+    timer.stop();
+    infoTime_p = timer.getReal();
     //# Release the read lock if UserLocking is used.
     if (lockPtr_p->option() == TableLock::UserLocking) {
 	lockPtr_p->release();
     }
+    totalTimer.stop();
+    totalTime_p = totalTimer.getReal();
     //# The destructor can (in principle) write.
     noWrite_p = False;
     //# Add it to the table cache.
@@ -465,15 +520,20 @@ void PlainTable::syncTable()
     // Something changed in the table file itself.
     // Reread it into a PlainTable object (don't add it to the cache).
     // Use a different locknr for it to preserve possible existing locks.
+    // If data managers have not been opened yet, only their state is needed,
+    // so defer opening them in the temporary table as well.
+    TSMOption tsmOpt (TSMOption::Buffer,0,0);
+    tsmOpt.setDeferOpen (colSetPtr_p->nrDeferred() > 0);
     BaseTable* btab = Table::makeBaseTable
                          (tableName(), "", Table::Old,
 			  TableLock(TableLock::PermanentLocking),
-			  TSMOption(TSMOption::Buffer,0,0), False, 1);
+			  tsmOpt, False, 1);
     PlainTable* tab = (PlainTable*)btab;
     TableAttr defaultAttr (tableName(), isWritable(), lockOptions());
     // Now check if all columns are the same.
-    // Update the column keywords.
+    // Update the column keywords and the state of deferred data managers.
     colSetPtr_p->syncColumns (*tab->colSetPtr_p, defaultAttr);
+    colSetPtr_p->syncDeferred (*tab->colSetPtr_p);
     // Adjust the attributes of subtables.
     // Update the table keywords.
     TableRecord& oldKeySet = keywordSet();
@@ -508,7 +568,7 @@ uInt PlainTable::getModifyCounter() const
 void PlainTable::flush (Bool fsync, Bool recursive)
 {
     if (openedForWrite()) {
-        putFile (False);
+        putFile (False, fsync);
         // Flush subtables if wanted.
         if (recursive) {
             keywordSet().flushTables (fsync);
@@ -517,6 +577,16 @@ void PlainTable::flush (Bool fsync, Bool recursive)
 }
 
 void PlainTable::resync()
+{
+    doResync (True);
+}
+
+void PlainTable::resyncChanged()
+{
+    doResync (False);
+}
+
+void PlainTable::doResync (Bool forceSync)
 {
     TableTrace::traceFile (itsTraceId, "resync");
     Bool tableChanged = True;
@@ -534,15 +604,21 @@ void PlainTable::resync()
                                tableName() + "; another process "
 			       "changed the number of columns"));
 	}
-	nrrow_p = colSetPtr_p->resync (nrrow, True);
+	nrrow_p = colSetPtr_p->resync (nrrow, forceSync);
 	if (tableChanged  &&  ncolumn > 0) {
 	    syncTable();
 	}
     }
 }
 
+Vector<String> PlainTable::dataManagerColumns
+                                  (const Block<Bool>& dataManagers) const
+{
+    return colSetPtr_p->dataManagerColumns (dataManagers);
+}
+
 
-Bool PlainTable::putFile (Bool always)
+Bool PlainTable::putFile (Bool always, Bool fsync)
 {
     TableTrace::traceFile (itsTraceId, "flush");
     Bool writeTab = always || tableChanged_p;
@@ -557,13 +633,24 @@ Bool PlainTable::putFile (Bool always)
 	writeStart (ios, bigEndian_p);
 	ios << "PlainTable";
 	tdescPtr_p->putFile (ios, attr);                 // write description
-	colSetPtr_p->putFile (True, ios, attr, False);   // write column data
+	colSetPtr_p->putFile (True, ios, attr, fsync);   // write column data
 	writeEnd (ios);
+	if (fsync) {
+	    String tabFile = Table::fileName (tableName());
+	    int fd = FiledesIO::open (tabFile.chars());
+	    int res = ::fsync (fd);
+	    int error = errno;
+	    FiledesIO::close (fd);
+	    if (res != 0) {
+		throw TableError ("Table " + tableName() + ": error in fsync"
+				  " of " + tabFile + ": " + strerror(error));
+	    }
+	}
 	//# Write the TableInfo.
 	flushTableInfo();
       } else {
         //# Tell the data managers to write their data only.
-        if (colSetPtr_p->putFile (False, ios, attr, False)) {
+        if (colSetPtr_p->putFile (False, ios, attr, fsync)) {
 	    written = True;
 #ifdef AIPS_TRACE
 	    cout << "  data PlainTable::putFile on " << tableName() << endl;
@@ -577,6 +664,18 @@ Bool PlainTable::putFile (Bool always)
 			  colSetPtr_p->dataManChanged());
 	lockPtr_p->putInfo (lockSync_p.memoryIO());
     }
+    // Keep a snapshot up to date. If that fails, the old one is not used
+    // anymore because it does not match the table file.
+    if (writeTab) {
+        try {
+            TableSnapshot::update (tableName(), *tdescPtr_p,
+                                   TableAttr(tableName()), snapshotCounter());
+        } catch (const AipsError& x) {
+            LogIO os;
+            os << LogIO::WARN << "Cannot update the snapshot of table "
+               << tableName() << ": " << x.what() << LogIO::POST;
+        }
+    }
     // Clear the change-flags for the next round.
     tableChanged_p = False;
     colSetPtr_p->dataManChanged() = False;
@@ -623,6 +722,65 @@ Record PlainTable::dataManagerInfo() const
   return colSetPtr_p->dataManagerInfo();
 }
 
+Record PlainTable::openTiming() const
+{
+  Record rec;
+  rec.define ("lock", lockTime_p);
+  rec.define ("description", descTime_p);
+  rec.define ("columns", colSetPtr_p->readColumnsTime());
+  rec.define ("datamanagers", colSetPtr_p->openTime());
+  rec.define ("info", infoTime_p);
+  rec.define ("total", totalTime_p);
+  rec.define ("ndeferred", colSetPtr_p->nrDeferred());
+  rec.define ("snapshot", fromSnapshot_p);
+  return rec;
+}
+
+Record PlainTable::cacheStatistics() const
+{
+  return colSetPtr_p->cacheStatistics();
+}
+
+Int64 PlainTable::vacuum()
+{
+    checkWritable("vacuum");
+    colSetPtr_p->checkWriteLock (True);
+    Int64 nregained = colSetPtr_p->vacuum();
+    colSetPtr_p->autoReleaseLock();
+    return nregained;
+}
+
+Bool PlainTable::writeOpenSnapshot()
+{
+    flush (False, False);
+    // Hold a read lock, so the sync data match the table file.
+    Bool hasLocked = colSetPtr_p->userLock (FileLocker::Read, True);
+    try {
+        colSetPtr_p->checkReadLock (True);
+        TableSnapshot::write (tableName(), *tdescPtr_p,
+                              TableAttr(tableName()), snapshotCounter());
+    } catch (...) {
+        colSetPtr_p->userUnlock (hasLocked);
+        throw;
+    }
+    colSetPtr_p->userUnlock (hasLocked);
+    return True;
+}
+
+Int64 PlainTable::snapshotCounter() const
+{
+    //# Without locking the change counter in the lock file is not kept.
+    if (lockPtr_p->option() == TableLock::NoLocking) {
+        return -1;
+    }
+    return lockSync_p.getTableChangeCounter();
+}
+
+Bool PlainTable::removeOpenSnapshot()
+{
+    return TableSnapshot::remove (tableName());
+}
+
 
 //# Get access to the keyword set.
 TableRecord& PlainTable::keywordSet()
@@ -644,10 +802,19 @@ TableRecord& PlainTable::rwKeywordSet()
 
 
 //# Get a column object.
+//# If opening the data managers was deferred, the column's one is opened.
 BaseColumn* PlainTable::getColumn (uInt columnIndex) const
-    { return colSetPtr_p->getColumn (columnIndex); }
+{
+    PlainColumn* column = colSetPtr_p->getColumn (columnIndex);
+    colSetPtr_p->openDeferred (column);
+    return column;
+}
 BaseColumn* PlainTable::getColumn (const String& columnName) const
-    { return colSetPtr_p->getColumn (columnName); }
+{
+    PlainColumn* column = colSetPtr_p->getColumn (columnName);
+    colSetPtr_p->openDeferred (column);
+    return column;
+}
 
 
 //# The data managers have to be inspected to tell if adding and removing
@@ -37,6 +37,7 @@
 #include <casacore/tables/Tables/TableSyncData.h>
 #include <casacore/tables/DataMan/TSMOption.h>
 #include <casacore/casa/IO/AipsIO.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -177,6 +178,19 @@ public:
     // Resync the Table object with the table file.
     virtual void resync();
 
+    // Resync the Table object with the table file, but only resync the
+    // data managers whose change counter in the lock file has changed
+    // (or all of them if the number of rows has changed).
+    void resyncChanged();
+
+    // Get the synchronization data as last read or written.
+    const TableSyncData& syncData() const
+      { return lockSync_p; }
+
+    // Get the names of the columns bound to the data managers flagged
+    // in <src>dataManagers</src> (indexed like the sync data counters).
+    Vector<String> dataManagerColumns (const Block<Bool>& dataManagers) const;
+
     // Get the modify counter.
     virtual uInt getModifyCounter() const;
 
@@ -196,6 +210,21 @@ public:
     // Get the data manager info.
     virtual Record dataManagerInfo() const;
 
+    // Get the times spent opening the table.
+    virtual Record openTiming() const;
+
+    // Get the statistics of the caches of the data managers.
+    virtual Record cacheStatistics() const;
+
+    // Regain the unused file space of the data managers.
+    virtual Int64 vacuum();
+
+    // Write or remove the snapshot of the table metadata.
+    // <group>
+    virtual Bool writeOpenSnapshot();
+    virtual Bool removeOpenSnapshot();
+    // </group>
+
     // Get readonly access to the table keyword set.
     virtual TableRecord& keywordSet();
 
@@ -290,9 +319,11 @@ private:
 
     // When needed, write the table control information in an AipsIO file.
     // Tell the storage managers to flush and close their files.
+    // If <src>fsync</src> is True, the data files are fsync-ed before the
+    // table control information is written and fsync-ed.
     // It returns a switch to tell if the table control information has
     // been written.
-    Bool putFile (Bool always);
+    Bool putFile (Bool always, Bool fsync = False);
 
     // Synchronize the table after having acquired a lock which says
     // that main table data has changed.
@@ -300,12 +331,20 @@ private:
     // It updates the table and column keywords.
     void syncTable();
 
+    // Resync with the sync data in the lock file, forcing all data
+    // managers to resync if <src>forceSync</src> is True.
+    void doResync (Bool forceSync);
+
     // Determine and set the endian format (big or little).
     void setEndian (int endianFormat);
 
     // Throw an exception if the table is not writable.
     void checkWritable (const char* func) const;
 
+    // Get the table change counter used to validate a TableSnapshot.
+    // It is -1 if the table is not locked.
+    Int64 snapshotCounter() const;
+
 
     CountedPtr<ColumnSet> colSetPtr_p;        //# pointer to set of columns
     Bool           tableChanged_p;     //# Has the main data changed?
@@ -315,6 +354,12 @@ private:
     Bool           bigEndian_p;        //# True  = big endian canonical
                                        //# False = little endian canonical
     TSMOption      tsmOption_p;
+    //# Times (in sec) spent in the parts of opening an existing table.
+    Double         lockTime_p;
+    Double         descTime_p;
+    Double         infoTime_p;
+    Double         totalTime_p;
+    Bool           fromSnapshot_p;     //# opened using a TableSnapshot?
     //# cache of open (plain) tables
     static TableCache theirTableCache;
 };
@@ -33,11 +33,15 @@
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/IO/MMapIO.h>
 #include <casacore/casa/OS/Path.h>
+#include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Quanta/MVAngle.h>
 #include <casacore/casa/Utilities/Regex.h>
@@ -47,10 +51,15 @@
 #include <casacore/casa/Logging/LogOrigin.h>
 
 #include <casacore/casa/stdio.h>
+#include <casacore/casa/stdlib.h>
 #include <casacore/casa/string.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/fstream.h>             // needed for file IO
 #include <casacore/casa/sstream.h>           // needed for internal IO
+#include <future>
+#include <limits>
+#include <memory>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -59,6 +68,15 @@ const Int lineSize = 32768;
 
 
 
+//# Helper function.
+//# Test if a line is a comment line, i.e. if the comment marker matches
+//# at its start. Regex::match only tries that position, while Regex::find
+//# would search the entire line.
+static Bool isComment (const Regex& commentMarker, const char* line, Int nch)
+{
+  return (nch > 0  &&  commentMarker.match (line, nch) != String::npos);
+}
+
 //# Helper function.
 //# Read a line and ignore lines to be skipped.
 Bool ReadAsciiTable::getLine (ifstream& file, Int& lineNumber,
@@ -66,14 +84,13 @@ Bool ReadAsciiTable::getLine (ifstream& file, Int& lineNumber,
 			      Bool testComment, const Regex& commentMarker,
 			      Int firstLine, Int lastLine)
 {
-  Int dummy;
   while (True) {
     if (! file.getline (line, lineSize)) {
       return False;
     }
     Int nch = file.gcount();
-    // Remove linefeed or newline.
-    if (nch > 0) nch--;
+    // Remove linefeed or newline (if the last line has one).
+    if (nch > 0  &&  !file.eof()) nch--;
     // Remove possible carriage return.
     if (nch > 1  &&  line[nch-1] == '\r') {
       nch--;
@@ -85,7 +102,7 @@ Bool ReadAsciiTable::getLine (ifstream& file, Int& lineNumber,
 	if (! testComment) {
 	  return True;
 	}
-	if (commentMarker.find (line, nch, dummy) != 0) {
+	if (! isComment (commentMarker, line, nch)) {
 	  return True;
 	}
       }
@@ -550,6 +567,22 @@ double ReadAsciiTable::stringToPos (const String& str, Bool isDMS)
   return val;
 }
 
+//# Convert a value to an integer like an istringstream does (i.e. up to the
+//# first invalid character and clipped to the range of the type), but
+//# without the overhead of creating a stream for each value.
+template<typename T>
+inline T toInteger (const char* str)
+{
+  Int64 val = strtoll (str, 0, 10);
+  if (val < Int64(std::numeric_limits<T>::min())) {
+    return std::numeric_limits<T>::min();
+  }
+  if (val > Int64(std::numeric_limits<T>::max())) {
+    return std::numeric_limits<T>::max();
+  }
+  return T(val);
+}
+
 Bool ReadAsciiTable::getValue (char* string1, Int lineSize, char* first,
 			       Int& at1, Char separator,
 			       Int type, void* value)
@@ -564,35 +597,34 @@ Bool ReadAsciiTable::getValue (char* string1, Int lineSize, char* first,
     first[0] = '\0';
   }
   if(more){
-  String dum(first, done1);
   switch (type) {
   case RATBool:
     *(Bool*)value = makeBool(String(first, done1));
     break;
   case RATShort:
     if (done1 > 0) {
-      istringstream(dum) >> *(Short*)value;
+      *(Short*)value = toInteger<Short> (first);
     } else {
       *(Short*)value = 0;
     }
     break;
   case RATInt:
     if (done1 > 0) {
-      istringstream(dum) >> *(Int*)value;
+      *(Int*)value = toInteger<Int> (first);
     } else {
       *(Int*)value = 0;
     }
     break;
   case RATFloat:
     if (done1 > 0) {
-      istringstream(dum) >> *(Float*)value;
+      *(Float*)value = strtof (first, 0);
     } else {
       *(Float*)value = 0;
     }
     break;
   case RATDouble:
     if (done1 > 0) {
-      istringstream(dum) >> *(Double*)value;
+      *(Double*)value = strtod (first, 0);
     } else {
       *(Double*)value = 0;
     }
@@ -608,46 +640,42 @@ Bool ReadAsciiTable::getValue (char* string1, Int lineSize, char* first,
     break;
   case RATComX:
     if (done1 > 0) {
-      istringstream(dum) >> f1;
+      f1 = strtof (first, 0);
     }
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> f2;
+      f2 = strtof (first, 0);
     }
     *(Complex*)value = Complex(f1, f2);
     break;
   case RATDComX:
     if (done1 > 0) {
-      istringstream(dum) >> d1;
+      d1 = strtod (first, 0);
     }
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> d2;
+      d2 = strtod (first, 0);
     }
     *(DComplex*)value = DComplex(d1, d2);
     break;
   case RATComZ:
     if (done1 > 0) {
-      istringstream(dum) >> f1;
+      f1 = strtof (first, 0);
     }
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> f2;
+      f2 = strtof (first, 0);
     }
     f2 *= 3.14159265/180.0; 
     *(Complex*)value = Complex(f1*cos(f2), f1*sin(f2));
     break;
   case RATDComZ:
     if (done1 > 0) {
-      istringstream(dum) >> d1;
+      d1 = strtod (first, 0);
     }
     done1 = getNext (string1, lineSize, first, at1, separator);
     if (done1 > 0) {
-      String dum2(first, done1);
-      istringstream(dum2) >> d2;
+      d2 = strtod (first, 0);
     }
     d2 *= 3.14159265/180.0; 
     *(DComplex*)value = DComplex(d1*cos(d2), d1*sin(d2));
@@ -1057,6 +1085,241 @@ void ReadAsciiTable::handleArray (char* string1, Int lineSize, char* first,
 }
 
 
+//# The values of a column parsed from a chunk of lines in fast mode.
+//# The buffer has room for all lines in the chunk, of which the first
+//# nrow are filled and written into the table.
+class ReadAsciiTable::ChunkColumn
+{
+public:
+  virtual ~ChunkColumn()
+    {}
+  // Parse the value(s) of the column in the given row from the line.
+  virtual void parse (char* string1, Int lineSize, char* first,
+		      Int& at1, Char separator, rownr_t row) = 0;
+  // Write the first nrow rows into the table column starting at rownr.
+  virtual void put (TableColumn& tabcol, rownr_t rownr, rownr_t nrow) = 0;
+};
+
+template<typename T>
+class ReadAsciiTable::ChunkColumnT : public ReadAsciiTable::ChunkColumn
+{
+public:
+  ChunkColumnT (Int type, const IPosition& shape, rownr_t nrow)
+    : type_p  (type),
+      shape_p (shape),
+      nelem_p (shape.empty()  ?  1 : shape.product())
+  {
+    IPosition fullShape (shape);
+    fullShape.append (IPosition (1, nrow));
+    data_p.resize (fullShape);
+    data_p = T();
+  }
+
+  virtual void parse (char* string1, Int lineSize, char* first,
+		      Int& at1, Char separator, rownr_t row)
+  {
+    // Like getArray, missing values keep their default.
+    T* value = data_p.data() + row * nelem_p;
+    for (uInt i=0; i<nelem_p; i++) {
+      if (! getValue (string1, lineSize, first, at1, separator,
+		      type_p, value + i)) {
+	break;
+      }
+    }
+  }
+
+  virtual void put (TableColumn& tabcol, rownr_t rownr, rownr_t nrow)
+  {
+    if (nrow == 0) {
+      return;
+    }
+    Array<T> view (data_p);
+    if (nrow != rownr_t(data_p.shape().last())) {
+      IPosition end (data_p.endPosition());
+      end[end.size() - 1] = nrow - 1;
+      view.reference (data_p (IPosition (end.size(), 0), end));
+    }
+    Slicer rowRange (IPosition (1, rownr), IPosition (1, nrow));
+    if (shape_p.empty()) {
+      Vector<T> vec (view);
+      ScalarColumn<T>(tabcol).putColumnRange (rowRange, vec);
+    } else {
+      ArrayColumn<T>(tabcol).putColumnRange (rowRange, view);
+    }
+  }
+
+private:
+  Int       type_p;
+  IPosition shape_p;
+  uInt      nelem_p;
+  Array<T>  data_p;
+};
+
+struct ReadAsciiTable::Chunk
+{
+  std::vector<std::shared_ptr<ChunkColumn>> columns;
+  rownr_t nrow;
+};
+
+
+rownr_t ReadAsciiTable::readParallel (Table& tab, TableColumn* tabcol,
+				      const String& fileName, Int64 offset,
+				      Int lineNumber, Int firstLine,
+				      Int lastLine, Bool testComment,
+				      const Regex& commentMarker,
+				      Char separator, Int nrcol,
+				      const Block<IPosition>& shapeOfColumn,
+				      const Block<Int>& typeOfColumn,
+				      uInt nthreads, Int64 chunkSize)
+{
+  // The lines are parsed in chunks of about chunkSize bytes. A group of
+  // nthreads chunks is parsed in parallel and then written into the
+  // table, which limits the memory used for the parsed values.
+  if (chunkSize <= 0) {
+    chunkSize = 4*1024*1024;
+  }
+  MMapIO file ((RegularFile(fileName)));
+  Int64 fileSize = file.getFileSize();
+  if (offset >= fileSize) {
+    return 0;
+  }
+  const char* data = static_cast<const char*>(file.getReadPointer (0));
+  const char* dataEnd = data + fileSize;
+  // Skip the lines before the first line to read, like getLine does.
+  while (lineNumber < firstLine-1  &&  offset < fileSize) {
+    const char* nl = static_cast<const char*>
+      (memchr (data + offset, '\n', fileSize - offset));
+    offset = (nl == 0  ?  fileSize : nl+1 - data);
+    lineNumber++;
+  }
+  if (offset >= fileSize) {
+    return 0;
+  }
+  // Find the end of the last line to read.
+  if (lastLine > 0) {
+    const char* ptr = data + offset;
+    for (Int nr=lineNumber; nr<lastLine  &&  ptr<dataEnd; nr++) {
+      const char* nl = static_cast<const char*>
+	(memchr (ptr, '\n', dataEnd - ptr));
+      ptr = (nl == 0  ?  dataEnd : nl+1);
+    }
+    dataEnd = ptr;
+  }
+  // Split the data into chunks of entire lines.
+  std::vector<const char*> bounds (1, data + offset);
+  while (bounds.back() < dataEnd) {
+    const char* ptr = bounds.back() + chunkSize;
+    if (ptr >= dataEnd) {
+      ptr = dataEnd;
+    } else {
+      const char* nl = static_cast<const char*>
+	(memchr (ptr, '\n', dataEnd - ptr));
+      ptr = (nl == 0  ?  dataEnd : nl+1);
+    }
+    bounds.push_back (ptr);
+  }
+  // Parse the lines of a chunk into a buffer per column, in the same way
+  // as makeTab does.
+  auto parseChunk = [&] (const char* start, const char* end)
+  {
+    Chunk chunk;
+    chunk.nrow = 0;
+    rownr_t maxrow = 1;
+    for (const char* ptr=start; ptr<end; ptr++) {
+      ptr = static_cast<const char*>(memchr (ptr, '\n', end - ptr));
+      if (ptr == 0) {
+	break;
+      }
+      maxrow++;
+    }
+    for (Int i=0; i<nrcol; i++) {
+      const IPosition& shape = shapeOfColumn[i];
+      ChunkColumn* col = 0;
+      switch (typeOfColumn[i]) {
+      case RATBool:
+	col = new ChunkColumnT<Bool> (RATBool, shape, maxrow);
+	break;
+      case RATShort:
+	col = new ChunkColumnT<Short> (RATShort, shape, maxrow);
+	break;
+      case RATInt:
+	col = new ChunkColumnT<Int> (RATInt, shape, maxrow);
+	break;
+      case RATFloat:
+	col = new ChunkColumnT<Float> (RATFloat, shape, maxrow);
+	break;
+      case RATDouble:
+	col = new ChunkColumnT<Double> (RATDouble, shape, maxrow);
+	break;
+      case RATString:
+	col = new ChunkColumnT<String> (RATString, shape, maxrow);
+	break;
+      case RATComX:
+      case RATComZ:
+	col = new ChunkColumnT<Complex> (typeOfColumn[i], shape, maxrow);
+	break;
+      case RATDComX:
+      case RATDComZ:
+	col = new ChunkColumnT<DComplex> (typeOfColumn[i], shape, maxrow);
+	break;
+      }
+      chunk.columns.push_back (std::shared_ptr<ChunkColumn>(col));
+    }
+    std::vector<char> string1;
+    std::vector<char> first;
+    while (start < end) {
+      const char* nl = static_cast<const char*>
+	(memchr (start, '\n', end - start));
+      const char* lineEnd = (nl == 0  ?  end : nl);
+      Int nch = lineEnd - start;
+      if (nch > 1  &&  start[nch-1] == '\r') {
+	nch--;
+      }
+      string1.resize (nch+1);
+      first.resize (nch+1);
+      memcpy (string1.data(), start, nch);
+      string1[nch] = '\0';
+      start = lineEnd + 1;
+      if (testComment  &&  isComment (commentMarker, string1.data(), nch)) {
+	continue;
+      }
+      Int at1 = 0;
+      for (Int i=0; i<nrcol; i++) {
+	chunk.columns[i]->parse (string1.data(), nch+1, first.data(),
+				 at1, separator, chunk.nrow);
+      }
+      chunk.nrow++;
+    }
+    return chunk;
+  };
+  if (nthreads == 0) {
+    nthreads = 1;
+  }
+  rownr_t rownr = tab.nrow();
+  rownr_t nradded = 0;
+  uInt nchunk = bounds.size() - 1;
+  for (uInt group=0; group<nchunk; group+=nthreads) {
+    uInt ngroup = std::min (nthreads, nchunk - group);
+    std::vector<std::future<Chunk>> futures;
+    for (uInt i=0; i<ngroup; i++) {
+      futures.push_back (std::async (std::launch::async, parseChunk,
+				     bounds[group+i], bounds[group+i+1]));
+    }
+    // Write the chunks in order; get() rethrows a parse exception.
+    for (uInt i=0; i<ngroup; i++) {
+      Chunk chunk = futures[i].get();
+      tab.addRow (chunk.nrow);
+      for (Int j=0; j<nrcol; j++) {
+	chunk.columns[j]->put (tabcol[j], rownr, chunk.nrow);
+      }
+      rownr   += chunk.nrow;
+      nradded += chunk.nrow;
+    }
+  }
+  return nradded;
+}
+
+
 Table ReadAsciiTable::makeTab (String& formatString,
 			       Table::TableType tableType,
 			       const String& headerfile, const String& filein, 
@@ -1067,7 +1330,8 @@ Table ReadAsciiTable::makeTab (String& formatString,
 			       const Vector<String>& dataTypes,
 			       Char separator,
 			       Bool testComment, const Regex& commentMarker,
-			       Int firstLine, Int lastLine)
+			       Int firstLine, Int lastLine, uInt nthreads,
+			       Int64 chunkSize)
 {
     char  string1[lineSize], string2[lineSize], stringsav[lineSize];
     char  first[lineSize], second[lineSize];
@@ -1106,6 +1370,7 @@ Table ReadAsciiTable::makeTab (String& formatString,
     ifstream jFile;
     Path headerPath(headerfile);
     String hdrName = headerPath.expandedName();
+    String dataName = hdrName;
     jFile.open(hdrName.chars(), ios::in);
     if (! jFile) {
         throw AipsError ("ReadAsciiTable: file " + hdrName +
@@ -1160,6 +1425,7 @@ Table ReadAsciiTable::makeTab (String& formatString,
         jFile.close();
 	Path filePath(filein);
 	String fileName = filePath.expandedName();
+	dataName = fileName;
 	jFile.open(fileName.chars(), ios::in);
 	if (! jFile) {
 	    throw AipsError ("ReadAsciiTable: input file " + fileName +
@@ -1367,15 +1633,26 @@ Table ReadAsciiTable::makeTab (String& formatString,
     }
     rownr_t rownr = 0;
 
+// Variable shaped arrays and positions cannot be read in parallel.
+// Note that varAxis is the one of the last column.
+
+    Bool parallel = (nthreads > 0  &&  varAxis < 0);
+    for (Int i=0; i<nrcol; i++) {
+        if (typeOfColumn[i] == RATDMS  ||  typeOfColumn[i] == RATHMS) {
+	    parallel = False;
+	}
+    }
+
 // OK, Now we have real data
 // stringsav may contain the first data line.
+// In fast mode only that line is handled here.
 
     int at1=0;
     Bool cont = True;
     if (stringsav[0] == '\0') {
-        cont = getLine (jFile, lineNumber, string1, lineSize,
-			testComment, commentMarker,
-			firstLine, lastLine);
+        cont = (!parallel  &&  getLine (jFile, lineNumber, string1, lineSize,
+					 testComment, commentMarker,
+					 firstLine, lastLine));
     } else {
         strcpy (string1, stringsav);
     }
@@ -1398,9 +1675,20 @@ Table ReadAsciiTable::makeTab (String& formatString,
 	    }
 	}
 	rownr++;
-        cont = getLine (jFile, lineNumber, string1, lineSize,
-			testComment, commentMarker,
-			firstLine, lastLine);
+        cont = (!parallel  &&  getLine (jFile, lineNumber, string1, lineSize,
+					 testComment, commentMarker,
+					 firstLine, lastLine));
+    }
+    if (parallel) {
+        //# tellg fails if the end of the file has been reached.
+        Int64 offset = jFile.tellg();
+	if (offset >= 0) {
+	    rownr += readParallel (tab, tabcol, dataName, offset,
+				   lineNumber, firstLine, lastLine,
+				   testComment, commentMarker, separator,
+				   nrcol, shapeOfColumn, typeOfColumn,
+				   nthreads, chunkSize);
+	}
     }
 
     delete [] tabcol;
@@ -1425,7 +1713,7 @@ String ReadAsciiTable::doRun (const String& headerfile, const String& filein,
 		       headerfile, filein, tableproto, tablename,
 		       autoHeader, autoShape, columnNames, dataTypes,
 		       separator, testComment, commentMarker,
-		       firstLine, lastLine);
+		       firstLine, lastLine, 0, 0);
   return formatString;
 }
 
@@ -1468,7 +1756,8 @@ Table ReadAsciiTable::runt (String& formatString, Table::TableType tableType,
 			    const Vector<String>& dataTypes,
 			    Char separator,
 			    const String& commentMarkerRegex,
-			    Int firstLine, Int lastLine)
+			    Int firstLine, Int lastLine, uInt nthreads,
+			    Int64 chunkSize)
 {
   if (firstLine < 1) {
     firstLine = 1;
@@ -1483,14 +1772,14 @@ Table ReadAsciiTable::runt (String& formatString, Table::TableType tableType,
 		    headerfile, filein, tableproto, tablename,
 		    autoHeader, autoShape, columnNames, dataTypes, separator,
 		    False, regex,
-		    firstLine, lastLine);
+		    firstLine, lastLine, nthreads, chunkSize);
   } else {
     regex = Regex(commentMarkerRegex);
     return makeTab (formatString, tableType,
 		    headerfile, filein, tableproto, tablename,
 		    autoHeader, autoShape, columnNames, dataTypes, separator,
 		    True, regex,
-		    firstLine, lastLine);
+		    firstLine, lastLine, nthreads, chunkSize);
   }
 }
 
@@ -1550,14 +1839,15 @@ Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& tablename, Bool autoHeader,
 		      Char separator, const String& commentMarkerRegex,
 		      Int firstLine, Int lastLine,
-		      const IPosition& autoShape)
+		      const IPosition& autoShape, uInt nthreads,
+		      Int64 chunkSize)
 {
   Vector<String> dumvec;
   return ReadAsciiTable::runt (formatString, tableType,
 			       filein, filein, tableproto, tablename,
 			       autoHeader, autoShape, dumvec, dumvec,
 			       separator, commentMarkerRegex,
-			       firstLine, lastLine);
+			       firstLine, lastLine, nthreads, chunkSize);
 }
 
 Table readAsciiTable (String& formatString, Table::TableType tableType,
@@ -1566,34 +1856,37 @@ Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const Vector<String>& columnNames,
 		      const Vector<String>& dataTypes,
 		      Char separator, const String& commentMarkerRegex,
-		      Int firstLine, Int lastLine)
+		      Int firstLine, Int lastLine, uInt nthreads,
+		      Int64 chunkSize)
 {
   return ReadAsciiTable::runt (formatString, tableType,
 			       filein, filein, tableproto, tablename,
 			       False, IPosition(), columnNames, dataTypes,
 			       separator, commentMarkerRegex,
-			       firstLine, lastLine);
+			       firstLine, lastLine, nthreads, chunkSize);
 }
 
 Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& headerfile, const String& filein,
 		      const String& tableproto, const String& tablename,
 		      Char separator, const String& commentMarkerRegex,
-		      Int firstLine, Int lastLine)
+		      Int firstLine, Int lastLine, uInt nthreads,
+		      Int64 chunkSize)
 {
   Vector<String> dumvec;
   return ReadAsciiTable::runt (formatString, tableType,
 			       headerfile, filein, tableproto, tablename,
 			       False, IPosition(), dumvec, dumvec,
 			       separator, commentMarkerRegex,
-			       firstLine, lastLine);
+			       firstLine, lastLine, nthreads, chunkSize);
 }
 
 Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& headerfile, const String& filein,
 		      const String& tableproto, const char* tablename,
 		      Char separator, const String& commentMarkerRegex,
-		      Int firstLine, Int lastLine)
+		      Int firstLine, Int lastLine, uInt nthreads,
+		      Int64 chunkSize)
 {
   Vector<String> dumvec;
   return ReadAsciiTable::runt (formatString, tableType,
@@ -1601,7 +1894,7 @@ Table readAsciiTable (String& formatString, Table::TableType tableType,
 			       String(tablename),
 			       False, IPosition(), dumvec, dumvec,
 			       separator, commentMarkerRegex,
-			       firstLine, lastLine);
+			       firstLine, lastLine, nthreads, chunkSize);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -44,6 +44,7 @@ class IPosition;
 class LogIO;
 class TableRecord;
 class TableColumn;
+template<class T> class Block;
 
 
 // <summary>
@@ -270,6 +271,15 @@ String readAsciiTable (const String& headerFile, const String& dataFile,
 // Similar versions as above, but returning a Table object.
 // The format string is returned in the first argument.
 // The type of Table can be given (Plain or Memory).
+// <br>If <src>nthreads</src> is positive, the data lines are read in
+// fast mode: the data file is memory-mapped and split into chunks of
+// lines, which are parsed in parallel by <src>nthreads</src> threads and
+// written into the columns in bulk. The result is the same as reading
+// line by line, except that lines can have any length.
+// Variable shaped arrays and DMS or HMS columns cannot be read in
+// parallel; in that case the lines are read one by one.
+// <src>chunkSize</src> gives the approximate size in bytes of the chunks
+// (4 MB if <= 0); it is mainly meant for testing.
 // <group>
 Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& filein, const String& tableDescName,
@@ -277,26 +287,30 @@ Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      Char separator = ' ',
 		      const String& commentMarkerRegex = "",
 		      Int firstLine = 1, Int lastLine = -1,
-		      const IPosition& autoShape = IPosition());
+		      const IPosition& autoShape = IPosition(),
+		      uInt nthreads = 0, Int64 chunkSize = 0);
 Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& filein, const String& tableproto,
 		      const String& tablename,
 		      const Vector<String>& columnNames,
 		      const Vector<String>& dataTypes,
 		      Char separator, const String& commentMarkerRegex,
-		      Int firstLine, Int lastLine);
+		      Int firstLine, Int lastLine,
+		      uInt nthreads = 0, Int64 chunkSize = 0);
 Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& headerFile, const String& dataFile, 
 		      const String& tableDescName, const String& tablename,
 		      Char separator = ' ',
 		      const String& commentMarkerRegex = "",
-		      Int firstLine = 1, Int lastLine = -1);
+		      Int firstLine = 1, Int lastLine = -1,
+		      uInt nthreads = 0, Int64 chunkSize = 0);
 Table readAsciiTable (String& formatString, Table::TableType tableType,
 		      const String& headerFile, const String& dataFile, 
 		      const String& tableDescName, const char* tablename,
 		      Char separator = ' ',
 		      const String& commentMarkerRegex = "",
-		      Int firstLine = 1, Int lastLine = -1);
+		      Int firstLine = 1, Int lastLine = -1,
+		      uInt nthreads = 0, Int64 chunkSize = 0);
 // </group>
 
 // </group>
@@ -336,7 +350,8 @@ public:
 		     const Vector<String>& dataTypes,
 		     Char separator,
 		     const String& commentMarkerRegex,
-		     Int firstLine, Int lastLine);
+		     Int firstLine, Int lastLine,
+		     uInt nthreads = 0, Int64 chunkSize = 0);
 
   // Read a position using MVAngle.
   // If isDMS is True, a position with : is treated as DMS instead of HMS.
@@ -370,7 +385,23 @@ private:
 			const Vector<String>& dataTypes,
 			Char separator,
 			Bool testComment, const Regex& commentMarker,
-			Int firstLine, Int lastLine);
+			Int firstLine, Int lastLine, uInt nthreads,
+			Int64 chunkSize);
+
+  // Read the data lines from the given offset in the file in fast mode
+  // and add them to the table. <src>lineNumber</src> is the number of
+  // lines before the offset. Lines before <src>firstLine</src> are
+  // skipped. The lines are parsed in chunks of about
+  // <src>chunkSize</src> bytes (4 MB if <= 0).
+  // It returns the number of rows added.
+  static rownr_t readParallel (Table& tab, TableColumn* tabcol,
+			       const String& fileName, Int64 offset,
+			       Int lineNumber, Int firstLine, Int lastLine,
+			       Bool testComment, const Regex& commentMarker,
+			       Char separator, Int nrcol,
+			       const Block<IPosition>& shapeOfColumn,
+			       const Block<Int>& typeOfColumn,
+			       uInt nthreads, Int64 chunkSize);
 
   // Get the next line. Skip lines to be ignored.
   // It returns False when no more lines are available.
@@ -436,6 +467,14 @@ private:
 			   const IPosition& shape, Int varAxis,
 			   Int type,
 			   TableColumn& tabcol, rownr_t rownr);
+
+  // The values of a column parsed from a chunk of lines in fast mode.
+  // <group>
+  class ChunkColumn;
+  template<typename T> class ChunkColumnT;
+  // </group>
+  // The parsed columns of a chunk of lines.
+  struct Chunk;
 };
 
 
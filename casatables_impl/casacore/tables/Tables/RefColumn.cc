@@ -114,72 +114,97 @@ void RefColumn::putArray (rownr_t rownr, const ArrayBase& data)
 void RefColumn::putSlice (rownr_t rownr, const Slicer& ns, const ArrayBase& data)
     { colPtr_p->putSlice (refTabPtr_p->rootRownr(rownr), ns, data); }
 
+//# Tell if the (collapsed) root row numbers are all rows of the parent
+//# in their natural order. In that case the parent can do a full column
+//# access, which is usually cheaper than accessing cells.
+static Bool isFullColumn (const RefRows& rownrs, rownr_t parentNrow)
+{
+    if (! rownrs.isSliced()  ||  rownrs.rowVector().nelements() != 3) {
+        return False;
+    }
+    const Vector<rownr_t>& rows = rownrs.rowVector();
+    return rows(0) == 0  &&  rows(2) == 1  &&  rows(1) + 1 == parentNrow;
+}
+
+//# The bulk accessors hand the parent column the root row numbers
+//# collapsed into runs (see RefTable::rootRefRows), so the data managers
+//# can handle each contiguous or strided run in one go.
 void RefColumn::getScalarColumn (ArrayBase& data) const
 {
-    colPtr_p->getScalarColumnCells (refTabPtr_p->rowNumbers(), data);
+    RefRows rownrs (refTabPtr_p->rootRefRows());
+    if (isFullColumn (rownrs, colPtr_p->nrow())) {
+        colPtr_p->getScalarColumn (data);
+    } else {
+        colPtr_p->getScalarColumnCells (rownrs, data);
+    }
 }
 void RefColumn::getArrayColumn (ArrayBase& data) const
 {
-    colPtr_p->getArrayColumnCells (refTabPtr_p->rowNumbers(), data);
+    RefRows rownrs (refTabPtr_p->rootRefRows());
+    if (isFullColumn (rownrs, colPtr_p->nrow())) {
+        colPtr_p->getArrayColumn (data);
+    } else {
+        colPtr_p->getArrayColumnCells (rownrs, data);
+    }
 }
 void RefColumn::getColumnSlice (const Slicer& ns,
 				ArrayBase& data) const
 {
-    colPtr_p->getColumnSliceCells (refTabPtr_p->rowNumbers(), ns, data); 
+    RefRows rownrs (refTabPtr_p->rootRefRows());
+    if (isFullColumn (rownrs, colPtr_p->nrow())) {
+        colPtr_p->getColumnSlice (ns, data);
+    } else {
+        colPtr_p->getColumnSliceCells (rownrs, ns, data);
+    }
 }
 void RefColumn::getScalarColumnCells (const RefRows& rownrs,
 				      ArrayBase& data) const
 {
-    colPtr_p->getScalarColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
-				    data);
+    colPtr_p->getScalarColumnCells (refTabPtr_p->rootRefRows(rownrs), data);
 }
 void RefColumn::getArrayColumnCells (const RefRows& rownrs,
 				     ArrayBase& data) const
 {
-    colPtr_p->getArrayColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
-				   data);
+    colPtr_p->getArrayColumnCells (refTabPtr_p->rootRefRows(rownrs), data);
 }
 void RefColumn::getColumnSliceCells (const RefRows& rownrs,
 				     const Slicer& ns,
 				     ArrayBase& data) const
 {
-    colPtr_p->getColumnSliceCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->getColumnSliceCells (refTabPtr_p->rootRefRows(rownrs),
 				   ns, data);
 }
 void RefColumn::putScalarColumn (const ArrayBase& data)
 {
-    colPtr_p->putScalarColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->putScalarColumnCells (refTabPtr_p->rootRefRows(), data);
 }
 void RefColumn::putArrayColumn (const ArrayBase& data)
 {
-    colPtr_p->putArrayColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->putArrayColumnCells (refTabPtr_p->rootRefRows(), data);
 }
 void RefColumn::putColumnSlice (const Slicer& ns,
 				const ArrayBase& data)
 {
-    colPtr_p->putColumnSliceCells (refTabPtr_p->rowNumbers(), ns, data); 
+    colPtr_p->putColumnSliceCells (refTabPtr_p->rootRefRows(), ns, data);
 }
 void RefColumn::putScalarColumnCells (const RefRows& rownrs,
 				      const ArrayBase& data)
 {
-    colPtr_p->putScalarColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
-				    data);
+    colPtr_p->putScalarColumnCells (refTabPtr_p->rootRefRows(rownrs), data);
 }
 void RefColumn::putArrayColumnCells (const RefRows& rownrs,
 				     const ArrayBase& data)
 {
-    colPtr_p->putArrayColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
-				   data);
+    colPtr_p->putArrayColumnCells (refTabPtr_p->rootRefRows(rownrs), data);
 }
 void RefColumn::putColumnSliceCells (const RefRows& rownrs,
 				     const Slicer& ns,
 				     const ArrayBase& data)
 {
-    colPtr_p->putColumnSliceCells (rownrs.convert(refTabPtr_p->rowNumbers()),
+    colPtr_p->putColumnSliceCells (refTabPtr_p->rootRefRows(rownrs),
 				   ns, data);
 }
 
-
 ColumnCache& RefColumn::columnCache()
     { return colCache_p; }
 
@@ -27,6 +27,7 @@
 
 #include <casacore/tables/Tables/RefTable.h>
 #include <casacore/tables/Tables/RefColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableLock.h>
@@ -736,6 +737,16 @@ Vector<rownr_t> RefTable::rootRownr (const Vector<rownr_t>& rownrs) const
     }
     return rnr;
 }
+
+RefRows RefTable::rootRefRows() const
+{
+    return RefRows (rowNumbers(), False, True);
+}
+
+RefRows RefTable::rootRefRows (const RefRows& rownrs) const
+{
+    return RefRows (rownrs.convert (rowNumbers()), False, True);
+}
 	
 
 BaseTable* RefTable::root()
@@ -41,6 +41,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class TSMOption;
 class RefColumn;
+class RefRows;
 class AipsIO;
 
 
@@ -300,6 +301,16 @@ public:
     // This converts the given row numbers to row numbers in the root table.
     Vector<rownr_t> rootRownr (const Vector<rownr_t>& rownrs) const;
 
+    // Get the row numbers in the root table as a RefRows object.
+    // Runs of contiguous or equally strided row numbers are collapsed into
+    // slices, so the parent column can read or write them run by run
+    // instead of row by row. The second version does it for the given
+    // row numbers in this table.
+    // <group>
+    RefRows rootRefRows() const;
+    RefRows rootRefRows (const RefRows& rownrs) const;
+    // </group>
+
     // Tell if the table is in row order.
     virtual Bool rowOrder() const;
 
@@ -0,0 +1,277 @@
+//# RowGroupReader.cc: Read blocks of rows from some columns of a table
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/RowGroupReader.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/TableError.h>
+
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// This class is used internally by RowGroupReader. It holds a column
+// and the buffers its blocks are read into.
+
+class RowGroupColumn {
+public:
+    RowGroupColumn (const String& name, DataType dtype, const IPosition& shape)
+      : name_p (name), dtype_p (dtype), cellShape_p (shape)
+    {}
+    virtual ~RowGroupColumn()
+    {}
+
+    // Read <src>nrow</src> rows starting at <src>start</src> into
+    // the buffer of the given slot.
+    virtual void read (uInt slot, rownr_t start, rownr_t nrow) = 0;
+
+    // Get the buffer of the given slot as filled by the last read.
+    virtual const ArrayBase& data (uInt slot) const = 0;
+
+    const String& name() const
+        { return name_p; }
+    DataType dataType() const
+        { return dtype_p; }
+    const IPosition& cellShape() const
+        { return cellShape_p; }
+
+private:
+    String    name_p;
+    DataType  dtype_p;
+    IPosition cellShape_p;
+};
+
+
+template<typename T>
+class RowGroupColumnT : public RowGroupColumn {
+public:
+    RowGroupColumnT (const Table& table, const String& name, DataType dtype,
+                     const IPosition& shape, rownr_t slotRows, uInt nslot)
+      : RowGroupColumn (name, dtype, shape),
+        store_p (nslot),
+        view_p  (nslot)
+    {
+        if (shape.empty()) {
+            scaCol_p.attach (table, name);
+        } else {
+            arrCol_p.attach (table, name);
+        }
+        IPosition fullShape (shape);
+        fullShape.append (IPosition (1, slotRows));
+        for (uInt i=0; i<nslot; ++i) {
+            store_p[i].resize (fullShape);
+            view_p[i].reference (store_p[i]);
+        }
+    }
+
+    virtual void read (uInt slot, rownr_t start, rownr_t nrow)
+    {
+        Array<T>& view = view_p[slot];
+        // Only the last (short) block needs a view on part of the buffer.
+        // Trimming the row axis keeps the view contiguous.
+        if (view.shape().last() != Int64(nrow)) {
+            const Array<T>& store = store_p[slot];
+            IPosition end (store.endPosition());
+            end[end.size() - 1] = nrow - 1;
+            view.reference (store (IPosition (end.size(), 0), end));
+        }
+        Slicer rowRange (IPosition (1, start), IPosition (1, nrow));
+        if (scaCol_p.isNull()) {
+            try {
+                arrCol_p.getColumnRange (rowRange, view, False);
+            } catch (const std::exception& x) {
+                if (arrCol_p.columnDesc().isFixedShape()) {
+                    throw;
+                }
+                throw TableError ("RowGroupReader: cannot read rows " +
+                                  String::toString (start) + " to " +
+                                  String::toString (start + nrow - 1) +
+                                  " of column " + name() +
+                                  "; all its cells must have shape " +
+                                  cellShape().toString() + " (" +
+                                  x.what() + ")");
+            }
+        } else {
+            Vector<T> vec (view);
+            scaCol_p.getColumnRange (rowRange, vec, False);
+        }
+    }
+
+    virtual const ArrayBase& data (uInt slot) const
+        { return view_p[slot]; }
+
+private:
+    ScalarColumn<T>       scaCol_p;
+    ArrayColumn<T>        arrCol_p;
+    std::vector<Array<T>> store_p;
+    std::vector<Array<T>> view_p;
+};
+
+
+RowGroupReader::RowGroupReader (const Table& table,
+                                const Vector<String>& columnNames,
+                                rownr_t blockSize, Bool prefetch)
+: nrow_p       (table.nrow()),
+  blockSize_p  (blockSize),
+  prefetch_p   (prefetch),
+  slot_p       (0),
+  blockStart_p (0),
+  blockRows_p  (0),
+  nextStart_p  (0)
+{
+    if (blockSize == 0) {
+        throw TableError ("RowGroupReader: block size must be positive");
+    }
+    uInt nslot = (prefetch ? 2 : 1);
+    // A block never holds more rows than the table has.
+    rownr_t slotRows = std::min (blockSize, nrow_p);
+    for (uInt i=0; i<columnNames.size(); ++i) {
+        const String& name = columnNames(i);
+        TableColumn col (table, name);
+        const ColumnDesc& desc = col.columnDesc();
+        IPosition shape;
+        if (desc.isArray()) {
+            if (desc.isFixedShape()) {
+                shape = desc.shape();
+            } else if (nrow_p > 0) {
+                if (! col.isDefined (0)) {
+                    throw TableError ("RowGroupReader: column " + name +
+                                      " has no value in its first row");
+                }
+                shape = col.shape (0);
+            } else {
+                shape = IPosition (1, 0);
+            }
+        }
+        std::shared_ptr<RowGroupColumn> holder;
+        switch (desc.dataType()) {
+#define RGR_CASE(DTYPE, CPPTYPE) \
+        case DTYPE: \
+            holder.reset (new RowGroupColumnT<CPPTYPE> (table, name, DTYPE, \
+                                                        shape, slotRows, \
+                                                        nslot)); \
+            break;
+        RGR_CASE(TpBool, Bool)
+        RGR_CASE(TpChar, Char)
+        RGR_CASE(TpUChar, uChar)
+        RGR_CASE(TpShort, Short)
+        RGR_CASE(TpUShort, uShort)
+        RGR_CASE(TpInt, Int)
+        RGR_CASE(TpUInt, uInt)
+        RGR_CASE(TpInt64, Int64)
+        RGR_CASE(TpFloat, Float)
+        RGR_CASE(TpDouble, Double)
+        RGR_CASE(TpComplex, Complex)
+        RGR_CASE(TpDComplex, DComplex)
+        RGR_CASE(TpString, String)
+#undef RGR_CASE
+        default:
+            throw TableError ("RowGroupReader: column " + name +
+                              " has an unsupported data type");
+        }
+        columns_p.push_back (holder);
+    }
+}
+
+RowGroupReader::~RowGroupReader()
+{
+    if (pending_p.valid()) {
+        pending_p.wait();
+    }
+}
+
+Bool RowGroupReader::next()
+{
+    if (pending_p.valid()) {
+        // The next block was prefetched into the other slot.
+        // get() rethrows an exception raised while reading it.
+        pending_p.get();
+        slot_p = 1 - slot_p;
+    } else if (nextStart_p < nrow_p) {
+        fill (slot_p, nextStart_p);
+    } else {
+        blockStart_p = nrow_p;
+        blockRows_p  = 0;
+        return False;
+    }
+    blockStart_p = nextStart_p;
+    blockRows_p  = rowsAt (nextStart_p);
+    nextStart_p += blockRows_p;
+    if (prefetch_p  &&  nextStart_p < nrow_p) {
+        pending_p = std::async (std::launch::async,
+                                &RowGroupReader::fill, this,
+                                1 - slot_p, nextStart_p);
+    }
+    return True;
+}
+
+void RowGroupReader::fill (uInt slot, rownr_t start)
+{
+    rownr_t nrow = rowsAt (start);
+    for (const auto& col : columns_p) {
+        col->read (slot, start, nrow);
+    }
+}
+
+const RowGroupColumn& RowGroupReader::getColumn (uInt column) const
+{
+    if (column >= columns_p.size()) {
+        throw TableError ("RowGroupReader: column index " +
+                          String::toString (column) + " out of range");
+    }
+    return *columns_p[column];
+}
+
+const String& RowGroupReader::columnName (uInt column) const
+{
+    return getColumn (column).name();
+}
+
+DataType RowGroupReader::dataType (uInt column) const
+{
+    return getColumn (column).dataType();
+}
+
+const IPosition& RowGroupReader::cellShape (uInt column) const
+{
+    return getColumn (column).cellShape();
+}
+
+const ArrayBase& RowGroupReader::columnData (uInt column) const
+{
+    return getColumn (column).data (slot_p);
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,176 @@
+//# RowGroupReader.h: Read blocks of rows from some columns of a table
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_ROWGROUPREADER_H
+#define TABLES_ROWGROUPREADER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/ArrayFwd.h>
+#include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Utilities/DataType.h>
+#include <casacore/tables/Tables/Table.h>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class ArrayBase;
+class RowGroupColumn; //# Only in the .cc file
+
+
+// <summary>
+// RowGroupReader reads some columns of a table in blocks of rows.
+// </summary>
+
+// <use visibility=export>
+
+// <prerequisite>
+//  <li> Table
+//  <li> ScalarColumn and ArrayColumn
+// </prerequisite>
+
+// <synopsis>
+// ROTableRow reads a full TableRecord for every row, which is costly
+// when a pipeline only needs a few columns and processes the table
+// sequentially. RowGroupReader reads a fixed set of columns in blocks
+// of (at most) <src>blockSize</src> rows. Each column of a block is read
+// with a single getColumnRange call into a typed buffer that is
+// allocated once and reused for all blocks.
+//
+// The column buffers have the cell shape with the row axis appended
+// (thus shape [blockRows] for a scalar column). Array columns must have
+// the same cell shape in all rows of a block.
+//
+// If prefetching is enabled, two sets of buffers are kept. While the
+// caller processes the current block, the next one is read on a
+// background thread. Because a Table object is not thread-safe, the
+// table must not be accessed by other means while the reader is in use.
+// An exception thrown while prefetching is rethrown by the next call
+// to <src>next</src>.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//  Vector<String> names(2);
+//  names(0) = "TIME"; names(1) = "UVW";
+//  RowGroupReader reader(table, names, 10000);
+//  while (reader.next()) {
+//    const Array<Double>& time = reader.array<Double>(0);
+//    const Array<Double>& uvw = reader.array<Double>(1);
+//    // ... process reader.blockRows() rows ...
+//  }
+// </srcblock>
+// </example>
+
+class RowGroupReader
+{
+public:
+    // Create a reader for the given columns of the table.
+    // If <src>prefetch</src> is True, the next block is read in the
+    // background while the current one is processed.
+    RowGroupReader (const Table& table, const Vector<String>& columnNames,
+                    rownr_t blockSize, Bool prefetch = True);
+
+    // The destructor waits for a pending prefetch to finish.
+    ~RowGroupReader();
+
+    // Advance to the next block of rows.
+    // It returns False (and makes the current block empty) when all
+    // rows have been read.
+    Bool next();
+
+    // Get the number of columns read.
+    uInt ncolumn() const
+        { return columns_p.size(); }
+
+    // Get the maximum number of rows in a block.
+    rownr_t blockSize() const
+        { return blockSize_p; }
+
+    // Get the first row and the number of rows of the current block.
+    // <group>
+    rownr_t blockStart() const
+        { return blockStart_p; }
+    rownr_t blockRows() const
+        { return blockRows_p; }
+    // </group>
+
+    // Get the name, data type or cell shape of a column.
+    // The cell shape is empty for a scalar column.
+    // <group>
+    const String& columnName (uInt column) const;
+    DataType dataType (uInt column) const;
+    const IPosition& cellShape (uInt column) const;
+    // </group>
+
+    // Get the data of a column in the current block.
+    // The shape is the cell shape with an axis of length blockRows()
+    // appended. The storage of the array is always contiguous.
+    const ArrayBase& columnData (uInt column) const;
+
+    // Get the data of a column as a typed array.
+    // An exception is thrown if the type does not match.
+    template<typename T>
+    const Array<T>& array (uInt column) const
+        { return dynamic_cast<const Array<T>&> (columnData (column)); }
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    RowGroupReader (const RowGroupReader&);
+    RowGroupReader& operator= (const RowGroupReader&);
+    // </group>
+
+    // Get the given column, checking its index.
+    const RowGroupColumn& getColumn (uInt column) const;
+
+    // Read the rows starting at <src>start</src> into the given buffer set.
+    void fill (uInt slot, rownr_t start);
+
+    // Get the number of rows in the block starting at <src>start</src>.
+    rownr_t rowsAt (rownr_t start) const
+        { return std::min (blockSize_p, nrow_p - start); }
+
+
+    std::vector<std::shared_ptr<RowGroupColumn>> columns_p;
+    rownr_t  nrow_p;
+    rownr_t  blockSize_p;
+    Bool     prefetch_p;
+    uInt     slot_p;
+    rownr_t  blockStart_p;
+    rownr_t  blockRows_p;
+    rownr_t  nextStart_p;
+    std::future<void> pending_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
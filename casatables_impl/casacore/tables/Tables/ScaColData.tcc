@@ -99,6 +99,7 @@ Bool ScalarColumnData<T>::isDefined (rownr_t rownr) const
 template<class T>
 void ScalarColumnData<T>::get (rownr_t rownr, void* val) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GET);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr);
     }
@@ -111,6 +112,7 @@ void ScalarColumnData<T>::get (rownr_t rownr, void* val) const
 template<class T>
 void ScalarColumnData<T>::getScalarColumn (ArrayBase& val) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETCOLUMN);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r');
     }
@@ -126,6 +128,7 @@ template<class T>
 void ScalarColumnData<T>::getScalarColumnCells (const RefRows& rownrs,
 						ArrayBase& val) const
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::GETCOLUMN);
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownrs);
     }
@@ -141,6 +144,7 @@ void ScalarColumnData<T>::getScalarColumnCells (const RefRows& rownrs,
 template<class T>
 void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUT);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr);
     }
@@ -153,6 +157,7 @@ void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
 template<class T>
 void ScalarColumnData<T>::putScalarColumn (const ArrayBase& val)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTCOLUMN);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w');
     }
@@ -169,6 +174,7 @@ template<class T>
 void ScalarColumnData<T>::putScalarColumnCells (const RefRows& rownrs,
 						const ArrayBase& val)
 {
+    TableTrace::MetricsTimer timer = metricsTimer (TableTrace::PUTCOLUMN);
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownrs);
     }
@@ -31,9 +31,10 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   StorageOption::StorageOption (StorageOption::Option option, Int blockSize,
-                                Int useODirect)
+                                Int useODirect, Int nShards)
     : itsOption     (option),
       itsBlockSize  (blockSize),
+      itsNShards    (nShards),
       itsUseODirect (useODirect>0),
       itsUseAipsrcODirect (useODirect<0)
   {}
@@ -62,6 +63,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsBlockSize <= 0) {
       itsBlockSize = 4*1024*1024;
     }
+    // Default is no sharding.
+    if (itsNShards <= -2) {
+      AipsrcValue<Int>::find (itsNShards, "table.storage.shards", 1);
+    }
+    if (itsNShards <= 0) {
+      itsNShards = 1;
+    }
     // Default O_DIRECT support is False.
     if (itsUseAipsrcODirect) {
       AipsrcValue<Bool>::find (itsUseODirect, "table.storage.odirect", False);
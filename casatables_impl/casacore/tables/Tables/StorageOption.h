@@ -69,6 +69,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       O_DIRECT option has to be used to let the kernel bypass its filecache
 //       for more predictable I/O behaviour. It's only used for MultiFile and
 //       only if the OS supports O_DIRECT.
+// <li> <src>table.storage.shards</src> gives the number of files the data
+//       blocks of a MultiFile are striped over (default 1).
+//       See <linkto class=MultiFile>MultiFile</linkto> for more info.
 // </ul>
 // </synopsis>
 
@@ -97,7 +100,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // A size value -1 means use the default of 4*1024*1024.
     // <br>useODirect<0 means reading the option from the aipsrc file.
     // It is only set if the OS supports O_DIRECT.
-    StorageOption (Option option=Aipsrc, Int blockSize=-2, Int useODirect=-3);
+    // <br>nShards -2 means reading the number of shards from the aipsrc file.
+    // A value -1 means no sharding.
+    StorageOption (Option option=Aipsrc, Int blockSize=-2, Int useODirect=-3,
+                   Int nShards=-2);
 
     // Fill the option in case Aipsrc or Default was given.
     // It is done as explained in the synopsis.
@@ -127,9 +133,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // It is only set if the OS supports O_DIRECT.
     void setUseODirect (Bool useODirect);
 
+    // Get the number of shards of a MultiFile.
+    uInt nShards() const
+      { return itsNShards; }
+
+    // Set the number of shards of a MultiFile.
+    void setNShards (Int nShards)
+      { itsNShards = nShards; }
+
   private:
     Option itsOption;
     Int    itsBlockSize;
+    Int    itsNShards;
     Bool   itsUseODirect;
     Bool   itsUseAipsrcODirect;
   };
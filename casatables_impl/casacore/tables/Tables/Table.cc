@@ -594,6 +594,16 @@ void Table::relinquishAutoLocks (Bool all)
   PlainTable::tableCache().relinquishAutoLocks (all);
 }
 
+void Table::setCacheBudget (uInt64 nbytes)
+{
+  PlainTable::tableCache().setCacheBudget (nbytes);
+}
+
+uInt64 Table::cacheBudget()
+{
+  return PlainTable::tableCache().cacheBudget();
+}
+
 Vector<String> Table::getLockedTables (FileLocker::LockType lockType,
                                        int lockOption)
 {
@@ -755,8 +765,12 @@ Table Table::sort (const Block<String>& names,
 //# Sort on multiple columns and orders with given functions.
 Table Table::sort (const Block<String>& names,
 		   const Block<CountedPtr<BaseCompare> >& cmpObjs,
-		   const Block<Int>& orders, int option) const
-    { return Table(baseTabPtr_p->sort (names, cmpObjs, orders, option)); }
+		   const Block<Int>& orders, int option,
+		   std::shared_ptr<Vector<rownr_t>> sortIterBoundaries,
+		   std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange) const
+    { return Table(baseTabPtr_p->sort (names, cmpObjs, orders, option,
+                                       sortIterBoundaries,
+                                       sortIterKeyIdxChange)); }
 
 
 //# Select rows based on row numbers.
@@ -860,6 +874,31 @@ Record Table::dataManagerInfo() const
     return baseTabPtr_p->dataManagerInfo();
 }
 
+Record Table::openTiming() const
+{
+    return baseTabPtr_p->openTiming();
+}
+
+Record Table::cacheStatistics() const
+{
+    return baseTabPtr_p->cacheStatistics();
+}
+
+Int64 Table::vacuum()
+{
+    return baseTabPtr_p->vacuum();
+}
+
+Bool Table::writeOpenSnapshot()
+{
+    return baseTabPtr_p->writeOpenSnapshot();
+}
+
+Bool Table::removeOpenSnapshot()
+{
+    return baseTabPtr_p->removeOpenSnapshot();
+}
+
 //# Make the table file name.
 String Table::fileName (const String& tableName)
 {
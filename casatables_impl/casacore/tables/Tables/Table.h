@@ -166,6 +166,7 @@ friend class TableIterator;
 friend class RODataManAccessor;
 friend class TableExprNode;
 friend class TableExprNodeRep;
+friend class TableWatcher;
 
 public:
     // Define the possible options how a table can be opened.
@@ -439,6 +440,21 @@ public:
     // will be unlocked.
     static void relinquishAutoLocks (Bool all = False);
 
+    // Set the total number of bytes the caches of the storage managers of
+    // all tables opened in this process may use (0 means no limit).
+    // The budget is divided over the data managers, each getting at most
+    // what it needs to hold all its data (as known when it was last opened
+    // or flushed); it is divided again when a data manager is opened,
+    // flushed or closed. A data manager applies its share the next time
+    // it accesses its cache, so the table can be used by another thread.
+    // Data managers whose open is deferred take part once they are opened.
+    // Setting the budget to 0 restores the cache sizes the data managers
+    // had before a budget was applied.
+    // <group>
+    static void setCacheBudget (uInt64 nbytes);
+    static uInt64 cacheBudget();
+    // </group>
+
     // Get the names of tables locked in this process.
     // By default all locked tables are given (note that a write lock
     // implies a read lock), but it is possible to select on lock type
@@ -462,6 +478,9 @@ public:
     // unless it is executed due to an exception.
     // <br>If <src>fsync=True</src> the file contents are fsync-ed to disk,
     // thus ensured that the system buffers are actually written to disk.
+    // This is done as a group commit: all data managers write their data
+    // first, after which each data file is fsync-ed once. Only thereafter
+    // the table file is written and fsync-ed.
     // <br>If <src>recursive=True</src> all subtables are flushed too.
     void flush (Bool fsync=False, Bool recursive=False);
 
@@ -594,6 +613,56 @@ public:
     // Data managers may return some additional fields (e.g. BUCKETSIZE).
     Record dataManagerInfo() const;
 
+    // Get the time (in seconds) spent in the parts of opening the table.
+    // For a plain table opened from disk the record contains the fields
+    // <src>lock</src> (acquiring the lock and reading the sync data),
+    // <src>description</src>, <src>columns</src> (constructing the data
+    // managers), <src>datamanagers</src> (opening them, including the ones
+    // opened later in case of a deferred open), <src>info</src> and
+    // <src>total</src> (excluding deferred opens). Field
+    // <src>ndeferred</src> tells how many data managers are not opened yet
+    // and field <src>snapshot</src> if the table was opened using its
+    // snapshot (see writeOpenSnapshot).
+    // The record is empty for other tables.
+    Record openTiming() const;
+
+    // Get the statistics of the caches of the data managers opened so far.
+    // The record contains a subrecord per data manager having a cache
+    // (named after the data manager or its type) with the fields
+    // <src>cachesize</src> (in bytes), <src>accesses</src>, <src>hits</src>,
+    // <src>misses</src>, <src>bytesread</src>, <src>byteswritten</src>,
+    // and <src>evictions</src>. Buckets or tiles initialized in the cache
+    // without being read count as misses.
+    // The record is empty for tables other than plain tables.
+    Record cacheStatistics() const;
+
+    // Regain the file space of data no longer in use, such as the space of
+    // an indirect array in a StandardStMan or IncrementalStMan column that
+    // was replaced by an array with another shape. The table is write
+    // locked while the files are compacted. The data in use are copied to
+    // the end of the file and then to the front, and the new offsets are
+    // stored and fsync-ed after each copy, so the table is still valid if
+    // the process is interrupted (but the file can have grown).
+    // It returns the number of bytes regained.
+    // Nothing is done for tables other than plain tables.
+    Int64 vacuum();
+
+    // Write a snapshot of the table metadata into the table directory
+    // (see class <linkto class=TableSnapshot>TableSnapshot</linkto>).
+    // Thereafter the table is opened from the snapshot, in which case the
+    // keywords of the table and its columns are only read when used.
+    // The snapshot is ignored after the table has been changed by a
+    // process that did not update it, which is done by any process
+    // writing a table having a snapshot.
+    // It returns False (and does nothing) for tables other than plain
+    // tables.
+    Bool writeOpenSnapshot();
+
+    // Remove the snapshot of the table metadata.
+    // It returns False if the table did not have a snapshot or if it is
+    // not a plain table.
+    Bool removeOpenSnapshot();
+
     // Get the table name.
     const String& tableName() const;
 
@@ -848,10 +917,16 @@ public:
     // Provide some special comparisons via CountedPtrs of compare objects.
     // A null CountedPtr means using the standard compare object
     // from class <linkto class="ObjCompare:description">ObjCompare</linkto>.
+    // If <src>sortIterBoundaries</src> and <src>sortIterKeyIdxChange</src>
+    // are given, they are filled with the index (in the sorted order) of
+    // the first row of each group of equal keys and the index of the key
+    // that changes at the end of each group (as TableIterator uses them).
     Table sort (const Block<String>& columnNames,
 		const Block<CountedPtr<BaseCompare> >& compareObjects,
 		const Block<Int>& sortOrders,
-		int = Sort::ParSort) const;
+		int = Sort::ParSort,
+		std::shared_ptr<Vector<rownr_t>> sortIterBoundaries = nullptr,
+		std::shared_ptr<Vector<size_t>> sortIterKeyIdxChange = nullptr) const;
     // </group>
 
     // Get a vector of row numbers in the root table of rows in this table.
@@ -30,12 +30,15 @@
 #include <casacore/tables/Tables/PlainTable.h>
 #include <casacore/tables/Tables/TableLock.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 TableCache::TableCache()
+: cacheBudget_p (0)
 {}
 
 TableCache::~TableCache()
@@ -127,6 +130,66 @@ void TableCache::relinquishAutoLocks (Bool all)
     }
 }
 
+void TableCache::setCacheBudget (uInt64 nbytes)
+{
+    std::lock_guard<std::mutex> sc(itsDemandMutex);
+    if (nbytes == 0  &&  cacheBudget_p != 0) {
+        //# Let the data managers restore their original cache sizes.
+        for (const auto& x : cacheDemands_p) {
+            x.first->unassignCacheBudget();
+        }
+    }
+    cacheBudget_p = nbytes;
+    distributeCacheBudget();
+}
+
+uInt64 TableCache::cacheBudget() const
+{
+    std::lock_guard<std::mutex> sc(itsDemandMutex);
+    return cacheBudget_p;
+}
+
+void TableCache::setCacheDemand (DataManager* dm, uInt64 nbytes)
+{
+    std::lock_guard<std::mutex> sc(itsDemandMutex);
+    uInt64& demand = cacheDemands_p[dm];
+    if (demand != nbytes) {
+        demand = nbytes;
+        distributeCacheBudget();
+    }
+}
+
+void TableCache::removeCacheDemand (DataManager* dm)
+{
+    std::lock_guard<std::mutex> sc(itsDemandMutex);
+    if (cacheDemands_p.erase (dm) > 0) {
+        distributeCacheBudget();
+    }
+}
+
+void TableCache::distributeCacheBudget()
+{
+    if (cacheBudget_p == 0) {
+        return;
+    }
+    //# Serve the smallest demands first, so the budget a data manager
+    //# does not need is divided over the larger ones.
+    std::vector<std::pair<uInt64,DataManager*>> demands;
+    for (const auto& x : cacheDemands_p) {
+        if (x.second > 0) {
+            demands.push_back (std::make_pair (x.second, x.first));
+        }
+    }
+    std::sort (demands.begin(), demands.end());
+    uInt64 left = cacheBudget_p;
+    for (size_t i=0; i<demands.size(); ++i) {
+        uInt64 share = std::min (demands[i].first,
+                                 left / (demands.size() - i));
+        demands[i].second->assignCacheBudget (share);
+        left -= share;
+    }
+}
+
 Vector<String> TableCache::getTableNames() const
 {
     std::lock_guard<std::mutex> sc(itsMutex);
@@ -39,6 +39,7 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward Declarations
+class DataManager;
 class PlainTable;
 class TableLock;
 
@@ -140,6 +141,23 @@ public:
     void flushTable (const String& tableName,
                      Bool fsync, Bool recursive);
 
+    // Set the total number of bytes the caches of the data managers of
+    // the tables in the cache may use (0 means no limit) and distribute it
+    // (see Table::setCacheBudget).
+    void setCacheBudget (uInt64 nbytes);
+
+    // Get the cache budget.
+    uInt64 cacheBudget() const;
+
+    // Set or remove the number of bytes the cache of a data manager needs.
+    // Only the data manager itself can do it (see
+    // DataManager::publishCacheDemand), because it can be used by another
+    // thread. A set cache budget is distributed again.
+    // <group>
+    void setCacheDemand (DataManager* dm, uInt64 nbytes);
+    void removeCacheDemand (DataManager* dm);
+    // </group>
+
     // Look in the cache if the table is already open.
     // If so, check if table option matches.
     // If needed reopen the table for read/write and merge the lock options.
@@ -155,12 +173,25 @@ private:
     // Get the table without doing a mutex lock (for operator()).
     PlainTable* getTable (const String& tableName) const;
 
+    // Distribute the cache budget (if set) over the data managers of
+    // all tables without doing a lock of <src>itsDemandMutex</src>.
+    // Only the published demands are used and the sizes are applied by
+    // the data managers themselves, so data managers of tables used by
+    // other threads are not accessed.
+    void distributeCacheBudget();
+
     //# void* iso. PlainTable* is used in the map declaration
     //# to reduce the number of template instantiations.
     //# The .cc file will use (fully safe) casts.
     std::map<String,void*> tableMap_p;
+    uInt64 cacheBudget_p;
+    std::map<DataManager*,uInt64> cacheDemands_p;
     //# A mutex to synchronize access to the cache.
     mutable std::mutex itsMutex;
+    //# A separate mutex for the cache budget and demands, because data
+    //# managers publish their demand while flushing, which can be done
+    //# while itsMutex is locked (e.g. by relinquishAutoLocks).
+    mutable std::mutex itsDemandMutex;
 };
 
 
@@ -102,6 +102,17 @@ TableColumn::~TableColumn()
 {}
 
 
+std::vector<IPosition> TableColumn::shapes (rownr_t startRow,
+                                            rownr_t nrow) const
+{
+    if (nrow > 0) {
+        checkRowNumber (startRow + nrow - 1);
+    }
+    std::vector<IPosition> result;
+    baseColPtr_p->shapes (startRow, nrow, result);
+    return result;
+}
+
 void TableColumn::throwIfNull() const
 {
     if (isNull()) {
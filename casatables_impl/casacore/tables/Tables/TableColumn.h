@@ -35,6 +35,7 @@
 #include <casacore/tables/Tables/BaseTable.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -235,6 +236,13 @@ public:
     IPosition tileShape (rownr_t rownr) const
 	{ TABLECOLUMNCHECKROW(rownr); return baseColPtr_p->tileShape (rownr); }
 
+    // Get the shapes of the arrays in <src>nrow</src> rows starting at
+    // <src>startRow</src>. A cell without an array gets an empty shape.
+    // It is much faster than calling <src>shape</src> for each row for
+    // the indirect arrays of a variable-shape column, because the shapes
+    // are read in order of their offsets in the file.
+    std::vector<IPosition> shapes (rownr_t startRow, rownr_t nrow) const;
+
     // Get the value of a scalar in the given row.
     // Data type promotion is possible.
     // These functions only work for the standard data types.
@@ -32,6 +32,8 @@
 #include <casacore/tables/Tables/TableRow.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/TableLocker.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/tables/DataMan/DataManager.h>
@@ -39,6 +41,8 @@
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Utilities/LinearSearch.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/OS/Path.h>
 #include <casacore/casa/BasicSL/String.h>
 
@@ -87,6 +91,86 @@ Table TableCopy::makeEmptyMemoryTable (const String& newName,
   return Table(newtab, Table::Memory, (noRows ? 0 : tab.nrow()));
 }
 
+// The number of values copied at a time by loadMemoryTable.
+static const rownr_t loadBlockValues = 1024*1024;
+
+// Copy a scalar or fixed shaped array column in blocks of rows.
+template<typename T>
+static void loadColumn (Table& out, const Table& in, const String& name)
+{
+  rownr_t nrow = in.nrow();
+  Slicer rows;
+  if (in.tableDesc()[name].isScalar()) {
+    ScalarColumn<T> incol(in, name);
+    ScalarColumn<T> outcol(out, name);
+    Vector<T> buf;
+    for (rownr_t start=0; start<nrow; start+=loadBlockValues) {
+      rows = Slicer (IPosition(1, start),
+                     IPosition(1, std::min(loadBlockValues, nrow - start)));
+      incol.getColumnRange (rows, buf, True);
+      outcol.putColumnRange (rows, buf);
+    }
+  } else {
+    ArrayColumn<T> incol(in, name);
+    ArrayColumn<T> outcol(out, name);
+    rownr_t nelem = std::max (incol.columnDesc().shape().product(), Int64(1));
+    rownr_t blockRows = std::max (loadBlockValues / nelem, rownr_t(1));
+    Array<T> buf;
+    for (rownr_t start=0; start<nrow; start+=blockRows) {
+      rows = Slicer (IPosition(1, start),
+                     IPosition(1, std::min(blockRows, nrow - start)));
+      incol.getColumnRange (rows, buf, True);
+      outcol.putColumnRange (rows, buf);
+    }
+  }
+}
+
+Table TableCopy::loadMemoryTable (const String& newName,
+                                  const Table& tab,
+                                  const Vector<String>& columnNames)
+{
+  Table in (tab);
+  if (! columnNames.empty()) {
+    Block<String> names (columnNames.size());
+    for (uInt i=0; i<columnNames.size(); ++i) {
+      names[i] = columnNames(i);
+    }
+    in = tab.project (names);
+  }
+  Table out = makeEmptyMemoryTable (newName, in);
+  Vector<String> names = in.tableDesc().columnNames();
+  for (uInt i=0; i<names.size(); ++i) {
+    const String& name = names(i);
+    if (! out.isColumnStored (name)) {
+      continue;
+    }
+    const ColumnDesc& desc = in.tableDesc()[name];
+    if (desc.isArray()  &&  ! desc.isFixedShape()) {
+      copyColumnData (in, name, out, name);
+      continue;
+    }
+    switch (desc.dataType()) {
+    case TpBool:     loadColumn<Bool>     (out, in, name); break;
+    case TpChar:     loadColumn<Char>     (out, in, name); break;
+    case TpUChar:    loadColumn<uChar>    (out, in, name); break;
+    case TpShort:    loadColumn<Short>    (out, in, name); break;
+    case TpUShort:   loadColumn<uShort>   (out, in, name); break;
+    case TpInt:      loadColumn<Int>      (out, in, name); break;
+    case TpUInt:     loadColumn<uInt>     (out, in, name); break;
+    case TpInt64:    loadColumn<Int64>    (out, in, name); break;
+    case TpFloat:    loadColumn<Float>    (out, in, name); break;
+    case TpDouble:   loadColumn<Double>   (out, in, name); break;
+    case TpComplex:  loadColumn<Complex>  (out, in, name); break;
+    case TpDComplex: loadColumn<DComplex> (out, in, name); break;
+    case TpString:   loadColumn<String>   (out, in, name); break;
+    default:
+      copyColumnData (in, name, out, name);
+    }
+  }
+  copyInfo (out, in);
+  return out;
+}
+
 void TableCopy::copyRows (Table& out, const Table& in, rownr_t startout,
 			  rownr_t startin, rownr_t nrrow, Bool flush)
 {
@@ -63,6 +63,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       be replaced by TiledShapeStMan.
 //       By default the new table contains the same number of rows as the
 //       existing table.
+//  <li> <src>loadMemoryTable</src> copies (some columns of) a table into
+//       a new memory table. The data are copied column by column in
+//       blocks of rows, which is much faster than copying row by row.
 //  <li> <src>copyRows</src> copies the data of one to another table.
 //       It is possible to specify where to start in the input and output.
 //  <li> <src>CopyInfo</src> copies the table info data.
@@ -106,6 +109,19 @@ public:
 				     const Table& tab,
 				     Bool noRows = False);
 
+  // Make a memory table holding a copy of the given columns of the input
+  // table. All columns are copied if <src>columnNames</src> is empty.
+  // The table info is copied as well, but subtables are not; their
+  // keywords keep referring to the subtables of the input table.
+  // <br>The stored columns are copied in blocks of rows using
+  // getColumnRange and putColumnRange. For the contiguous storage of a
+  // memory table, each block of a scalar or fixed shaped column is put
+  // with a single copy. Other columns are copied row by row.
+  static Table loadMemoryTable (const String& newName,
+                                const Table& tab,
+                                const Vector<String>& columnNames
+                                                    = Vector<String>());
+
   // Copy rows from the input to the output.
   // By default all rows will be copied starting at row 0 of the output.
   // Rows will be added to the output table as needed.
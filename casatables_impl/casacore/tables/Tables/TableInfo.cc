@@ -58,6 +58,17 @@ TableInfo::TableInfo (const String& fileName)
     }
 
     ifstream os(file.path().absoluteName().chars(), ios::in);
+    read (os);
+}
+
+TableInfo::TableInfo (istream& is)
+: writeIt_p (True)
+{
+    read (is);
+}
+
+void TableInfo::read (istream& os)
+{
     char buf[1025];
     int  len;
     if (! os.getline (buf, 1024)) {              // Type = string
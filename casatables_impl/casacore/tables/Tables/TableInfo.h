@@ -31,6 +31,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/iosfwd.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -176,6 +177,10 @@ public:
     // initialized to a blank string.
     explicit TableInfo (const String& fileName);
 
+    // Create the object reading it from a stream holding the contents
+    // of a table info file.
+    explicit TableInfo (std::istream& is);
+
     // Create a TableInfo object of one of the predefined types. 
     // This is a centralised way of setting the Table type only. 
     TableInfo (Type which);
@@ -218,6 +223,9 @@ public:
     void flush (const String& fileName);
 
 private:
+    // Read the contents of a table info file.
+    void read (std::istream& is);
+
     String type_p;
     String subType_p;
     String readme_p;
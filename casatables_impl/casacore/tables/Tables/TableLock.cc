@@ -39,7 +39,8 @@ TableLock::TableLock (LockOption option)
   itsMaxWait           (0),
   itsInterval          (5),
   itsIsDefaultLocking  (False),
-  itsIsDefaultInterval (True)
+  itsIsDefaultInterval (True),
+  itsSharedMemory      (False)
 {
   init();
 }
@@ -51,7 +52,8 @@ TableLock::TableLock (LockOption option, double inspectionInterval,
   itsMaxWait           (maxWait),
   itsInterval          (inspectionInterval),
   itsIsDefaultLocking  (False),
-  itsIsDefaultInterval (False)
+  itsIsDefaultInterval (False),
+  itsSharedMemory      (False)
 {
   init();
 }
@@ -62,7 +64,8 @@ TableLock::TableLock (const TableLock& that)
   itsMaxWait           (that.itsMaxWait),
   itsInterval          (that.itsInterval),
   itsIsDefaultLocking  (that.itsIsDefaultLocking),
-  itsIsDefaultInterval (that.itsIsDefaultInterval)
+  itsIsDefaultInterval (that.itsIsDefaultInterval),
+  itsSharedMemory      (that.itsSharedMemory)
 {}
 
 TableLock& TableLock::operator= (const TableLock& that)
@@ -74,6 +77,7 @@ TableLock& TableLock::operator= (const TableLock& that)
     itsInterval          = that.itsInterval;
     itsIsDefaultLocking  = that.itsIsDefaultLocking;
     itsIsDefaultInterval = that.itsIsDefaultInterval;
+    itsSharedMemory      = that.itsSharedMemory;
   }
   return *this;
 }
@@ -104,6 +108,7 @@ void TableLock::init()
   if (itsOption == NoLocking) {
     itsReadLocking = False;
   }
+  AipsrcValue<Bool>::find (itsSharedMemory, "table.lock.sharedmemory", False);
 }
 
 
@@ -126,6 +131,9 @@ void TableLock::merge (const TableLock& that)
       }
     }
   }
+  if (that.itsSharedMemory) {
+    itsSharedMemory = True;
+  }
 }
 
 Bool TableLock::lockingDisabled()
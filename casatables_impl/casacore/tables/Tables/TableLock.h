@@ -59,6 +59,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //
 // It is possible to disable locking by building casacore with -DAIPS_TABLE_NOLOCKING
 // or by setting the aipsrc variable table.nolocking=true.
+// <p>
+// Optionally processes on the same host can use a shared memory segment
+// to tell each other that they need the lock (see class
+// <linkto class=SharedMemoryLock>SharedMemoryLock</linkto>).
+// It makes lock inspection in AutoLocking mode cheap and wakes a waiting
+// process as soon as the lock is released. It can be switched on
+// with <src>setSharedMemory</src> or by setting the aipsrc variable
+// table.lock.sharedmemory=true.
 
 // <motivation> 
 // Encapsulate Table locking info.
@@ -145,6 +153,7 @@ public:
     // PermanentLocking.
     // When an interval was defaulted, it is not taken into account.
     // An option DefaultLocking is not taken into account.
+    // A shared memory segment is used if one of them uses it.
     void merge (const TableLock& that);
 
     // Get the locking option.
@@ -162,6 +171,13 @@ public:
     // Get the maximum wait period in AutoLocking mode.
     uInt maxWait() const;
 
+    // Set or get if a shared memory segment is used for processes on the
+    // same host. It is ignored for tables on a network file system.
+    // <group>
+    void setSharedMemory (Bool sharedMemory);
+    Bool sharedMemory() const;
+    // </group>
+
     // Is table locking disabled (because AIPS_TABLE_NOLOCKING or table.nolocking is set)?
     static Bool lockingDisabled();
 
@@ -173,6 +189,7 @@ private:
     double      itsInterval;
     Bool        itsIsDefaultLocking;
     Bool        itsIsDefaultInterval;
+    Bool        itsSharedMemory;
 
 
     // Set itsOption and itsReadLocking when needed.
@@ -207,6 +224,16 @@ inline uInt TableLock::maxWait() const
     return itsMaxWait;
 }
 
+inline void TableLock::setSharedMemory (Bool sharedMemory)
+{
+    itsSharedMemory = sharedMemory;
+}
+
+inline Bool TableLock::sharedMemory() const
+{
+    return itsSharedMemory;
+}
+
 
 
 } //# NAMESPACE CASACORE - END
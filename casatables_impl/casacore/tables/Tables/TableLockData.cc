@@ -58,7 +58,7 @@ void TableLockData::makeLock (const String& name, Bool create,
     if (itsLock == 0) {
 	itsLock = new LockFile (name + "/table.lock", interval(), create,
 				True, False, locknr, isPermanent(),
-                                option() == NoLocking);
+                                option() == NoLocking, sharedMemory());
     }
     //# Acquire a lock when permanent locking is in use.
     if (isPermanent()) {
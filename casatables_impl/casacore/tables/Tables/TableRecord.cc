@@ -27,17 +27,29 @@
 
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/TableKeyword.h>
+#include <casacore/tables/Tables/TableAttr.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Containers/ValueHolder.h>
 #include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+struct TableRecord::DeferredRead
+{
+    std::shared_ptr<const void> owner;
+    const uChar*   data;
+    uInt64         length;
+    TableAttr      attr;
+    std::once_flag once;
+};
+
 TableRecord::TableRecord()
 : RecordInterface (),
   rep_p    (new TableRecordRep),
@@ -74,7 +86,7 @@ TableRecord::TableRecord (TableRecordRep* parent, RecordType type)
 {}
 
 TableRecord::TableRecord (const TableRecord& other)
-: RecordInterface (other),
+: RecordInterface (deferredRead (other)),
   rep_p    (other.rep_p),
   parent_p (other.parent_p)
 {}
@@ -86,6 +98,8 @@ TableRecord::TableRecord (const RecordInterface& other)
   // If the RecordInterface is a TableRecord, assign it immediately.
   const TableRecord* trecp = dynamic_cast<const TableRecord*>(&other);
   if (trecp != 0) {
+    // The record type is only known after a deferred read.
+    recordType() = deferredRead(*trecp).isFixed()  ?  Fixed : Variable;
     rep_p = trecp->rep_p;
   } else {
     rep_p.set (new TableRecordRep (other.description()));
@@ -120,6 +134,8 @@ TableRecord& TableRecord::operator= (const TableRecord& other)
     if (this != &other) {
 	if (! isFixed()  ||  nfields() == 0) {
 	    notify (RecordNotice (RecordNotice::DETACH, 0));
+	    deferredRead (other);
+	    deferred_p.reset();
 	    rep_p = other.rep_p;
 	}else{
 	    AlwaysAssert (conform (other), AipsError);
@@ -153,7 +169,7 @@ void TableRecord::assign (const RecordInterface& that)
 void TableRecord::print (ostream& os, Int maxNrValues,
 			 const String& indent) const
 {
-    rep_p.ref().print (os, maxNrValues, indent);
+    ref().print (os, maxNrValues, indent);
 }
 
 
@@ -164,6 +180,10 @@ void TableRecord::makeUnique()
 
 TableRecordRep& TableRecord::rwRef()
 {
+    if (deferred_p) {
+        readDeferred();
+        deferred_p.reset();
+    }
     const TableRecordRep& oldRep = rep_p.ref();
     TableRecordRep& newRep = rep_p.rwRef();
     if (&oldRep != &newRep) {
@@ -218,6 +238,14 @@ Int TableRecord::fieldNumber (const String& fieldName) const
 {
     return description().fieldNumber (fieldName);
 }
+Int TableRecord::fieldNumber (const String& fieldName, Int hint) const
+{
+    return description().fieldNumber (fieldName, hint);
+}
+uInt64 TableRecord::descriptionId() const
+{
+    return description().layoutId();
+}
 DataType TableRecord::type (Int whichField) const
 {
     return description().type (whichField);
@@ -398,6 +426,8 @@ void TableRecord::putRecord (AipsIO& os, const TableAttr& parentAttr) const
 }
 void TableRecord::getRecord (AipsIO& os, const TableAttr& parentAttr)
 {
+    // Data not read yet are replaced, so they are not read at all.
+    dropDeferred();
     // Get is only possible when the Record is empty or when
     // the Record is non-fixed.
     AlwaysAssert ((! isFixed()  ||  nfields() == 0), AipsError);
@@ -410,6 +440,47 @@ void TableRecord::getRecord (AipsIO& os, const TableAttr& parentAttr)
     recordType() = (RecordInterface::RecordType)type;
 }
 
+void TableRecord::getRecordDeferred (const std::shared_ptr<const void>& owner,
+                                     const uChar* data, uInt64 length,
+                                     const TableAttr& parentAttr)
+{
+    dropDeferred();
+    AlwaysAssert ((! isFixed()  ||  nfields() == 0), AipsError);
+    notify (RecordNotice (RecordNotice::DETACH, 0));
+    rep_p.set (new TableRecordRep);
+    std::shared_ptr<DeferredRead> deferred (new DeferredRead);
+    deferred->owner  = owner;
+    deferred->data   = data;
+    deferred->length = length;
+    deferred->attr   = parentAttr;
+    deferred_p = deferred;
+}
+
+void TableRecord::dropDeferred()
+{
+    if (deferred_p) {
+        deferred_p.reset();
+        rep_p.set (new TableRecordRep);
+    }
+}
+
+void TableRecord::readDeferred() const
+{
+    DeferredRead& deferred = *deferred_p;
+    std::call_once (deferred.once, [this, &deferred]() {
+        // Read into a separate record, because this one still tells
+        // that it has to be read.
+        TableRecord rec;
+        MemoryIO memio (deferred.data, deferred.length);
+        AipsIO aio (&memio);
+        rec.getRecord (aio, deferred.attr);
+        TableRecord& self = const_cast<TableRecord&>(*this);
+        self.rep_p = rec.rep_p;
+        self.recordType() = rec.recordType();
+        deferred.owner.reset();
+    });
+}
+
 
 void TableRecord::setTableAttr (const TableRecord& other,
 				const TableAttr& defaultAttr)
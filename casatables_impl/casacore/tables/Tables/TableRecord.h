@@ -37,6 +37,7 @@
 #include <casacore/casa/Containers/RecordDesc.h>
 #include <casacore/casa/Utilities/COWPtr.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -318,6 +319,12 @@ public:
     // -1 is returned if the field name is unknown.
     virtual Int fieldNumber (const String& fieldName) const;
 
+    // Get the field number from the field name, testing field hint first.
+    virtual Int fieldNumber (const String& fieldName, Int hint) const;
+
+    // Get the layout id of the description.
+    virtual uInt64 descriptionId() const;
+
     // Get the data type of this field.
     virtual DataType type (Int whichField) const;
 
@@ -423,6 +430,17 @@ public:
     // not been read.
     void getRecord (AipsIO& os, const TableAttr&);
 
+    // Read the record as written by putRecord from the given
+    // <src>length</src> bytes, but only when it is accessed for the first
+    // time. Until then the bytes must stay valid, which is ensured by
+    // keeping <src>owner</src>.
+    // It is used by TableSnapshot to open a table without reading its
+    // keywords. Reading a const record can be done by multiple threads.
+    // The record type is not known before the record is read.
+    void getRecordDeferred (const std::shared_ptr<const void>& owner,
+                            const uChar* data, uInt64 length,
+                            const TableAttr&);
+
     // Put the data of a record.
     // This is used to write a subrecord, whose description has
     // already been written.
@@ -503,16 +521,34 @@ private:
     // Set the recordtype of this record and all its subrecords (recursively).
     void setRecordType (RecordType type);
 
+    // Read the record whose reading was deferred (if not read yet).
+    void readDeferred() const;
+
+    // Forget about a deferred read and make the record empty. It is used
+    // before reading new contents, so old data not read yet are never read.
+    void dropDeferred();
+
+    // Return the record after reading it if it was deferred.
+    static const TableRecord& deferredRead (const TableRecord& rec)
+      { rec.ref(); return rec; }
+
     // The TableRecord representation.
     COWPtr<TableRecordRep> rep_p;
     // The parent TableRecord.
     TableRecordRep* parent_p;
+    // The state of a deferred read (see getRecordDeferred).
+    // It is kept after the read, so readers need no lock to test it.
+    struct DeferredRead;
+    std::shared_ptr<DeferredRead> deferred_p;
 };
 
 
 
 inline const TableRecordRep& TableRecord::ref() const
 {
+    if (deferred_p) {
+        readDeferred();
+    }
     return rep_p.ref();
 }
 inline const RecordDesc& TableRecord::description() const
@@ -56,10 +56,11 @@ ROTableRow::ROTableRow (const Table& table, Bool storedColumnsOnly)
 }
 
 ROTableRow::ROTableRow (const Table& table, const Vector<String>& columnNames,
-			Bool exclude)
+			Bool exclude, Bool lazy)
 : itsRecord (0)
 {
     init();
+    itsLazy = lazy;
     create (table, columnNames, exclude, False);
 }
 
@@ -74,6 +75,7 @@ void ROTableRow::init()
 {
     itsLastRow = -1;
     itsReread = True;
+    itsLazy = False;
 }
 
 ROTableRow::~ROTableRow()
@@ -95,6 +97,7 @@ void ROTableRow::copy (const ROTableRow& that)
 	itsNrused  = that.itsNrused;
         itsLastRow = that.itsLastRow;
         itsReread  = that.itsReread;
+	itsLazy    = that.itsLazy;
 	if (that.itsRecord != 0) {
 	    makeObjects (that.itsRecord->description());
 	}
@@ -327,6 +330,8 @@ void ROTableRow::makeObjects (const RecordDesc& description)
     itsFields.set (static_cast<void*>(0));
     itsDefined.resize (itsNrused, False, False);
     itsDefined.set (True);
+    itsFieldRead.resize (itsNrused, False, False);
+    itsFieldRead.set (False);
     // Create the correct column object for each field.
     // (if not writing, an RO version is sufficient).
     // Also create a RecordFieldPtr object for each column.
@@ -442,195 +447,12 @@ const TableRecord& ROTableRow::get (rownr_t rownr, Bool alwaysRead) const
     if (Int64(rownr) == itsLastRow  &&  !itsReread  &&  !alwaysRead) {
 	return *itsRecord;
     }
-    const RecordDesc& desc = itsRecord->description();
-    Int ndim = 0;
-    uInt nrfield = desc.nfields();
-    for (uInt i=0; i<nrfield; i++) {
-	//# First determine if an array value is defined.
-	//# If not, get its default dimensionality.
-	Bool isDefined = True;
-	if (! (*(TableColumn*)(itsTabCols[i])).isDefined (rownr)) {
-	    isDefined = False;
-	    ndim = (*(TableColumn*)(itsTabCols[i])).columnDesc().ndim();
-	    if (ndim < 0) {
-		ndim = 0;
-	    }
-	}
-	itsDefined[i] = isDefined;
-	//# Now get the value; if undefined, create zero-length array
-	//# with the correct dimensionality.
-	switch (desc.type(i)) {
-	case TpBool:
-	    (*(const ScalarColumn<Bool>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<Bool>*) itsFields[i]));
-	    break;
-	case TpArrayBool:
-	    if (isDefined) {
-		(*(const ArrayColumn<Bool>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<Bool> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<Bool> >*)(itsFields[i])).define (
-		                         Array<Bool> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpUChar:
-	    (*(const ScalarColumn<uChar>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<uChar>*) itsFields[i]));
-	    break;
-	case TpArrayUChar:
-	    if (isDefined) {
-		(*(const ArrayColumn<uChar>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<uChar> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<uChar> >*)(itsFields[i])).define (
-		                         Array<uChar> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpShort:
-	    (*(const ScalarColumn<Short>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<Short>*) itsFields[i]));
-	    break;
-	case TpArrayShort:
-	    if (isDefined) {
-		(*(const ArrayColumn<Short>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<Short> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<Short> >*)(itsFields[i])).define (
-		                         Array<Short> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpInt:
-	    (*(const ScalarColumn<Int>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<Int>*) itsFields[i]));
-	    break;
-	case TpArrayInt:
-	    if (isDefined) {
-		(*(const ArrayColumn<Int>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<Int> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<Int> >*)(itsFields[i])).define (
-		                         Array<Int> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpUInt:
-	    (*(const ScalarColumn<uInt>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<uInt>*) itsFields[i]));
-	    break;
-	case TpArrayUInt:
-	    if (isDefined) {
-		(*(const ArrayColumn<uInt>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<uInt> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<uInt> >*)(itsFields[i])).define (
-		                         Array<uInt> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpInt64:
-	    (*(const ScalarColumn<Int64>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<Int64>*) itsFields[i]));
-	    break;
-	case TpArrayInt64:
-	    if (isDefined) {
-		(*(const ArrayColumn<Int64>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<Int64> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<Int64> >*)(itsFields[i])).define (
-		                         Array<Int64> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpFloat:
-	    (*(const ScalarColumn<float>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<float>*) itsFields[i]));
-	    break;
-	case TpArrayFloat:
-	    if (isDefined) {
-		(*(const ArrayColumn<float>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<float> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<float> >*)(itsFields[i])).define (
-		                         Array<float> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpDouble:
-	    (*(const ScalarColumn<double>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<double>*) itsFields[i]));
-	    break;
-	case TpArrayDouble:
-	    if (isDefined) {
-		(*(const ArrayColumn<double>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<double> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<double> >*)(itsFields[i])).define (
-		                         Array<double> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpComplex:
-	    (*(const ScalarColumn<Complex>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<Complex>*) itsFields[i]));
-	    break;
-	case TpArrayComplex:
-	    if (isDefined) {
-		(*(const ArrayColumn<Complex>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<Complex> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<Complex> >*)(itsFields[i])).define (
-		                         Array<Complex> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpDComplex:
-	    (*(const ScalarColumn<DComplex>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<DComplex>*) itsFields[i]));
-	    break;
-	case TpArrayDComplex:
-	    if (isDefined) {
-		(*(const ArrayColumn<DComplex>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<DComplex> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<DComplex> >*)(itsFields[i])).define (
-		                         Array<DComplex> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpString:
-	    (*(const ScalarColumn<String>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<String>*) itsFields[i]));
-	    break;
-	case TpArrayString:
-	    if (isDefined) {
-		(*(const ArrayColumn<String>*)(itsColumns[i])).get (
-		       rownr,
-		       *(*(RecordFieldPtr<Array<String> >*) itsFields[i]),
-		       True);
-	    }else{
-		(*(RecordFieldPtr<Array<String> >*)(itsFields[i])).define (
-		                         Array<String> (IPosition(ndim, 0)));
-	    }
-	    break;
-	case TpRecord:
-	    (*(const ScalarColumn<TableRecord>*)(itsColumns[i])).get (
-		       rownr, *(*(RecordFieldPtr<TableRecord>*) itsFields[i]));
-	    break;
-	default:
-	    throw (TableError ("TableRow: unknown data type"));
+    if (itsLazy) {
+	//# Only remember the row; the fields are read when accessed.
+	itsFieldRead.set (False);
+    } else {
+	for (uInt i=0; i<itsNrused; i++) {
+	    readField (i, rownr);
 	}
     }
     itsLastRow = rownr;
@@ -638,6 +460,232 @@ const TableRecord& ROTableRow::get (rownr_t rownr, Bool alwaysRead) const
     return *itsRecord;
 }
 
+const TableRecord& ROTableRow::getField (uInt whichField) const
+{
+    if (whichField >= itsNrused) {
+	throw (TableError ("TableRow::getField: field number " +
+			   String::toString (whichField) + " out of range"));
+    }
+    if (itsLazy  &&  itsLastRow >= 0  &&  !itsFieldRead[whichField]) {
+	readField (whichField, itsLastRow);
+	itsFieldRead[whichField] = True;
+    }
+    return *itsRecord;
+}
+
+const TableRecord& ROTableRow::getField (const String& name) const
+{
+    Int whichField = itsRecord->fieldNumber (name);
+    if (whichField < 0) {
+	throw (TableError ("TableRow::getField: column " + name +
+			   " is not part of the row"));
+    }
+    return getField (uInt(whichField));
+}
+
+void ROTableRow::readPending() const
+{
+    if (itsLastRow >= 0) {
+	for (uInt i=0; i<itsNrused; i++) {
+	    if (!itsFieldRead[i]) {
+		readField (i, itsLastRow);
+		itsFieldRead[i] = True;
+	    }
+	}
+    }
+}
+
+void ROTableRow::readField (uInt whichField, rownr_t rownr) const
+{
+    //# First determine if an array value is defined.
+    //# If not, get its default dimensionality.
+    Int ndim = 0;
+    Bool isDefined = True;
+    if (! (*(TableColumn*)(itsTabCols[whichField])).isDefined (rownr)) {
+	isDefined = False;
+	ndim = (*(TableColumn*)(itsTabCols[whichField])).columnDesc().ndim();
+	if (ndim < 0) {
+	    ndim = 0;
+	}
+    }
+    itsDefined[whichField] = isDefined;
+    //# Now get the value; if undefined, create zero-length array
+    //# with the correct dimensionality.
+    switch (itsRecord->description().type(whichField)) {
+    case TpBool:
+	(*(const ScalarColumn<Bool>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<Bool>*) itsFields[whichField]));
+	break;
+    case TpArrayBool:
+	if (isDefined) {
+	    (*(const ArrayColumn<Bool>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<Bool> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<Bool> >*)(itsFields[whichField])).define (
+				     Array<Bool> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpUChar:
+	(*(const ScalarColumn<uChar>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<uChar>*) itsFields[whichField]));
+	break;
+    case TpArrayUChar:
+	if (isDefined) {
+	    (*(const ArrayColumn<uChar>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<uChar> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<uChar> >*)(itsFields[whichField])).define (
+				     Array<uChar> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpShort:
+	(*(const ScalarColumn<Short>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<Short>*) itsFields[whichField]));
+	break;
+    case TpArrayShort:
+	if (isDefined) {
+	    (*(const ArrayColumn<Short>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<Short> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<Short> >*)(itsFields[whichField])).define (
+				     Array<Short> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpInt:
+	(*(const ScalarColumn<Int>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<Int>*) itsFields[whichField]));
+	break;
+    case TpArrayInt:
+	if (isDefined) {
+	    (*(const ArrayColumn<Int>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<Int> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<Int> >*)(itsFields[whichField])).define (
+				     Array<Int> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpUInt:
+	(*(const ScalarColumn<uInt>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<uInt>*) itsFields[whichField]));
+	break;
+    case TpArrayUInt:
+	if (isDefined) {
+	    (*(const ArrayColumn<uInt>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<uInt> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<uInt> >*)(itsFields[whichField])).define (
+				     Array<uInt> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpInt64:
+	(*(const ScalarColumn<Int64>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<Int64>*) itsFields[whichField]));
+	break;
+    case TpArrayInt64:
+	if (isDefined) {
+	    (*(const ArrayColumn<Int64>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<Int64> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<Int64> >*)(itsFields[whichField])).define (
+				     Array<Int64> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpFloat:
+	(*(const ScalarColumn<float>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<float>*) itsFields[whichField]));
+	break;
+    case TpArrayFloat:
+	if (isDefined) {
+	    (*(const ArrayColumn<float>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<float> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<float> >*)(itsFields[whichField])).define (
+				     Array<float> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpDouble:
+	(*(const ScalarColumn<double>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<double>*) itsFields[whichField]));
+	break;
+    case TpArrayDouble:
+	if (isDefined) {
+	    (*(const ArrayColumn<double>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<double> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<double> >*)(itsFields[whichField])).define (
+				     Array<double> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpComplex:
+	(*(const ScalarColumn<Complex>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<Complex>*) itsFields[whichField]));
+	break;
+    case TpArrayComplex:
+	if (isDefined) {
+	    (*(const ArrayColumn<Complex>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<Complex> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<Complex> >*)(itsFields[whichField])).define (
+				     Array<Complex> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpDComplex:
+	(*(const ScalarColumn<DComplex>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<DComplex>*) itsFields[whichField]));
+	break;
+    case TpArrayDComplex:
+	if (isDefined) {
+	    (*(const ArrayColumn<DComplex>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<DComplex> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<DComplex> >*)(itsFields[whichField])).define (
+				     Array<DComplex> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpString:
+	(*(const ScalarColumn<String>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<String>*) itsFields[whichField]));
+	break;
+    case TpArrayString:
+	if (isDefined) {
+	    (*(const ArrayColumn<String>*)(itsColumns[whichField])).get (
+		   rownr,
+		   *(*(RecordFieldPtr<Array<String> >*) itsFields[whichField]),
+		   True);
+	}else{
+	    (*(RecordFieldPtr<Array<String> >*)(itsFields[whichField])).define (
+				     Array<String> (IPosition(ndim, 0)));
+	}
+	break;
+    case TpRecord:
+	(*(const ScalarColumn<TableRecord>*)(itsColumns[whichField])).get (
+		   rownr, *(*(RecordFieldPtr<TableRecord>*) itsFields[whichField]));
+	break;
+    default:
+	throw (TableError ("TableRow: unknown data type"));
+    }
+}
+
 // The values (might) have changed, which is not reflected in the
 // internal record. Be sure to reread when the same row is asked for.
 void ROTableRow::setReread (rownr_t rownr)
@@ -86,6 +86,11 @@ class TableColumn;
 // <p>
 // It is possible to have multiple TableRow objects for the same table.
 // They can contain different columns or they can share columns.
+// <p>
+// A TableRow object can be constructed in lazy mode. Then a get call does
+// not read any value; a field is read on its first access with
+// <src>getField</src>. This is useful if only a few fields of a row are
+// needed, which is often only known after looking at some other fields.
 // 
 // <p>
 // On construction an internal <linkto class=TableRecord>TableRecord</linkto>
@@ -170,8 +175,13 @@ public:
     // <br>
     // When exclude=True, all columns except the given columns are taken.
     // In that case an unknown name does not result in an exception.
+    // <br>When lazy=True, <src>get</src> only sets the row number.
+    // A field is read when it is accessed with <src>getField</src>;
+    // <src>record</src> and <src>getDefined</src> read all fields that
+    // have not been read yet. Thus fields that are never accessed, such as
+    // large data arrays, are not read at all.
     ROTableRow (const Table& table, const Vector<String>& columnNames,
-		Bool exclude = False);
+		Bool exclude = False, Bool lazy = False);
 
     // Copy constructor (copy semantics).
     ROTableRow (const ROTableRow&);
@@ -206,6 +216,18 @@ public:
     // record() function. So one can ignore the return value of get().
     const TableRecord& get (rownr_t rownr, Bool alwaysRead = False) const;
 
+    // Make sure that the given field contains the value in the current row
+    // and return the record containing all fields.
+    // Only in lazy mode does it have to read the value.
+    // An exception is thrown if the field does not exist.
+    // <group>
+    const TableRecord& getField (uInt whichField) const;
+    const TableRecord& getField (const String& name) const;
+    // </group>
+
+    // Is the row read lazily?
+    Bool isLazy() const;
+
     // Get the block telling for each column if its value in the row
     // was indefined in the table.
     // Note that array values might be undefined in the table, but in
@@ -265,11 +287,21 @@ protected:
     //# A switch to indicate that the last row has to be reread.
     //# This is the case when it has been put after being read.
     mutable Bool  itsReread;
+    //# Are the fields read lazily?
+    Bool          itsLazy;
+    //# In lazy mode, tell if a field has been read for the last row.
+    mutable Block<Bool> itsFieldRead;
 
 private:
     // Initialize the object.
     void init();
 
+    // Read the value of the given field in the given row.
+    void readField (uInt whichField, rownr_t rownr) const;
+
+    // Read all fields that have not been read yet (in lazy mode).
+    void readPending() const;
+
     // Make a RecordDesc from the table with some excluded column names.
     void makeDescExclude (RecordDesc& description,
 			  const Vector<String>& columnNames,
@@ -506,12 +538,22 @@ inline Int64 ROTableRow::rowNumber() const
 {
     return itsLastRow;
 }
+inline Bool ROTableRow::isLazy() const
+{
+    return itsLazy;
+}
 inline const TableRecord& ROTableRow::record() const
 {
+    if (itsLazy) {
+	readPending();
+    }
     return *itsRecord;
 }
 inline const Block<Bool>& ROTableRow::getDefined() const
 {
+    if (itsLazy) {
+	readPending();
+    }
     return itsDefined;
 }
 inline TableRecord& TableRow::record()
@@ -0,0 +1,360 @@
+//# TableSnapshot.cc: Snapshot of the metadata of a table for a fast open
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/Tables/TableSnapshot.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/TableAttr.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/TableInfo.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/IO/RegularFileIO.h>
+#include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+namespace {
+
+  const char   snapMagic[] = "CASASNAP";
+  const uInt   snapVersion = 3;
+  // Length of the fixed part of the header.
+  const uInt64 snapHeader = 56;
+
+  // Read an entire file. The size is -1 if the file does not exist.
+  void readFile (const String& name, Int64& size, std::vector<uChar>& data)
+  {
+    struct stat buf;
+    if (::stat (name.chars(), &buf) != 0) {
+      size = -1;
+      data.clear();
+      return;
+    }
+    size = buf.st_size;
+    data.resize (size);
+    if (size > 0) {
+      RegularFileIO file ((RegularFile(name)));
+      file.read (size, data.data());
+    }
+  }
+
+  // Get the FNV-1a hash value of a byte array.
+  uInt64 hashBytes (const std::vector<uChar>& data)
+  {
+    uInt64 hash = 14695981039346656037ULL;
+    for (size_t i=0; i<data.size(); ++i) {
+      hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  // Get the AipsIO image of a record.
+  void recordImage (const TableRecord& rec, const TableAttr& attr,
+                    std::vector<uChar>& data)
+  {
+    MemoryIO memio;
+    AipsIO aio (&memio);
+    rec.putRecord (aio, attr);
+    aio.close();
+    data.assign (memio.getBuffer(), memio.getBuffer() + memio.length());
+  }
+
+} //# end anonymous namespace
+
+
+TableSnapshot::TableSnapshot (const String& fileName)
+: itsFile     (RegularFile(fileName)),
+  itsData     (0),
+  itsLength   (itsFile.getFileSize()),
+  itsNrColumn (0)
+{
+  if (itsLength < snapHeader) {
+    throw TableError ("TableSnapshot: " + fileName + " is too short");
+  }
+  itsData = static_cast<const uChar*>(itsFile.getReadPointer (0));
+  if (memcmp (itsData, snapMagic, 8) != 0  ||
+      getuInt(8) != snapVersion) {
+    throw TableError ("TableSnapshot: " + fileName +
+                      " is not a snapshot file of this version");
+  }
+  itsNrColumn = getuInt (12);
+  uInt64 nsect = ColumnKeywords + uInt64(itsNrColumn);
+  if (snapHeader + 16*nsect > itsLength) {
+    throw TableError ("TableSnapshot: " + fileName + " is corrupt");
+  }
+  for (uInt i=0; i<nsect; ++i) {
+    uInt64 offset = getInt64 (snapHeader + 16*i);
+    uInt64 length = getInt64 (snapHeader + 16*i + 8);
+    if (offset > itsLength  ||  length > itsLength - offset) {
+      throw TableError ("TableSnapshot: " + fileName + " is corrupt");
+    }
+  }
+}
+
+std::shared_ptr<TableSnapshot> TableSnapshot::open
+                                            (const String& tableName,
+                                             Int64 changeCounter)
+{
+  std::shared_ptr<TableSnapshot> snapshot;
+  if (exists (tableName)) {
+    // A snapshot that cannot be used is ignored.
+    try {
+      snapshot.reset (new TableSnapshot (fileName (tableName)));
+      if (! snapshot->isValid (getStamp (tableName, changeCounter))) {
+        snapshot.reset();
+      }
+    } catch (const AipsError&) {
+      snapshot.reset();
+    }
+  }
+  return snapshot;
+}
+
+Bool TableSnapshot::isValid (const Stamp& stamp) const
+{
+  // The table info file is compared by contents, because it is rewritten
+  // each time the table file is written.
+  return getInt64(16) == stamp.changeCounter  &&
+         getInt64(24) == stamp.descOffset  &&
+         getInt64(32) == stamp.descLength  &&
+         uInt64(getInt64(40)) == stamp.descHash  &&
+         getInt64(48) == stamp.infoSize  &&
+         sectionLength(InfoFile) == stamp.info.size()  &&
+         (stamp.info.empty()  ||
+          memcmp (section(InfoFile), stamp.info.data(),
+                  stamp.info.size()) == 0);
+}
+
+TableSnapshot::Stamp TableSnapshot::getStamp (const String& tableName,
+                                              Int64 changeCounter)
+{
+  // Read the info file before the table file is read,
+  // so a file changed in the meantime invalidates the snapshot.
+  Stamp stamp;
+  stamp.changeCounter = changeCounter;
+  stamp.descHash      = 0;
+  readFile (tableName + "/table.info", stamp.infoSize, stamp.info);
+  // Find the description in the table file like PlainTable reads it.
+  // Only the header is parsed; the description itself is skipped.
+  RegularFileIO file ((RegularFile(Table::fileName(tableName))));
+  AipsIO ios (&file);
+  uInt version = ios.getstart ("Table");
+  if (version > 3) {
+    throw TableError ("PlainTable version " + String::toString(version) +
+                      " not supported by this version of Casacore");
+  }
+  if (version > 2) {
+    rownr_t nrrow;
+    ios >> nrrow;
+  } else {
+    uInt nrrow;
+    ios >> nrrow;
+  }
+  uInt format;
+  String tp;
+  ios >> format >> tp;
+  stamp.descOffset = ios.getpos();
+  ios.skipObject();
+  stamp.descLength = ios.getpos() - stamp.descOffset;
+  // Without the change counter the description has to be compared.
+  if (changeCounter < 0) {
+    std::vector<uChar> data (stamp.descLength);
+    file.seek (stamp.descOffset);
+    file.read (data.size(), data.data());
+    stamp.descHash = hashBytes (data);
+  }
+  return stamp;
+}
+
+void TableSnapshot::write (const String& tableName, const TableDesc& desc,
+                           const TableAttr& attr, Int64 changeCounter)
+{
+  write (tableName, desc, attr, getStamp (tableName, changeCounter));
+}
+
+Bool TableSnapshot::update (const String& tableName, const TableDesc& desc,
+                            const TableAttr& attr, Int64 changeCounter)
+{
+  if (! exists (tableName)) {
+    return False;
+  }
+  Stamp stamp = getStamp (tableName, changeCounter);
+  try {
+    TableSnapshot snapshot (fileName (tableName));
+    if (snapshot.isValid (stamp)) {
+      return False;
+    }
+  } catch (const AipsError&) {
+    // An unusable snapshot is replaced.
+  }
+  write (tableName, desc, attr, stamp);
+  return True;
+}
+
+void TableSnapshot::write (const String& tableName, const TableDesc& desc,
+                           const TableAttr& attr, const Stamp& stamp)
+{
+  std::vector<std::vector<uChar> > sections (ColumnKeywords);
+  sections[InfoFile] = stamp.info;
+  // Split off the keyword sets. The copy of the description shares
+  // them with the table until they are replaced by empty ones.
+  TableDesc copy (desc, TableDesc::Scratch);
+  uInt ncolumn = copy.ncolumn();
+  sections.resize (ColumnKeywords + ncolumn);
+  recordImage (copy.keywordSet(), attr, sections[TableKeywords]);
+  copy.rwKeywordSet() = TableRecord();
+  for (uInt i=0; i<ncolumn; ++i) {
+    recordImage (copy.columnDesc(i).keywordSet(), attr,
+                 sections[ColumnKeywords + i]);
+    copy.rwColumnDesc(i).rwKeywordSet() = TableRecord();
+  }
+  {
+    MemoryIO memio;
+    AipsIO aio (&memio);
+    copy.putFile (aio, attr);
+    aio.close();
+    sections[Description].assign (memio.getBuffer(),
+                                  memio.getBuffer() + memio.length());
+  }
+  // Lay out the file.
+  uInt64 nsect = sections.size();
+  std::vector<uInt64> offsets (nsect);
+  uInt64 length = snapHeader + 16*nsect;
+  for (uInt64 i=0; i<nsect; ++i) {
+    length = (length + 7) / 8 * 8;
+    offsets[i] = length;
+    length += sections[i].size();
+  }
+  std::vector<uChar> data (length, 0);
+  uChar* ptr = data.data();
+  memcpy (ptr, snapMagic, 8);
+  LECanonicalConversion::fromLocal (ptr + 8, snapVersion);
+  LECanonicalConversion::fromLocal (ptr + 12, ncolumn);
+  LECanonicalConversion::fromLocal (ptr + 16, stamp.changeCounter);
+  LECanonicalConversion::fromLocal (ptr + 24, stamp.descOffset);
+  LECanonicalConversion::fromLocal (ptr + 32, stamp.descLength);
+  LECanonicalConversion::fromLocal (ptr + 40, Int64(stamp.descHash));
+  LECanonicalConversion::fromLocal (ptr + 48, stamp.infoSize);
+  for (uInt64 i=0; i<nsect; ++i) {
+    LECanonicalConversion::fromLocal (ptr + snapHeader + 16*i, offsets[i]);
+    uInt64 size = sections[i].size();
+    LECanonicalConversion::fromLocal (ptr + snapHeader + 16*i + 8, size);
+    if (size > 0) {
+      memcpy (ptr + offsets[i], sections[i].data(), size);
+    }
+  }
+  // Write a temporary file and rename it, so the snapshot is replaced
+  // atomically. Its name is unique for each thread of each process.
+  std::ostringstream tmpName;
+  tmpName << fileName(tableName) << '_' << getpid()
+          << '_' << std::this_thread::get_id();
+  {
+    RegularFileIO file (RegularFile(tmpName.str()), ByteIO::New);
+    file.write (length, ptr);
+  }
+  RegularFile(tmpName.str()).move (fileName(tableName));
+}
+
+Bool TableSnapshot::remove (const String& tableName)
+{
+  if (! exists (tableName)) {
+    return False;
+  }
+  RegularFile(fileName(tableName)).remove();
+  return True;
+}
+
+Bool TableSnapshot::exists (const String& tableName)
+{
+  return File(fileName(tableName)).exists();
+}
+
+String TableSnapshot::fileName (const String& tableName)
+{
+  return tableName + "/table.snap";
+}
+
+void TableSnapshot::getDesc (TableDesc& desc, const TableAttr& attr) const
+{
+  MemoryIO memio (section(Description), sectionLength(Description));
+  AipsIO aio (&memio);
+  desc.getFile (aio, attr);
+  if (desc.ncolumn() != itsNrColumn) {
+    throw TableError ("TableSnapshot: number of columns mismatches");
+  }
+  std::shared_ptr<const void> owner = shared_from_this();
+  desc.rwKeywordSet().getRecordDeferred (owner, section(TableKeywords),
+                                         sectionLength(TableKeywords), attr);
+  for (uInt i=0; i<itsNrColumn; ++i) {
+    desc.rwColumnDesc(i).rwKeywordSet().getRecordDeferred
+                                  (owner, section(ColumnKeywords + i),
+                                   sectionLength(ColumnKeywords + i), attr);
+  }
+}
+
+TableInfo TableSnapshot::tableInfo() const
+{
+  std::istringstream is (std::string
+                         ((const char*)(section(InfoFile)),
+                          sectionLength(InfoFile)));
+  return TableInfo (is);
+}
+
+const uChar* TableSnapshot::section (uInt index) const
+{
+  return itsData + getInt64 (snapHeader + 16*index);
+}
+
+uInt64 TableSnapshot::sectionLength (uInt index) const
+{
+  return getInt64 (snapHeader + 16*index + 8);
+}
+
+uInt TableSnapshot::getuInt (uInt64 offset) const
+{
+  uInt value;
+  LECanonicalConversion::toLocal (value, itsData + offset);
+  return value;
+}
+
+Int64 TableSnapshot::getInt64 (uInt64 offset) const
+{
+  Int64 value;
+  LECanonicalConversion::toLocal (value, itsData + offset);
+  return value;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,215 @@
+//# TableSnapshot.h: Snapshot of the metadata of a table for a fast open
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TABLESNAPSHOT_H
+#define TABLES_TABLESNAPSHOT_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/IO/MMapIO.h>
+#include <memory>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class TableAttr;
+class TableDesc;
+class TableInfo;
+
+
+// <summary>
+// Snapshot of the metadata of a table for a fast open.
+// </summary>
+
+// <use visibility=local>
+
+// <prerequisite>
+//  <li> PlainTable
+// </prerequisite>
+
+// <synopsis>
+// Opening a table reads the table file (<src>table.dat</src>) holding
+// the table description, the keywords and the data manager state, and the
+// table info file. Most of the time goes to reading the keyword sets of
+// the table and its columns, which can be large (e.g. the measures info
+// of all columns of a MeasurementSet).
+// <br>A TableSnapshot is a file <src>table.snap</src> in the table
+// directory holding the table description with the keyword sets split
+// off, and the table info file. When PlainTable opens a table having a
+// valid snapshot, it skips the description in the table file, reads the
+// description without keywords from the snapshot and reads a keyword set
+// only when it is accessed (see
+// <linkto class=TableRecord>TableRecord::getRecordDeferred</linkto>).
+// The table info file is taken from the snapshot as well.
+// <p>
+// The snapshot is valid if the table change counter in the lock file
+// (see <linkto class=TableSyncData>TableSyncData</linkto>) is the same as
+// when the snapshot was written, the description in the table file has
+// the same offset and length, and the table info file has the same
+// contents. The counter is incremented by each process writing a changed
+// description or keywords, so the description itself does not need to be
+// read. Finding its offset and length only needs the header of the table
+// file to be parsed.
+// <br>A table opened without locking does not maintain the counter in
+// the lock file. Then the counter is given as -1, and a hash value of the
+// description in the table file is checked as well, which means that the
+// description is read once more.
+// <br>The table info file is rewritten each time the table file is
+// written, so its modification time cannot be used. It is small, so it is
+// read and compared with the copy in the snapshot.
+// The data manager state in the table file is not part of the snapshot,
+// so changing data (e.g. adding rows) does not invalidate it.
+// If invalid, the snapshot is ignored. Once written, a snapshot is kept
+// up to date by a process writing the table file; it is only rewritten if
+// the description or the table info changed. It is written into a
+// temporary file which is renamed, so processes still using an older
+// snapshot are not affected.
+// <p>
+// All numbers in the file are little endian. It is laid out as:
+// <srcblock>
+//   "CASASNAP"                          magic (8 bytes)
+//   uint32 version (3)
+//   uint32 number of columns
+//   int64  table change counter (-1 if not locked)
+//   int64  offset and length of the description in table.dat
+//   uint64 FNV-1a hash of the description in table.dat (0 if locked)
+//   int64  size of table.info (-1 if absent)
+//   per section: uint64 offset, uint64 length
+//   sections                            each starting at a multiple of 8
+// </srcblock>
+// The sections are the table description with empty keyword sets, the
+// table info file, the table keyword set, and the keyword set of each
+// column. The description and keyword sets are AipsIO images as written
+// by TableDesc::putFile and TableRecord::putRecord.
+// </synopsis>
+
+// <motivation>
+// Batch jobs opening thousands of tables only to look at some keywords
+// and columns spend most of their time reading keywords they never use.
+// </motivation>
+
+class TableSnapshot : public std::enable_shared_from_this<TableSnapshot>
+{
+public:
+    // Map the snapshot of the given table if it exists and is valid.
+    // A null pointer is returned otherwise.
+    // <br><src>changeCounter</src> is the table change counter in the
+    // lock file of the table, or -1 if the table is not locked.
+    static std::shared_ptr<TableSnapshot> open (const String& tableName,
+                                                Int64 changeCounter);
+
+    // Write the snapshot of the given table from its description, which
+    // must be the one in its table file.
+    static void write (const String& tableName, const TableDesc& desc,
+                       const TableAttr& attr, Int64 changeCounter);
+
+    // Rewrite the snapshot of the given table if it has one that is not
+    // valid anymore, thus if the description or table info changed.
+    // It returns True if the snapshot was written.
+    static Bool update (const String& tableName, const TableDesc& desc,
+                        const TableAttr& attr, Int64 changeCounter);
+
+    // Remove the snapshot of the given table.
+    // It returns False if the table did not have a snapshot.
+    static Bool remove (const String& tableName);
+
+    // Test if the given table has a snapshot (valid or not).
+    static Bool exists (const String& tableName);
+
+    // Get the name of the snapshot file of the given table.
+    static String fileName (const String& tableName);
+
+    // Read the table description. Its keyword sets are read when accessed.
+    void getDesc (TableDesc& desc, const TableAttr& attr) const;
+
+    // Get the table info.
+    TableInfo tableInfo() const;
+
+private:
+    // The sections in the file.
+    enum Section {
+        Description,
+        InfoFile,
+        TableKeywords,
+        ColumnKeywords
+    };
+
+    // Map the snapshot file.
+    explicit TableSnapshot (const String& fileName);
+
+    // Forbid copy constructor and assignment.
+    // <group>
+    TableSnapshot (const TableSnapshot&);
+    TableSnapshot& operator= (const TableSnapshot&);
+    // </group>
+
+    // The identity of the table files described by a snapshot.
+    struct Stamp {
+        Int64  changeCounter;
+        Int64  descOffset;
+        Int64  descLength;
+        uInt64 descHash;
+        Int64  infoSize;
+        std::vector<uChar> info;
+    };
+
+    // Get the stamp of the table files.
+    // The description is only hashed if the table change counter is -1.
+    static Stamp getStamp (const String& tableName, Int64 changeCounter);
+
+    // Write the snapshot for the table files having the given stamp.
+    static void write (const String& tableName, const TableDesc& desc,
+                       const TableAttr& attr, const Stamp& stamp);
+
+    // Check if the snapshot matches the stamp of the table files.
+    Bool isValid (const Stamp& stamp) const;
+
+    // Get the start and length of a section.
+    // <group>
+    const uChar* section (uInt index) const;
+    uInt64 sectionLength (uInt index) const;
+    // </group>
+
+    // Get a little endian number at the given offset in the file.
+    // <group>
+    uInt getuInt (uInt64 offset) const;
+    Int64 getInt64 (uInt64 offset) const;
+    // </group>
+
+
+    MMapIO       itsFile;
+    const uChar* itsData;
+    uInt64       itsLength;
+    uInt         itsNrColumn;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -108,6 +108,13 @@ public:
     // Get the modify counter.
     uInt getModifyCounter() const;
 
+    // Get the table change counter and the change counters of the
+    // data managers as last written or read.
+    // <group>
+    uInt getTableChangeCounter() const;
+    const Block<uInt>& getDataManChangeCounters() const;
+    // </group>
+
 
 private:
     // Copy constructor is forbidden.
@@ -138,6 +145,16 @@ inline uInt TableSyncData::getModifyCounter() const
     return itsModifyCounter;
 }
 
+inline uInt TableSyncData::getTableChangeCounter() const
+{
+    return itsTableChangeCounter;
+}
+
+inline const Block<uInt>& TableSyncData::getDataManChangeCounters() const
+{
+    return itsDataManChangeCounter;
+}
+
 
 
 
@@ -30,10 +30,14 @@
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/BasicSL/STLIO.h>
 #include <casacore/casa/Quanta/MVTime.h>
 #include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/OS/Path.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -47,6 +51,158 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   int TableTrace::theirColType = 0;
   std::vector<Regex> TableTrace::theirColumns;
   std::vector<String> TableTrace::theirTables;
+  std::atomic<Bool> TableTrace::theirMetrics (False);
+  TableTrace::MetricsIds TableTrace::theirMetricsColumns;
+  TableTrace::MetricsIds TableTrace::theirMetricsDataManagers;
+
+
+  // A latency histogram in nanoseconds. Values below 16 have their own
+  // bucket; thereafter each power of 2 has 16 linear sub-buckets.
+  // Latencies above 2^40 ns (18 minutes) end up in the last bucket.
+  struct TableMetricsHistogram
+  {
+    enum {NBUCKET = 37*16};
+
+    TableMetricsHistogram()
+      : count (0), total (0), min (~uInt64(0)), max (0), buckets (NBUCKET, 0)
+    {}
+
+    static uInt bucket (uInt64 value)
+    {
+      if (value < 16) {
+        return value;
+      }
+      uInt msb = 63 - __builtin_clzll (value);
+      uInt inx = (msb-3) * 16 + ((value >> (msb-4)) & 15);
+      return std::min (inx, uInt(NBUCKET-1));
+    }
+
+    // Get the middle value of a bucket.
+    static uInt64 bucketValue (uInt inx)
+    {
+      if (inx < 16) {
+        return inx;
+      }
+      uInt shift = inx/16 - 1;
+      return ((16 + inx%16) << shift) + (uInt64(1) << shift) / 2;
+    }
+
+    void add (uInt64 value)
+    {
+      count++;
+      total += value;
+      min = std::min (min, value);
+      max = std::max (max, value);
+      buckets[bucket(value)]++;
+    }
+
+    void merge (const TableMetricsHistogram& that)
+    {
+      count += that.count;
+      total += that.total;
+      min = std::min (min, that.min);
+      max = std::max (max, that.max);
+      for (uInt i=0; i<NBUCKET; ++i) {
+        buckets[i] += that.buckets[i];
+      }
+    }
+
+    uInt64 percentile (Double fraction) const
+    {
+      uInt64 rank = std::max (uInt64(1), uInt64(std::ceil (fraction * count)));
+      uInt64 sum = 0;
+      for (uInt i=0; i<NBUCKET; ++i) {
+        sum += buckets[i];
+        if (sum >= rank) {
+          return std::max (min, std::min (max, bucketValue(i)));
+        }
+      }
+      return max;
+    }
+
+    Record toRecord() const
+    {
+      Record rec;
+      rec.define ("count", Int64(count));
+      rec.define ("total", total * 1e-9);
+      rec.define ("min", min * 1e-9);
+      rec.define ("max", max * 1e-9);
+      rec.define ("mean", Double(total) / count * 1e-9);
+      rec.define ("p50", percentile(0.5) * 1e-9);
+      rec.define ("p90", percentile(0.9) * 1e-9);
+      rec.define ("p99", percentile(0.99) * 1e-9);
+      rec.define ("p999", percentile(0.999) * 1e-9);
+      return rec;
+    }
+
+    uInt64 count;
+    uInt64 total;
+    uInt64 min;
+    uInt64 max;
+    std::vector<uInt64> buckets;
+  };
+
+  // The metrics collected by a thread. The histogram of column id and
+  // operation oper is at index id*NMETRICSOPER+oper; the same scheme is
+  // used for the data manager counters. The histograms are only made
+  // when needed. The mutex is only contended while merging the shards.
+  struct TableMetricsShard
+  {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<TableMetricsHistogram>> latencies;
+    std::vector<uInt64> counts;
+  };
+
+  //# The shards of all threads. The shard of a thread that ended is reused
+  //# by a new thread (keeping its numbers), otherwise the many short-lived
+  //# threads made by std::async would make the list grow forever.
+  static std::mutex theirMetricsMutex;
+  static std::vector<TableMetricsShard*> theirShards;
+  static std::vector<TableMetricsShard*> theirFreeShards;
+
+  struct TableMetricsShardHolder
+  {
+    TableMetricsShardHolder()
+      : shard (0)
+    {}
+    ~TableMetricsShardHolder()
+    {
+      if (shard) {
+        std::lock_guard<std::mutex> locker(theirMetricsMutex);
+        theirFreeShards.push_back (shard);
+      }
+    }
+    TableMetricsShard* shard;
+  };
+
+  static TableMetricsShard& metricsShard()
+  {
+    static thread_local TableMetricsShardHolder holder;
+    if (! holder.shard) {
+      std::lock_guard<std::mutex> locker(theirMetricsMutex);
+      if (theirFreeShards.empty()) {
+        holder.shard = new TableMetricsShard();
+        theirShards.push_back (holder.shard);
+      } else {
+        holder.shard = theirFreeShards.back();
+        theirFreeShards.pop_back();
+      }
+    }
+    return *holder.shard;
+  }
+
+  // Get the subrecord of a table in the metrics record.
+  static Record& metricsTableRecord (Record& rec, const String& tableName)
+  {
+    if (! rec.isDefined (tableName)) {
+      Record tabRec;
+      tabRec.defineRecord ("columns", Record());
+      tabRec.defineRecord ("datamanagers", Record());
+      rec.defineRecord (tableName, tabRec);
+    }
+    return rec.rwSubRecord (tableName);
+  }
+
 
   int TableTrace::traceTable (const String& tableName, char oper)
   {
@@ -263,10 +419,202 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     *theirStream << endl;
   }
 
+  void TableTrace::setMetrics (Bool enable)
+  {
+    // Initialize first, otherwise it would overwrite the setting later.
+    std::call_once(theirCallOnceFlag, initTracing);
+    theirMetrics = enable;
+  }
+
+  int TableTrace::metricsId (MetricsIds& ids,
+                             const String& tableName, const String& name)
+  {
+    std::lock_guard<std::mutex> locker(theirMetricsMutex);
+    std::pair<String,String> key(tableName, name);
+    std::map<std::pair<String,String>, std::pair<int,uInt> >::iterator iter =
+      ids.ids.find (key);
+    if (iter != ids.ids.end()) {
+      iter->second.second++;
+      return iter->second.first;
+    }
+    int id;
+    if (ids.freeIds.empty()) {
+      id = ids.nextId++;
+    } else {
+      id = ids.freeIds.back();
+      ids.freeIds.pop_back();
+    }
+    ids.ids[key] = std::make_pair (id, 1u);
+    return id;
+  }
+
+  Bool TableTrace::releaseMetricsId (MetricsIds& ids, int id)
+  {
+    //# Releasing is rare, so a linear search is fine.
+    for (std::map<std::pair<String,String>, std::pair<int,uInt> >::iterator
+           iter = ids.ids.begin(); iter != ids.ids.end(); ++iter) {
+      if (iter->second.first == id) {
+        if (--iter->second.second > 0) {
+          return False;
+        }
+        ids.ids.erase (iter);
+        ids.freeIds.push_back (id);
+        return True;
+      }
+    }
+    return False;
+  }
+
+  int TableTrace::metricsColumn (const String& tableName,
+                                 const String& columnName)
+  {
+    return metricsId (theirMetricsColumns, tableName, columnName);
+  }
+
+  int TableTrace::metricsDataManager (const String& tableName,
+                                      const String& dataManagerName)
+  {
+    return metricsId (theirMetricsDataManagers, tableName, dataManagerName);
+  }
+
+  void TableTrace::releaseMetricsColumn (int id)
+  {
+    std::lock_guard<std::mutex> locker(theirMetricsMutex);
+    if (releaseMetricsId (theirMetricsColumns, id)) {
+      //# Clear the numbers, so a new user of the id starts afresh.
+      for (TableMetricsShard* shard : theirShards) {
+        std::lock_guard<std::mutex> shardLocker(shard->mutex);
+        for (size_t i=size_t(id) * NMETRICSOPER;
+             i < std::min (size_t(id+1) * NMETRICSOPER,
+                           shard->latencies.size()); ++i) {
+          shard->latencies[i].reset();
+        }
+      }
+    }
+  }
+
+  void TableTrace::releaseMetricsDataManager (int id)
+  {
+    std::lock_guard<std::mutex> locker(theirMetricsMutex);
+    if (releaseMetricsId (theirMetricsDataManagers, id)) {
+      for (TableMetricsShard* shard : theirShards) {
+        std::lock_guard<std::mutex> shardLocker(shard->mutex);
+        for (size_t i=size_t(id) * NMETRICSCOUNTER;
+             i < std::min (size_t(id+1) * NMETRICSCOUNTER,
+                           shard->counts.size()); ++i) {
+          shard->counts[i] = 0;
+        }
+      }
+    }
+  }
+
+  void TableTrace::addLatency (int id, MetricsOper oper,
+                               std::chrono::steady_clock::duration latency)
+  {
+    TableMetricsShard& shard = metricsShard();
+    std::lock_guard<std::mutex> locker(shard.mutex);
+    size_t inx = size_t(id) * NMETRICSOPER + oper;
+    if (inx >= shard.latencies.size()) {
+      shard.latencies.resize (inx + NMETRICSOPER);
+    }
+    std::unique_ptr<TableMetricsHistogram>& hist = shard.latencies[inx];
+    if (! hist) {
+      hist.reset (new TableMetricsHistogram());
+    }
+    hist->add (std::chrono::duration_cast<std::chrono::nanoseconds>
+               (latency).count());
+  }
+
+  void TableTrace::addCount (int id, MetricsCounter counter, uInt64 n)
+  {
+    TableMetricsShard& shard = metricsShard();
+    std::lock_guard<std::mutex> locker(shard.mutex);
+    size_t inx = size_t(id) * NMETRICSCOUNTER + counter;
+    if (inx >= shard.counts.size()) {
+      shard.counts.resize (inx + NMETRICSCOUNTER, 0);
+    }
+    shard.counts[inx] += n;
+  }
+
+  Record TableTrace::metrics()
+  {
+    static const char* operNames[NMETRICSOPER] = {
+      "get", "getSlice", "getColumn", "getColumnSlice",
+      "put", "putSlice", "putColumn", "putColumnSlice"};
+    std::lock_guard<std::mutex> locker(theirMetricsMutex);
+    // Merge the shards.
+    std::vector<std::unique_ptr<TableMetricsHistogram>> latencies;
+    std::vector<uInt64> counts;
+    for (TableMetricsShard* shard : theirShards) {
+      std::lock_guard<std::mutex> shardLocker(shard->mutex);
+      if (shard->latencies.size() > latencies.size()) {
+        latencies.resize (shard->latencies.size());
+      }
+      for (size_t i=0; i<shard->latencies.size(); ++i) {
+        if (shard->latencies[i]) {
+          if (! latencies[i]) {
+            latencies[i].reset (new TableMetricsHistogram());
+          }
+          latencies[i]->merge (*shard->latencies[i]);
+        }
+      }
+      if (shard->counts.size() > counts.size()) {
+        counts.resize (shard->counts.size(), 0);
+      }
+      for (size_t i=0; i<shard->counts.size(); ++i) {
+        counts[i] += shard->counts[i];
+      }
+    }
+    Record rec;
+    for (const auto& entry : theirMetricsColumns.ids) {
+      Record colRec;
+      for (uInt oper=0; oper<NMETRICSOPER; ++oper) {
+        size_t inx = size_t(entry.second.first) * NMETRICSOPER + oper;
+        if (inx < latencies.size()  &&  latencies[inx]) {
+          colRec.defineRecord (operNames[oper], latencies[inx]->toRecord());
+        }
+      }
+      if (colRec.nfields() > 0) {
+        metricsTableRecord (rec, entry.first.first).rwSubRecord
+          ("columns").defineRecord (entry.first.second, colRec);
+      }
+    }
+    for (const auto& entry : theirMetricsDataManagers.ids) {
+      size_t inx = size_t(entry.second.first) * NMETRICSCOUNTER;
+      if (inx < counts.size()) {
+        const uInt64* cnt = &(counts[inx]);
+        Record dmRec;
+        dmRec.define ("accesses", Int64(cnt[ACCESSES]));
+        dmRec.define ("hits", Int64(cnt[ACCESSES] > cnt[MISSES] ?
+                                    cnt[ACCESSES] - cnt[MISSES] : 0));
+        dmRec.define ("misses", Int64(cnt[MISSES]));
+        dmRec.define ("bytesread", Int64(cnt[BYTESREAD]));
+        dmRec.define ("byteswritten", Int64(cnt[BYTESWRITTEN]));
+        dmRec.define ("tilesconverted", Int64(cnt[TILESCONVERTED]));
+        metricsTableRecord (rec, entry.first.first).rwSubRecord
+          ("datamanagers").defineRecord (entry.first.second, dmRec);
+      }
+    }
+    return rec;
+  }
+
+  void TableTrace::resetMetrics()
+  {
+    std::lock_guard<std::mutex> locker(theirMetricsMutex);
+    for (TableMetricsShard* shard : theirShards) {
+      std::lock_guard<std::mutex> shardLocker(shard->mutex);
+      shard->latencies.clear();
+      shard->counts.clear();
+    }
+  }
+
   void TableTrace::initTracing()
   {
     // Set initially to no tracing.
     theirDoTrace = -1;
+    Bool metrics;
+    AipsrcValue<Bool>::find (metrics, "table.trace.metrics", False);
+    theirMetrics = metrics;
     // Get the file name.
     String fname;
     AipsrcValue<String>::find (fname, "table.trace.filename", "");
@@ -0,0 +1,154 @@
+//# TableWatcher.cc: Follow the changes made to a table by another process
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableWatcher.h>
+#include <casacore/tables/Tables/PlainTable.h>
+#include <casacore/tables/Tables/TableSyncData.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <chrono>
+#include <unistd.h>
+
+#if defined(AIPS_LINUX)
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TableWatcher::TableWatcher (const Table& table, double pollInterval)
+: table_p         (table),
+  plain_p         (dynamic_cast<PlainTable*>(table.baseTablePtr())),
+  pollInterval_p  (pollInterval),
+  notifyFd_p      (-1),
+  modifyCounter_p (0),
+  tableCounter_p  (0),
+  firstNewRow_p   (table.nrow()),
+  nrow_p          (table.nrow()),
+  rowsRemoved_p   (False),
+  tableChanged_p  (False)
+{
+    if (plain_p == 0  ||  table.tableType() != Table::Plain) {
+        throw TableError ("TableWatcher: table " + table.tableName() +
+                          " is not a plain table stored on disk");
+    }
+    if (pollInterval_p <= 0) {
+        throw TableError ("TableWatcher: poll interval must be positive");
+    }
+    const TableSyncData& sync = plain_p->syncData();
+    modifyCounter_p = sync.getModifyCounter();
+    tableCounter_p  = sync.getTableChangeCounter();
+    dmCounters_p    = sync.getDataManChangeCounters();
+#if defined(AIPS_LINUX)
+    //# Failing to watch is not an error; the lock file is polled anyway.
+    notifyFd_p = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+    if (notifyFd_p >= 0) {
+        const char* files[] = {"/table.lock", "/table.dat"};
+        for (const char* file : files) {
+            String name = table.tableName() + file;
+            inotify_add_watch (notifyFd_p, name.chars(),
+                               IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB);
+        }
+    }
+#endif
+}
+
+TableWatcher::~TableWatcher()
+{
+    if (notifyFd_p >= 0) {
+        ::close (notifyFd_p);
+    }
+}
+
+Bool TableWatcher::wait (double timeout)
+{
+    auto start = std::chrono::steady_clock::now();
+    while (! check()) {
+        std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+        double remaining = timeout - elapsed.count();
+        if (remaining <= 0) {
+            return False;
+        }
+        sleep (std::min (remaining, pollInterval_p));
+    }
+    return True;
+}
+
+Bool TableWatcher::check()
+{
+    //# Let a writer waiting for an auto lock held by this process proceed.
+    //# If this process holds the write lock, nobody else can have changed
+    //# the table, while its own unflushed changes would be undone by a resync.
+    plain_p->autoReleaseLock();
+    if (! plain_p->hasLock (FileLocker::Write)) {
+        plain_p->resyncChanged();
+    }
+    //# The counters are compared with the ones of the previous report,
+    //# so changes picked up meanwhile by acquiring a lock are not missed.
+    const TableSyncData& sync = plain_p->syncData();
+    rownr_t nrow = table_p.nrow();
+    if (sync.getModifyCounter() == modifyCounter_p  &&  nrow == nrow_p) {
+        return False;
+    }
+    const Block<uInt>& dmCounters = sync.getDataManChangeCounters();
+    Block<Bool> dmChanged (dmCounters.nelements(), False);
+    for (uInt i=0; i<dmCounters.nelements(); ++i) {
+        dmChanged[i] = (i >= dmCounters_p.nelements()
+                        ||  dmCounters[i] != dmCounters_p[i]);
+    }
+    changedColumns_p.reference (plain_p->dataManagerColumns (dmChanged));
+    tableChanged_p  = (sync.getTableChangeCounter() != tableCounter_p);
+    rowsRemoved_p   = (nrow < nrow_p);
+    firstNewRow_p   = (rowsRemoved_p  ?  nrow : nrow_p);
+    nrow_p          = nrow;
+    modifyCounter_p = sync.getModifyCounter();
+    tableCounter_p  = sync.getTableChangeCounter();
+    dmCounters_p    = dmCounters;
+    return True;
+}
+
+void TableWatcher::sleep (double seconds)
+{
+#if defined(AIPS_LINUX)
+    if (notifyFd_p >= 0) {
+        struct pollfd pfd;
+        pfd.fd     = notifyFd_p;
+        pfd.events = POLLIN;
+        if (poll (&pfd, 1, int(seconds * 1000)) > 0) {
+            //# Drain the events; the files are inspected thereafter anyway.
+            char buf[4096];
+            while (::read (notifyFd_p, buf, sizeof(buf)) > 0) {
+            }
+        }
+        return;
+    }
+#endif
+    usleep (useconds_t(seconds * 1e6));
+}
+
+} //# NAMESPACE CASACORE - END
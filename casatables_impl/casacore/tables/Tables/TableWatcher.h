@@ -0,0 +1,168 @@
+//# TableWatcher.h: Follow the changes made to a table by another process
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TABLEWATCHER_H
+#define TABLES_TABLEWATCHER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/tables/Tables/Table.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class PlainTable;
+
+
+// <summary>
+// TableWatcher follows the changes made to a table by another process.
+// </summary>
+
+// <use visibility=export>
+
+// <prerequisite>
+//  <li> Table
+//  <li> TableLock
+// </prerequisite>
+
+// <synopsis>
+// A process reading a table while another process writes it (e.g. a
+// monitor following a measurement set being filled) can use
+// <src>Table::resync</src> to see the new data. However, that forces
+// all data managers to resync their caches, even if nothing has changed.
+// <p>
+// TableWatcher waits for the table to change and tells what has changed
+// since the previous change reported: the range of rows added (or that
+// rows were removed), the columns whose data manager wrote data, and if
+// the table itself (e.g. its keywords) has changed. Only the data managers
+// that have changed are resynced (or all of them if the number of rows
+// changed).
+// <p>
+// The writer publishes its changes in the lock file when it flushes the
+// table or releases its lock. On Linux the watcher uses inotify to be
+// notified when the lock file or table.dat is written. Because inotify
+// does not see changes made on other hosts of a network file system, the
+// lock file is also inspected every <src>pollInterval</src> seconds. On
+// other platforms only the latter is done.
+// <p>
+// The table should be opened with a lock option that does not acquire
+// read locks (AutoNoReadLocking or UserNoReadLocking), otherwise the
+// reader blocks the writer while reading.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//  Table tab ("my.ms", TableLock(TableLock::AutoNoReadLocking));
+//  TableWatcher watcher (tab);
+//  while (True) {
+//    if (watcher.wait (10)) {
+//      // Process rows firstNewRow() till nrow() of the changed columns.
+//    }
+//  }
+// </srcblock>
+// </example>
+
+class TableWatcher
+{
+public:
+    // Watch the given table, which must be a plain table stored on disk.
+    // Changes are reported relative to its current state.
+    explicit TableWatcher (const Table& table, double pollInterval = 1);
+
+    ~TableWatcher();
+
+    // Wait at most <src>timeout</src> seconds for the table to change.
+    // It returns True if the table has changed since the previous change
+    // reported, after which the functions below tell what has changed.
+    // A timeout of 0 means that the table is only checked once.
+    Bool wait (double timeout);
+
+    // Check if the table has changed without waiting.
+    Bool check();
+
+    // Get the file descriptor that becomes readable when the table files
+    // are written. It can be used in an event loop, after which
+    // <src>check</src> has to be called. It is -1 if notification is not
+    // available.
+    int fd() const
+        { return notifyFd_p; }
+
+    // Get the number of rows before and after the last reported change.
+    // Rows <src>firstNewRow()</src> till <src>nrow()</src> have been added.
+    // <group>
+    rownr_t firstNewRow() const
+        { return firstNewRow_p; }
+    rownr_t nrow() const
+        { return nrow_p; }
+    // </group>
+
+    // Were rows removed in the last reported change?
+    // In that case rows may have been renumbered.
+    Bool rowsRemoved() const
+        { return rowsRemoved_p; }
+
+    // Get the names of the columns whose data changed in the last
+    // reported change.
+    const Vector<String>& changedColumns() const
+        { return changedColumns_p; }
+
+    // Did the table itself (e.g. its keywords) change in the last
+    // reported change?
+    Bool tableChanged() const
+        { return tableChanged_p; }
+
+private:
+    // Forbid copy constructor and assignment.
+    // <group>
+    TableWatcher (const TableWatcher&);
+    TableWatcher& operator= (const TableWatcher&);
+    // </group>
+
+    // Sleep until a table file is written or <src>seconds</src> have passed.
+    void sleep (double seconds);
+
+
+    Table          table_p;
+    PlainTable*    plain_p;
+    double         pollInterval_p;
+    int            notifyFd_p;
+    uInt           modifyCounter_p;
+    uInt           tableCounter_p;
+    Block<uInt>    dmCounters_p;
+    rownr_t        firstNewRow_p;
+    rownr_t        nrow_p;
+    Bool           rowsRemoved_p;
+    Bool           tableChanged_p;
+    Vector<String> changedColumns_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif